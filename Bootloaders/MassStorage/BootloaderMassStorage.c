@@ -169,6 +169,9 @@ int main(void)
 		USB_USBTask();
 	}
 
+	/* Wait for the last FLASH page write to complete before the AVR is reset */
+	VirtualFAT_CompleteFLASHWrite();
+
 	/* Disconnect from the host - USB interface will be reset later along with the AVR */
 	USB_Detach();
 
@@ -320,6 +320,9 @@ static void ReadWriteFLASHFileBlock(const uint16_t BlockNumber,
 
 	if (Read)
 	{
+		/* Wait for any previous page write to complete so that the FLASH can be read */
+		VirtualFAT_CompleteFLASHWrite();
+
 		/* Read out the mapped block of data from the device's FLASH */
 		for (uint16_t i = 0; i < SECTOR_SIZE_BYTES; i++)
 		{
@@ -332,28 +335,87 @@ static void ReadWriteFLASHFileBlock(const uint16_t BlockNumber,
 	}
 	else
 	{
-		/* Write out the mapped block of data to the device's FLASH */
-		for (uint16_t i = 0; i < SECTOR_SIZE_BYTES; i += 2)
+		/* Write out the mapped block of data to the device's FLASH, one FLASH page at a time */
+		for (uint16_t PageOffset = 0; PageOffset < SECTOR_SIZE_BYTES; PageOffset += SPM_PAGESIZE)
 		{
-			if ((FlashAddress % SPM_PAGESIZE) == 0)
-			{
-				/* Erase the given FLASH page, ready to be programmed */
-				BootloaderAPI_ErasePage(FlashAddress);
-			}
+			bool PageErased  = true;
+			bool PageBlank   = true;
+			bool PageMatches = true;
 
-			/* Write the next data word to the FLASH page */
-			BootloaderAPI_FillWord(FlashAddress, (BlockBuffer[i + 1] << 8) | BlockBuffer[i]);
-			FlashAddress += 2;
+			/* Wait for any previous page write to complete so that the existing page contents can be read */
+			VirtualFAT_CompleteFLASHWrite();
 
-			if ((FlashAddress % SPM_PAGESIZE) == 0)
+			/* Compare the new page data against the existing FLASH page contents */
+			for (uint16_t i = 0; i < SPM_PAGESIZE; i++)
 			{
-				/* Write the filled FLASH page to memory */
-				BootloaderAPI_WritePage(FlashAddress - SPM_PAGESIZE);
+				#if (FLASHEND > 0xFFFF)
+				  uint8_t FlashByte = pgm_read_byte_far(FlashAddress + i);
+				#else
+				  uint8_t FlashByte = pgm_read_byte(FlashAddress + i);
+				#endif
+
+				uint8_t NewByte = BlockBuffer[PageOffset + i];
+
+				if (FlashByte != 0xFF)
+				  PageErased  = false;
+
+				if (NewByte != 0xFF)
+				  PageBlank   = false;
+
+				if (NewByte != FlashByte)
+				  PageMatches = false;
 			}
+
+			/* Only touch the FLASH page if its contents are changing, erasing it only if it has previously been
+			 * programmed and programming it only if the new page data is not blank */
+			if (!(PageMatches))
+			  ProgramFLASHPage(FlashAddress, &BlockBuffer[PageOffset], !(PageErased), !(PageBlank));
+
+			FlashAddress += SPM_PAGESIZE;
 		}
 	}
 }
 
+/** Erases and/or programs a single page of the device's FLASH memory. The page write is started but not waited on
+ *  where possible, so that it completes in the background while the next block of data is received from the host;
+ *  \ref VirtualFAT_CompleteFLASHWrite() must be called before the FLASH or EEPROM memory is next accessed.
+ *
+ *  \note This function must be located in the real bootloader section, as the SPM instruction cannot be executed
+ *        from the auxiliary bootloader section.
+ *
+ *  \param[in]  PageAddress  Address of the start of the FLASH page to erase and/or program
+ *  \param[in]  PageData     Pointer to the start of the new page data in RAM
+ *  \param[in]  ErasePage    If \c true, the FLASH page is erased before it is programmed
+ *  \param[in]  WritePage    If \c true, the FLASH page is programmed with the new page data
+ */
+static void ProgramFLASHPage(const uint32_t PageAddress,
+                             const uint8_t* PageData,
+                             const bool ErasePage,
+                             const bool WritePage)
+{
+	if (ErasePage)
+	{
+		/* Erase the given FLASH page, ready to be programmed */
+		boot_page_erase(PageAddress);
+		boot_spm_busy_wait();
+	}
+
+	if (WritePage)
+	{
+		/* Fill the FLASH page buffer with the new page data */
+		for (uint16_t i = 0; i < SPM_PAGESIZE; i += 2)
+		  boot_page_fill(PageAddress + i, (PageData[i + 1] << 8) | PageData[i]);
+
+		/* Start the write of the filled FLASH page to memory */
+		boot_page_write(PageAddress);
+	}
+
+	#if (AUX_BOOT_SECTION_SIZE > 0)
+	/* Part of the bootloader runs from the RWW FLASH section, which cannot be read until the write has completed */
+	VirtualFAT_CompleteFLASHWrite();
+	#endif
+}
+
 /** Reads or writes a block of data from/to the physical device EEPROM using a
  *  block buffer stored in RAM, if the requested block is within the virtual
  *  firmware file's sector ranges in the emulated FAT file system.
@@ -377,6 +439,9 @@ static void ReadWriteEEPROMFileBlock(const uint16_t BlockNumber,
 
 	uint16_t EEPROMAddress = (uint16_t)(BlockNumber - FileStartBlock) * SECTOR_SIZE_BYTES;
 
+	/* EEPROM cannot be accessed while a FLASH page write is in progress */
+	VirtualFAT_CompleteFLASHWrite();
+
 	if (Read)
 	{
 		/* Read out the mapped block of data from the device's EEPROM */
@@ -391,6 +456,16 @@ static void ReadWriteEEPROMFileBlock(const uint16_t BlockNumber,
 	}
 }
 
+/** Waits for any FLASH page write started by a previous block write to complete,
+ *  and re-enables reading of the application section of the FLASH memory. This
+ *  must be called before the bootloader exits, so that the final page write is
+ *  not interrupted by the device reset.
+ */
+void VirtualFAT_CompleteFLASHWrite(void)
+{
+	boot_rww_enable_safe();
+}
+
 /** Writes a block of data to the virtual FAT filesystem, from the USB Mass
  *  Storage interface.
  *
@@ -291,11 +291,17 @@
 			                                    uint8_t* BlockBuffer,
 			                                    const bool Read) AUX_BOOT_SECTION;
 
+			static void ProgramFLASHPage(const uint32_t PageAddress,
+			                             const uint8_t* PageData,
+			                             const bool ErasePage,
+			                             const bool WritePage) ATTR_NO_INLINE;
+
 			static void ReadWriteEEPROMFileBlock(const uint16_t BlockNumber,
 			                                     uint8_t* BlockBuffer,
 			                                     const bool Read) AUX_BOOT_SECTION;
 		#endif
 
+		void VirtualFAT_CompleteFLASHWrite(void) ATTR_NO_INLINE;
 		void VirtualFAT_WriteBlock(const uint16_t BlockNumber) AUX_BOOT_SECTION;
 		void VirtualFAT_ReadBlock(const uint16_t BlockNumber) AUX_BOOT_SECTION;
 
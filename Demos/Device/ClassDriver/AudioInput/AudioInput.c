@@ -36,6 +36,9 @@
 
 #include "AudioInput.h"
 
+/** Audio sample buffer, filled by the sample timer and drained in whole packets to the streaming endpoint. */
+static int16_t AudioSampleBuffer[AUDIO_SAMPLE_BUFFER_SIZE];
+
 /** LUFA Audio Class driver interface configuration and state information. This structure is
  *  passed to all Audio Class driver functions, so that multiple instances of the same class
  *  within a device can be differentiated from one another.
@@ -52,6 +55,9 @@ USB_ClassInfo_Audio_Device_t Microphone_Audio_Interface =
 						.Size             = AUDIO_STREAM_EPSIZE,
 						.Banks            = 2,
 					},
+				.SampleBuffer             = AudioSampleBuffer,
+				.SampleBufferSize         = AUDIO_SAMPLE_BUFFER_SIZE,
+				.ChannelCount             = 1,
 			},
 	};
 
@@ -99,13 +105,11 @@ void SetupHardware(void)
 	ADC_StartReading(ADC_REFERENCE_AVCC | ADC_RIGHT_ADJUSTED | ADC_GET_CHANNEL_MASK(MIC_IN_ADC_CHANNEL));
 }
 
-/** ISR to handle the reloading of the data endpoint with the next sample. */
+/** ISR to handle the storing of the next sample into the sample buffer. */
 ISR(TIMER0_COMPA_vect, ISR_BLOCK)
 {
-	uint8_t PrevEndpoint = Endpoint_GetCurrentEndpoint();
-
-	/* Check that the USB bus is ready for the next sample to write */
-	if (Audio_Device_IsReadyForNextSample(&Microphone_Audio_Interface))
+	/* Check that the host is streaming audio from the device */
+	if (Microphone_Audio_Interface.State.InterfaceEnabled)
 	{
 		int16_t AudioSample;
 
@@ -129,10 +133,8 @@ ISR(TIMER0_COMPA_vect, ISR_BLOCK)
 			#endif
 		#endif
 
-		Audio_Device_WriteSample16(&Microphone_Audio_Interface, AudioSample);
+		Audio_Device_WriteBufferedSample16(&Microphone_Audio_Interface, AudioSample);
 	}
-
-	Endpoint_SelectEndpoint(PrevEndpoint);
 }
 
 /** Event handler for the library USB Connection event. */
@@ -70,6 +70,9 @@
 		/** LED mask for the library LED driver, to indicate that an error has occurred in the USB interface. */
 		#define LEDMASK_USB_ERROR        (LEDS_LED1 | LEDS_LED3)
 
+		/** Size of the audio sample buffer between the sample timer and the streaming endpoint, in samples. */
+		#define AUDIO_SAMPLE_BUFFER_SIZE (AUDIO_STREAM_EPSIZE * 2)
+
 	/* Function Prototypes: */
 		void SetupHardware(void);
 
@@ -36,6 +36,9 @@
 
 #include "AudioOutput.h"
 
+/** Audio sample buffer, filled with whole packets from the streaming endpoint and drained by the sample timer. */
+static int16_t AudioSampleBuffer[AUDIO_SAMPLE_BUFFER_SIZE];
+
 /** LUFA Audio Class driver interface configuration and state information. This structure is
  *  passed to all Audio Class driver functions, so that multiple instances of the same class
  *  within a device can be differentiated from one another.
@@ -52,6 +55,15 @@ USB_ClassInfo_Audio_Device_t Speaker_Audio_Interface =
 						.Size             = AUDIO_STREAM_EPSIZE,
 						.Banks            = 2,
 					},
+				.FeedbackINEndpoint       =
+					{
+						.Address          = AUDIO_FEEDBACK_EPADDR,
+						.Size             = AUDIO_FEEDBACK_EPSIZE,
+						.Banks            = 1,
+					},
+				.SampleBuffer             = AudioSampleBuffer,
+				.SampleBufferSize         = AUDIO_SAMPLE_BUFFER_SIZE,
+				.ChannelCount             = 2,
 			},
 	};
 
@@ -96,14 +108,12 @@ void SetupHardware(void)
 /** ISR to handle the reloading of the PWM timer with the next sample. */
 ISR(TIMER0_COMPA_vect, ISR_BLOCK)
 {
-	uint8_t PrevEndpoint = Endpoint_GetCurrentEndpoint();
-
-	/* Check that the USB bus is ready for the next sample to read */
-	if (Audio_Device_IsSampleReceived(&Speaker_Audio_Interface))
+	/* Check that the host is streaming audio to the device */
+	if (Speaker_Audio_Interface.State.InterfaceEnabled)
 	{
-		/* Retrieve the signed 16-bit left and right audio samples, convert to 8-bit */
-		int8_t LeftSample_8Bit  = (Audio_Device_ReadSample16(&Speaker_Audio_Interface) >> 8);
-		int8_t RightSample_8Bit = (Audio_Device_ReadSample16(&Speaker_Audio_Interface) >> 8);
+		/* Retrieve the signed 16-bit left and right audio samples from the sample buffer, convert to 8-bit */
+		int8_t LeftSample_8Bit  = (Audio_Device_ReadBufferedSample16(&Speaker_Audio_Interface) >> 8);
+		int8_t RightSample_8Bit = (Audio_Device_ReadBufferedSample16(&Speaker_Audio_Interface) >> 8);
 
 		/* Mix the two channels together to produce a mono, 8-bit sample */
 		int8_t MixedSample_8Bit = (((int16_t)LeftSample_8Bit + (int16_t)RightSample_8Bit) >> 1);
@@ -134,8 +144,6 @@ ISR(TIMER0_COMPA_vect, ISR_BLOCK)
 
 		LEDs_SetAllLEDs(LEDMask);
 	}
-
-	Endpoint_SelectEndpoint(PrevEndpoint);
 }
 
 /** Event handler for the library USB Connection event. */
@@ -200,6 +208,9 @@ void EVENT_USB_Device_ConfigurationChanged(void)
 
 	ConfigSuccess &= Audio_Device_ConfigureEndpoints(&Speaker_Audio_Interface);
 
+	/* Start of Frame events are used to measure the true sample rate for the rate feedback endpoint */
+	USB_Device_EnableSOFEvents();
+
 	LEDs_SetAllLEDs(ConfigSuccess ? LEDMASK_USB_READY : LEDMASK_USB_ERROR);
 }
 
@@ -209,6 +220,12 @@ void EVENT_USB_Device_ControlRequest(void)
 	Audio_Device_ProcessControlRequest(&Speaker_Audio_Interface);
 }
 
+/** Event handler for the USB device Start Of Frame event. */
+void EVENT_USB_Device_StartOfFrame(void)
+{
+	Audio_Device_ProcessStartOfFrame(&Speaker_Audio_Interface);
+}
+
 /** Audio class driver callback for the setting and retrieval of streaming endpoint properties. This callback must be implemented
  *  in the user application to handle property manipulations on streaming audio endpoints.
  *
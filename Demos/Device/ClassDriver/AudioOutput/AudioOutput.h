@@ -63,6 +63,9 @@
 		/** LED mask for the library LED driver, to indicate that an error has occurred in the USB interface. */
 		#define LEDMASK_USB_ERROR        (LEDS_LED1 | LEDS_LED3)
 
+		/** Size of the audio sample buffer between the streaming endpoint and the sample timer, in samples. */
+		#define AUDIO_SAMPLE_BUFFER_SIZE (AUDIO_STREAM_EPSIZE * 2)
+
 	/* Function Prototypes: */
 		void SetupHardware(void);
 
@@ -70,6 +73,7 @@
 		void EVENT_USB_Device_Disconnect(void);
 		void EVENT_USB_Device_ConfigurationChanged(void);
 		void EVENT_USB_Device_ControlRequest(void);
+		void EVENT_USB_Device_StartOfFrame(void);
 
 		bool CALLBACK_Audio_Device_GetSetEndpointProperty(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo,
 		                                                  const uint8_t EndpointProperty,
@@ -50,6 +50,12 @@
 		/** Endpoint size in bytes of the Audio isochronous streaming data endpoint. */
 		#define AUDIO_STREAM_EPSIZE           256
 
+		/** Endpoint address of the Audio isochronous rate feedback IN endpoint. */
+		#define AUDIO_FEEDBACK_EPADDR         (ENDPOINT_DIR_IN | 2)
+
+		/** Endpoint size in bytes of the Audio isochronous rate feedback endpoint. */
+		#define AUDIO_FEEDBACK_EPSIZE         3
+
 	/* Type Defines: */
 		/** Type define for the device configuration descriptor structure. This must be defined in the
 		 *  application code, as the configuration descriptor contains several sub-descriptors which
@@ -73,6 +79,7 @@
 			USB_Audio_SampleFreq_t                    Audio_AudioFormatSampleRates[5];
 			USB_Audio_Descriptor_StreamEndpoint_Std_t Audio_StreamEndpoint;
 			USB_Audio_Descriptor_StreamEndpoint_Spc_t Audio_StreamEndpoint_SPC;
+			USB_Audio_Descriptor_StreamEndpoint_Std_t Audio_FeedbackEndpoint;
 		} USB_Descriptor_Configuration_t;
 
 		/** Enum for the device interface descriptor IDs within the device. Each interface descriptor
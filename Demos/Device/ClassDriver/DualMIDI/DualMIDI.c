@@ -57,6 +57,7 @@ USB_ClassInfo_MIDI_Device_t Keyboard_MIDI_Interface =
 						.Size             = MIDI_STREAM_EPSIZE,
 						.Banks            = 1,
 					},
+				.FlushIntervalFrames      = 1,
 			},
 	};
 
@@ -75,9 +76,14 @@ int main(void)
 	{
 		CheckJoystickMovement();
 
-		MIDI_EventPacket_t ReceivedMIDIEvent;
-		while (MIDI_Device_ReceiveEventPacket(&Keyboard_MIDI_Interface, &ReceivedMIDIEvent))
+		MIDI_EventPacket_t ReceivedMIDIEvents[MIDI_EVENTS_PER_PACKET(MIDI_STREAM_EPSIZE)];
+		uint8_t            TotalEvents = MIDI_Device_ReceiveEventPackets(&Keyboard_MIDI_Interface, ReceivedMIDIEvents,
+		                                                                 MIDI_EVENTS_PER_PACKET(MIDI_STREAM_EPSIZE));
+
+		for (uint8_t EventIndex = 0; EventIndex < TotalEvents; EventIndex++)
 		{
+			MIDI_EventPacket_t ReceivedMIDIEvent = ReceivedMIDIEvents[EventIndex];
+
 			if ((ReceivedMIDIEvent.Event == MIDI_EVENT(0, MIDI_COMMAND_NOTE_ON)) && (ReceivedMIDIEvent.Data3 > 0))
 			  LEDs_SetAllLEDs(ReceivedMIDIEvent.Data2 > 64 ? LEDS_LED1 : LEDS_LED2);
 			else
@@ -44,5 +44,6 @@
 #define _APP_CONFIG_H_
 
 	#define GENERIC_REPORT_SIZE       8
+//	#define GENERIC_STREAM_QUEUE_DEPTH  16
 
 #endif
@@ -85,6 +85,22 @@
 		/** Size in bytes of the Generic HID reporting endpoint. */
 		#define GENERIC_EPSIZE            8
 
+		#if defined(GENERIC_STREAM_QUEUE_DEPTH)
+			/** Number of banks of the Generic HID reporting IN endpoint, double banked when streaming so that a queued
+			 *  report is always ready for the host's next poll.
+			 */
+			#define GENERIC_IN_EPBANKS        2
+
+			/** Polling interval of the Generic HID reporting IN endpoint in milliseconds, the minimum when streaming. */
+			#define GENERIC_POLLING_INTERVAL  1
+		#else
+			/** Number of banks of the Generic HID reporting IN endpoint. */
+			#define GENERIC_IN_EPBANKS        1
+
+			/** Polling interval of the Generic HID reporting IN endpoint in milliseconds. */
+			#define GENERIC_POLLING_INTERVAL  5
+		#endif
+
 	/* Function Prototypes: */
 		uint16_t CALLBACK_USB_GetDescriptor(const uint16_t wValue,
 		                                    const uint16_t wIndex,
@@ -39,6 +39,11 @@
 /** Buffer to hold the previously generated HID report, for comparison purposes inside the HID class driver. */
 static uint8_t PrevHIDReportBuffer[GENERIC_REPORT_SIZE];
 
+#if defined(GENERIC_STREAM_QUEUE_DEPTH)
+/** Buffer to hold the queue of streamed HID reports waiting to be sent to the host by the HID class driver. */
+static uint8_t HIDReportQueue[GENERIC_STREAM_QUEUE_DEPTH][GENERIC_REPORT_SIZE];
+#endif
+
 /** LUFA HID Class driver interface configuration and state information. This structure is
  *  passed to all HID Class driver functions, so that multiple instances of the same class
  *  within a device can be differentiated from one another.
@@ -52,10 +57,14 @@ USB_ClassInfo_HID_Device_t Generic_HID_Interface =
 					{
 						.Address              = GENERIC_IN_EPADDR,
 						.Size                 = GENERIC_EPSIZE,
-						.Banks                = 1,
+						.Banks                = GENERIC_IN_EPBANKS,
 					},
 				.PrevReportINBuffer           = PrevHIDReportBuffer,
 				.PrevReportINBufferSize       = sizeof(PrevHIDReportBuffer),
+				#if defined(GENERIC_STREAM_QUEUE_DEPTH)
+				.ReportQueue                  = HIDReportQueue,
+				.ReportQueueDepth             = GENERIC_STREAM_QUEUE_DEPTH,
+				#endif
 			},
 	};
 
@@ -72,11 +81,47 @@ int main(void)
 
 	for (;;)
 	{
+		#if defined(GENERIC_STREAM_QUEUE_DEPTH)
+		CreateStreamReport();
+		#endif
+
 		HID_Device_USBTask(&Generic_HID_Interface);
 		USB_USBTask();
 	}
 }
 
+/** Queues a new streamed HID report once per USB frame, standing in for a data acquisition source. Each report
+ *  carries a running sequence number, so that the host can detect reports dropped due to a full report queue.
+ */
+void CreateStreamReport(void)
+{
+	static uint16_t PrevFrameNum;
+	static uint16_t SequenceNumber;
+
+	if (USB_DeviceState != DEVICE_STATE_Configured)
+	  return;
+
+	uint16_t FrameNum = USB_Device_GetFrameNumber();
+
+	if (FrameNum == PrevFrameNum)
+	  return;
+
+	PrevFrameNum = FrameNum;
+
+	uint8_t Report[GENERIC_REPORT_SIZE];
+	memset(Report, 0, sizeof(Report));
+
+	Report[0] = (SequenceNumber & 0xFF);
+	Report[1] = (SequenceNumber >> 8);
+	Report[2] = (FrameNum & 0xFF);
+	Report[3] = (FrameNum >> 8);
+	Report[4] = HID_Device_QueuedReports(&Generic_HID_Interface);
+
+	SequenceNumber++;
+
+	HID_Device_QueueReport(&Generic_HID_Interface, Report);
+}
+
 /** Configures the board hardware and chip peripherals for the demo's functionality. */
 void SetupHardware(void)
 {
@@ -50,6 +50,11 @@
 		#include <LUFA/Drivers/USB/USB.h>
 		#include <LUFA/Platform/Platform.h>
 
+	/* Preprocessor Checks: */
+		#if defined(GENERIC_STREAM_QUEUE_DEPTH) && (GENERIC_REPORT_SIZE < 5)
+			#error GENERIC_REPORT_SIZE must be at least 5 bytes when GENERIC_STREAM_QUEUE_DEPTH is defined.
+		#endif
+
 	/* Macros: */
 		/** LED mask for the library LED driver, to indicate that the USB interface is not ready. */
 		#define LEDMASK_USB_NOTREADY      LEDS_LED1
@@ -65,6 +70,7 @@
 
 	/* Function Prototypes: */
 		void SetupHardware(void);
+		void CreateStreamReport(void);
 
 		void EVENT_USB_Device_Connect(void);
 		void EVENT_USB_Device_Disconnect(void);
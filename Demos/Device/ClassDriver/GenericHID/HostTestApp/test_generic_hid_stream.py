@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+
+"""
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+"""
+
+"""
+    LUFA Generic HID device demo host streaming test script. This script will
+    receive the report stream sent by the demo when it is compiled with the
+    GENERIC_STREAM_QUEUE_DEPTH option, and periodically print the achieved
+    report rate, the spacing of consecutive reports in USB frames and the
+    number of reports the device dropped due to a full report queue.
+
+    Requires the PyUSB library (http://sourceforge.net/apps/trac/pyusb/).
+"""
+
+import sys
+import time
+import usb.core
+import usb.util
+
+# Generic HID device VID, PID and statistics reporting interval in seconds
+device_vid = 0x03EB
+device_pid = 0x204F
+report_interval = 1.0
+
+def get_and_init_hid_device():
+    device = usb.core.find(idVendor=device_vid, idProduct=device_pid)
+
+    if device is None:
+        sys.exit("Could not find USB device.")
+
+    if device.is_kernel_driver_active(0):
+        try:
+            device.detach_kernel_driver(0)
+        except usb.core.USBError as exception:
+            sys.exit("Could not detatch kernel driver: %s" % str(exception))
+
+    try:
+        device.set_configuration()
+    except usb.core.USBError as exception:
+        sys.exit("Could not set configuration: %s" % str(exception))
+
+    return device
+
+def receive_stream_report(hid_device, endpoint):
+    report_data = hid_device.read(endpoint.bEndpointAddress, endpoint.wMaxPacketSize, 1000)
+
+    sequence_number = report_data[0] | (report_data[1] << 8)
+    frame_number = report_data[2] | (report_data[3] << 8)
+    queued_reports = report_data[4]
+
+    return (sequence_number, frame_number, queued_reports)
+
+def main():
+    hid_device = get_and_init_hid_device()
+    endpoint = hid_device[0][(0,0)][0]
+
+    print("Connected to device 0x%04X/0x%04X - %s [%s], polling interval %d ms" %
+          (hid_device.idVendor, hid_device.idProduct,
+           usb.util.get_string(hid_device, 256, hid_device.iProduct),
+           usb.util.get_string(hid_device, 256, hid_device.iManufacturer),
+           endpoint.bInterval))
+
+    prev_sequence = None
+    prev_frame = None
+
+    total_received = 0
+    total_dropped = 0
+
+    while (True):
+        received = 0
+        dropped = 0
+        max_queued = 0
+        frame_spacing = {}
+
+        period_start = time.time()
+        while ((time.time() - period_start) < report_interval):
+            (sequence, frame, queued) = receive_stream_report(hid_device, endpoint)
+
+            if prev_sequence is not None:
+                # Gaps in the sequence numbers are reports dropped on the device
+                dropped += (sequence - prev_sequence - 1) & 0xFFFF
+
+                # USB frame numbers are 11 bits wide, and wrap every 2048 frames
+                spacing = (frame - prev_frame) & 0x7FF
+                frame_spacing[spacing] = frame_spacing.get(spacing, 0) + 1
+
+            prev_sequence = sequence
+            prev_frame = frame
+
+            received += 1
+            max_queued = max(max_queued, queued)
+
+        elapsed = time.time() - period_start
+
+        total_received += received
+        total_dropped += dropped
+
+        print("%7.1f reports/s, %d dropped (%d of %d total), max %d queued, frame spacing %s" %
+              (received / elapsed, dropped, total_dropped, total_received + total_dropped, max_queued,
+               ", ".join("%d:%d" % (spacing, count) for (spacing, count) in sorted(frame_spacing.items()))))
+
+if __name__ == '__main__':
+    main()
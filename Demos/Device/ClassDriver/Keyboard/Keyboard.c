@@ -36,9 +36,6 @@
 
 #include "Keyboard.h"
 
-/** Buffer to hold the previously generated Keyboard HID report, for comparison purposes inside the HID class driver. */
-static uint8_t PrevKeyboardHIDReportBuffer[sizeof(USB_KeyboardReport_Data_t)];
-
 /** LUFA HID Class driver interface configuration and state information. This structure is
  *  passed to all HID Class driver functions, so that multiple instances of the same class
  *  within a device can be differentiated from one another.
@@ -54,8 +51,9 @@ USB_ClassInfo_HID_Device_t Keyboard_HID_Interface =
 						.Size                 = KEYBOARD_EPSIZE,
 						.Banks                = 1,
 					},
-				.PrevReportINBuffer           = PrevKeyboardHIDReportBuffer,
-				.PrevReportINBufferSize       = sizeof(PrevKeyboardHIDReportBuffer),
+				.PrevReportINBuffer           = NULL,
+				.PrevReportINBufferSize       = sizeof(USB_KeyboardReport_Data_t),
+				.TrackReportChanges           = true,
 			},
 	};
 
@@ -72,11 +70,31 @@ int main(void)
 
 	for (;;)
 	{
+		CheckInputChanges();
+
 		HID_Device_USBTask(&Keyboard_HID_Interface);
 		USB_USBTask();
 	}
 }
 
+/** Polls the board joystick and buttons, and flags the keyboard report as changed to the HID class driver whenever
+ *  their state changes, so that the report is only created when there is a new key state to send to the host.
+ */
+void CheckInputChanges(void)
+{
+	static uint8_t PrevJoyStatus;
+	static uint8_t PrevButtonStatus;
+
+	uint8_t JoyStatus_LCL    = Joystick_GetStatus();
+	uint8_t ButtonStatus_LCL = Buttons_GetStatus();
+
+	if ((JoyStatus_LCL != PrevJoyStatus) || (ButtonStatus_LCL != PrevButtonStatus))
+	  HID_Device_MarkReportsChanged(&Keyboard_HID_Interface, 0x01);
+
+	PrevJoyStatus    = JoyStatus_LCL;
+	PrevButtonStatus = ButtonStatus_LCL;
+}
+
 /** Configures the board hardware and chip peripherals for the demo's functionality. */
 void SetupHardware()
 {
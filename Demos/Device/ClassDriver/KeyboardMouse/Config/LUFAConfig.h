@@ -73,6 +73,7 @@
 		#define FIXED_CONTROL_ENDPOINT_SIZE      8
 //		#define DEVICE_STATE_AS_GPIOR            {Insert Value Here}
 		#define FIXED_NUM_CONFIGURATIONS         1
+		#define DEVICE_MAX_INTERFACES            2
 //		#define CONTROL_ONLY_DEVICE
 //		#define INTERRUPT_CONTROL_ENDPOINT
 //		#define NO_DEVICE_REMOTE_WAKEUP
@@ -113,6 +114,7 @@
 		#define FIXED_CONTROL_ENDPOINT_SIZE      8
 //		#define DEVICE_STATE_AS_GPIOR            {Insert Value Here}
 		#define FIXED_NUM_CONFIGURATIONS         1
+		#define DEVICE_MAX_INTERFACES            2
 //		#define CONTROL_ONLY_DEVICE
 		#define MAX_ENDPOINT_INDEX               3
 //		#define NO_DEVICE_REMOTE_WAKEUP
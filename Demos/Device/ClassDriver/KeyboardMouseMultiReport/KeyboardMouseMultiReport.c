@@ -36,9 +36,6 @@
 
 #include "KeyboardMouseMultiReport.h"
 
-/** Buffer to hold the previously generated HID report, for comparison purposes inside the HID class driver. */
-static uint8_t PrevHIDReportBuffer[MAX(sizeof(USB_KeyboardReport_Data_t), sizeof(USB_MouseReport_Data_t))];
-
 /** LUFA HID Class driver interface configuration and state information. This structure is
  *  passed to all HID Class driver functions, so that multiple instances of the same class
  *  within a device can be differentiated from one another.
@@ -54,8 +51,9 @@ USB_ClassInfo_HID_Device_t Device_HID_Interface =
 						.Size                 = HID_EPSIZE,
 						.Banks                = 1,
 					},
-				.PrevReportINBuffer           = PrevHIDReportBuffer,
-				.PrevReportINBufferSize       = sizeof(PrevHIDReportBuffer),
+				.PrevReportINBuffer           = NULL,
+				.PrevReportINBufferSize       = MAX(sizeof(USB_KeyboardReport_Data_t), sizeof(USB_MouseReport_Data_t)),
+				.TrackReportChanges           = true,
 			},
 	};
 
@@ -72,11 +70,50 @@ int main(void)
 
 	for (;;)
 	{
+		CheckInputChanges();
+
 		HID_Device_USBTask(&Device_HID_Interface);
 		USB_USBTask();
 	}
 }
 
+/** Polls the board joystick and buttons, and flags the keyboard and mouse reports as changed to the HID class driver
+ *  when their contents change. The mouse report is also flagged continuously while the joystick is held in a direction
+ *  in mouse mode, as the mouse movement is relative.
+ */
+void CheckInputChanges(void)
+{
+	static uint8_t PrevJoyStatus;
+	static uint8_t PrevButtonStatus;
+
+	uint8_t          JoyStatus_LCL    = Joystick_GetStatus();
+	uint8_t          ButtonStatus_LCL = Buttons_GetStatus();
+	HID_ReportMask_t ChangedReports   = 0;
+
+	bool ModeChanged     = ((ButtonStatus_LCL ^ PrevButtonStatus) & BUTTONS_BUTTON1);
+	bool JoystickChanged = (JoyStatus_LCL != PrevJoyStatus);
+
+	if (ModeChanged)
+	{
+		ChangedReports = ((1 << HID_REPORTID_KeyboardReport) | (1 << HID_REPORTID_MouseReport));
+	}
+	else if (ButtonStatus_LCL & BUTTONS_BUTTON1)
+	{
+		if (JoystickChanged || (JoyStatus_LCL & (JOY_UP | JOY_DOWN | JOY_LEFT | JOY_RIGHT)))
+		  ChangedReports = (1 << HID_REPORTID_MouseReport);
+	}
+	else if (JoystickChanged)
+	{
+		ChangedReports = (1 << HID_REPORTID_KeyboardReport);
+	}
+
+	if (ChangedReports)
+	  HID_Device_MarkReportsChanged(&Device_HID_Interface, ChangedReports);
+
+	PrevJoyStatus    = JoyStatus_LCL;
+	PrevButtonStatus = ButtonStatus_LCL;
+}
+
 /** Configures the board hardware and chip peripherals for the demo's functionality. */
 void SetupHardware()
 {
@@ -157,13 +194,23 @@ bool CALLBACK_HID_Device_CreateHIDReport(USB_ClassInfo_HID_Device_t* const HIDIn
                                          void* ReportData,
                                          uint16_t* const ReportSize)
 {
-	uint8_t JoyStatus_LCL    = Joystick_GetStatus();
-	uint8_t ButtonStatus_LCL = Buttons_GetStatus();
+	uint8_t          JoyStatus_LCL    = Joystick_GetStatus();
+	uint8_t          ButtonStatus_LCL = Buttons_GetStatus();
 
-	if (!(ButtonStatus_LCL & BUTTONS_BUTTON1))
+	/* Create the report flagged as changed or requested by the host if given, otherwise the report of the current mode */
+	if (!(*ReportID))
+	  *ReportID = (ButtonStatus_LCL & BUTTONS_BUTTON1) ? HID_REPORTID_MouseReport : HID_REPORTID_KeyboardReport;
+
+	if (*ReportID == HID_REPORTID_KeyboardReport)
 	{
 		USB_KeyboardReport_Data_t* KeyboardReport = (USB_KeyboardReport_Data_t*)ReportData;
 
+		*ReportSize = sizeof(USB_KeyboardReport_Data_t);
+
+		/* All keys are released while the first board button is held down and the joystick controls the mouse */
+		if (ButtonStatus_LCL & BUTTONS_BUTTON1)
+		  return false;
+
 		KeyboardReport->Modifier = HID_KEYBOARD_MODIFIER_LEFTSHIFT;
 
 		if (JoyStatus_LCL & JOY_UP)
@@ -179,14 +226,18 @@ bool CALLBACK_HID_Device_CreateHIDReport(USB_ClassInfo_HID_Device_t* const HIDIn
 		if (JoyStatus_LCL & JOY_PRESS)
 		  KeyboardReport->KeyCode[0] = HID_KEYBOARD_SC_E;
 
-		*ReportID   = HID_REPORTID_KeyboardReport;
-		*ReportSize = sizeof(USB_KeyboardReport_Data_t);
 		return false;
 	}
 	else
 	{
 		USB_MouseReport_Data_t* MouseReport = (USB_MouseReport_Data_t*)ReportData;
 
+		*ReportSize = sizeof(USB_MouseReport_Data_t);
+
+		/* The mouse is idle while the first board button is released and the joystick controls the keyboard */
+		if (!(ButtonStatus_LCL & BUTTONS_BUTTON1))
+		  return true;
+
 		if (JoyStatus_LCL & JOY_UP)
 		  MouseReport->Y = -1;
 		else if (JoyStatus_LCL & JOY_DOWN)
@@ -200,8 +251,6 @@ bool CALLBACK_HID_Device_CreateHIDReport(USB_ClassInfo_HID_Device_t* const HIDIn
 		if (JoyStatus_LCL & JOY_PRESS)
 		  MouseReport->Button |= (1 << 0);
 
-		*ReportID   = HID_REPORTID_MouseReport;
-		*ReportSize = sizeof(USB_MouseReport_Data_t);
 		return true;
 	}
 }
@@ -62,6 +62,7 @@
 
 	/* Function Prototypes: */
 		void SetupHardware(void);
+		void CheckInputChanges(void);
 
 		void EVENT_USB_Device_Connect(void);
 		void EVENT_USB_Device_Disconnect(void);
@@ -36,9 +36,6 @@
 
 #include "Mouse.h"
 
-/** Buffer to hold the previously generated Mouse HID report, for comparison purposes inside the HID class driver. */
-static uint8_t PrevMouseHIDReportBuffer[sizeof(USB_MouseReport_Data_t)];
-
 /** LUFA HID Class driver interface configuration and state information. This structure is
  *  passed to all HID Class driver functions, so that multiple instances of the same class
  *  within a device can be differentiated from one another.
@@ -54,8 +51,9 @@ USB_ClassInfo_HID_Device_t Mouse_HID_Interface =
 						.Size                 = MOUSE_EPSIZE,
 						.Banks                = 1,
 					},
-				.PrevReportINBuffer           = PrevMouseHIDReportBuffer,
-				.PrevReportINBufferSize       = sizeof(PrevMouseHIDReportBuffer),
+				.PrevReportINBuffer           = NULL,
+				.PrevReportINBufferSize       = sizeof(USB_MouseReport_Data_t),
+				.TrackReportChanges           = true,
 			},
 	};
 
@@ -72,11 +70,34 @@ int main(void)
 
 	for (;;)
 	{
+		CheckInputChanges();
+
 		HID_Device_USBTask(&Mouse_HID_Interface);
 		USB_USBTask();
 	}
 }
 
+/** Polls the board joystick and buttons, and flags the mouse report as changed to the HID class driver whenever their
+ *  state changes, and continuously while the joystick is held in a direction, as the mouse movement is relative.
+ */
+void CheckInputChanges(void)
+{
+	static uint8_t PrevJoyStatus;
+	static uint8_t PrevButtonStatus;
+
+	uint8_t JoyStatus_LCL    = Joystick_GetStatus();
+	uint8_t ButtonStatus_LCL = Buttons_GetStatus();
+
+	if ((JoyStatus_LCL != PrevJoyStatus) || (ButtonStatus_LCL != PrevButtonStatus) ||
+	    (JoyStatus_LCL & (JOY_UP | JOY_DOWN | JOY_LEFT | JOY_RIGHT)))
+	{
+		HID_Device_MarkReportsChanged(&Mouse_HID_Interface, 0x01);
+	}
+
+	PrevJoyStatus    = JoyStatus_LCL;
+	PrevButtonStatus = ButtonStatus_LCL;
+}
+
 /** Configures the board hardware and chip peripherals for the demo's functionality. */
 void SetupHardware(void)
 {
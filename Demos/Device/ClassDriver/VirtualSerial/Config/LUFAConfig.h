@@ -62,12 +62,14 @@
 		#define USB_DEVICE_ONLY
 //		#define USB_HOST_ONLY
 //		#define USB_STREAM_TIMEOUT_MS            {Insert Value Here}
+//		#define USB_TRACE_BUFFER_SIZE            {Insert Value Here}
 //		#define NO_LIMITED_CONTROLLER_CONNECT
 //		#define NO_SOF_EVENTS
 
 		/* USB Device Mode Driver Related Tokens: */
 //		#define USE_RAM_DESCRIPTORS
 		#define USE_FLASH_DESCRIPTORS
+		#define USE_DESCRIPTOR_TABLE
 //		#define USE_EEPROM_DESCRIPTORS
 //		#define NO_INTERNAL_SERIAL
 		#define FIXED_CONTROL_ENDPOINT_SIZE      8
@@ -102,12 +104,14 @@
 		/* General USB Driver Related Tokens: */
 		#define USE_STATIC_OPTIONS               (USB_DEVICE_OPT_FULLSPEED | USB_OPT_RC32MCLKSRC | USB_OPT_BUSEVENT_PRIHIGH)
 //		#define USB_STREAM_TIMEOUT_MS            {Insert Value Here}
+//		#define USB_TRACE_BUFFER_SIZE            {Insert Value Here}
 //		#define NO_LIMITED_CONTROLLER_CONNECT
 //		#define NO_SOF_EVENTS
 
 		/* USB Device Mode Driver Related Tokens: */
 //		#define USE_RAM_DESCRIPTORS
 		#define USE_FLASH_DESCRIPTORS
+		#define USE_DESCRIPTOR_TABLE
 //		#define USE_EEPROM_DESCRIPTORS
 //		#define NO_INTERNAL_SERIAL
 		#define FIXED_CONTROL_ENDPOINT_SIZE      8
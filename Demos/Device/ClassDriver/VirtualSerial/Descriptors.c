@@ -193,53 +193,17 @@ const USB_Descriptor_String_t PROGMEM ManufacturerString = USB_STRING_DESCRIPTOR
  */
 const USB_Descriptor_String_t PROGMEM ProductString = USB_STRING_DESCRIPTOR(L"LUFA CDC Demo");
 
-/** This function is called by the library when in device mode, and must be overridden (see library "USB Descriptors"
- *  documentation) by the application code so that the address and size of a requested descriptor can be given
- *  to the USB library. When the device receives a Get Descriptor request on the control endpoint, this function
- *  is called so that the descriptor details can be passed back and the appropriate descriptor sent back to the
- *  USB host.
+/** Descriptor table of the device. The library searches this table when the host issues a Get Descriptor request
+ *  on the control endpoint, in place of a user supplied \c CALLBACK_USB_GetDescriptor() function. Entries must be
+ *  listed in ascending order of descriptor type and index.
  */
-uint16_t CALLBACK_USB_GetDescriptor(const uint16_t wValue,
-                                    const uint16_t wIndex,
-                                    const void** const DescriptorAddress)
-{
-	const uint8_t  DescriptorType   = (wValue >> 8);
-	const uint8_t  DescriptorNumber = (wValue & 0xFF);
-
-	const void* Address = NULL;
-	uint16_t    Size    = NO_DESCRIPTOR;
-
-	switch (DescriptorType)
-	{
-		case DTYPE_Device:
-			Address = &DeviceDescriptor;
-			Size    = sizeof(USB_Descriptor_Device_t);
-			break;
-		case DTYPE_Configuration:
-			Address = &ConfigurationDescriptor;
-			Size    = sizeof(USB_Descriptor_Configuration_t);
-			break;
-		case DTYPE_String:
-			switch (DescriptorNumber)
-			{
-				case STRING_ID_Language:
-					Address = &LanguageString;
-					Size    = pgm_read_byte(&LanguageString.Header.Size);
-					break;
-				case STRING_ID_Manufacturer:
-					Address = &ManufacturerString;
-					Size    = pgm_read_byte(&ManufacturerString.Header.Size);
-					break;
-				case STRING_ID_Product:
-					Address = &ProductString;
-					Size    = pgm_read_byte(&ProductString.Header.Size);
-					break;
-			}
-
-			break;
-	}
-
-	*DescriptorAddress = Address;
-	return Size;
-}
-
+USB_DESCRIPTOR_TABLE(
+	USB_DESCRIPTOR_ENTRY(DTYPE_Device, 0, DeviceDescriptor),
+	USB_DESCRIPTOR_ENTRY(DTYPE_Configuration, 0, ConfigurationDescriptor),
+	USB_STRING_DESCRIPTOR_ENTRY(STRING_ID_Language, LanguageString),
+	USB_STRING_DESCRIPTOR_ENTRY(STRING_ID_Manufacturer, ManufacturerString),
+	USB_STRING_DESCRIPTOR_ENTRY(STRING_ID_Product, ProductString),
+);
+
+GCC_STATIC_ASSERT(USB_ENDPOINT_SIZE_IS_VALID(EP_TYPE_INTERRUPT, CDC_NOTIFICATION_EPSIZE), "Invalid CDC notification endpoint size.");
+GCC_STATIC_ASSERT(USB_ENDPOINT_SIZE_IS_VALID(EP_TYPE_BULK, CDC_TXRX_EPSIZE), "Invalid CDC data endpoint size.");
@@ -0,0 +1,412 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Host side decoder for the USB event trace records produced by the library when the \c USB_TRACE_BUFFER_SIZE
+ *  compile time token is set. This reads a binary dump of six byte trace records (for example, captured from the
+ *  VirtualSerial demo's virtual serial port with "cat /dev/ttyACM0 > trace.bin") and prints a summary of the bus
+ *  events, followed by the throughput of each endpoint and histograms of the stream completion latency and the
+ *  interval between endpoint bank transitions.
+ *
+ *  Trace timestamps are only 16 bits wide, and the decoder assumes that the timestamp timer wraps at most once between
+ *  consecutive records. Intervals longer than one full timer period (524ms at the default 125KHz rate) cannot be
+ *  recovered, and are counted as their length modulo the period, so throughput figures for traces containing long idle
+ *  periods are overstated; the timer rate should be chosen so that the longest expected gap between events is shorter
+ *  than the period.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+/** Default trace timestamp rate in Hz, matching the VirtualSerial demo's Timer 1 configuration of F_CPU/64. */
+#define DEFAULT_TICK_RATE_HZ    125000
+
+/** Number of power-of-two microsecond buckets in each latency histogram. */
+#define HISTOGRAM_BUCKETS       24
+
+/** Width of the longest histogram bar, in characters. */
+#define HISTOGRAM_BAR_WIDTH     40
+
+/** Size of each trace record in the dump, in bytes. */
+#define TRACE_RECORD_SIZE       6
+
+/** Trace event identifiers, which must match the \c USB_Trace_Events_t enum in LUFA/Drivers/USB/Core/USBTrace.h. */
+enum TraceEvents_t
+{
+	TRACE_EVENT_Overflow          = 0,
+	TRACE_EVENT_Connect           = 1,
+	TRACE_EVENT_Disconnect        = 2,
+	TRACE_EVENT_Suspend           = 3,
+	TRACE_EVENT_WakeUp            = 4,
+	TRACE_EVENT_Reset             = 5,
+	TRACE_EVENT_DeviceAttached    = 6,
+	TRACE_EVENT_DeviceUnattached  = 7,
+	TRACE_EVENT_HostError         = 8,
+	TRACE_EVENT_ControlRequest    = 9,
+	TRACE_EVENT_EndpointInterrupt = 10,
+	TRACE_EVENT_StreamStart       = 11,
+	TRACE_EVENT_BankComplete      = 12,
+	TRACE_EVENT_StreamComplete    = 13,
+	TRACE_EVENT_StreamError       = 14,
+	TRACE_EVENT_TotalEvents
+};
+
+/** Printable names of each trace event, indexed by event identifier. */
+static const char* const EventNames[TRACE_EVENT_TotalEvents] =
+	{
+		[TRACE_EVENT_Overflow]          = "Records lost",
+		[TRACE_EVENT_Connect]           = "VBUS connect",
+		[TRACE_EVENT_Disconnect]        = "VBUS disconnect",
+		[TRACE_EVENT_Suspend]           = "Suspend",
+		[TRACE_EVENT_WakeUp]            = "Wake up",
+		[TRACE_EVENT_Reset]             = "Bus reset",
+		[TRACE_EVENT_DeviceAttached]    = "Device attached",
+		[TRACE_EVENT_DeviceUnattached]  = "Device unattached",
+		[TRACE_EVENT_HostError]         = "Host error",
+		[TRACE_EVENT_ControlRequest]    = "Control request",
+		[TRACE_EVENT_EndpointInterrupt] = "Endpoint interrupt",
+		[TRACE_EVENT_StreamStart]       = "Stream start",
+		[TRACE_EVENT_BankComplete]      = "Bank complete",
+		[TRACE_EVENT_StreamComplete]    = "Stream complete",
+		[TRACE_EVENT_StreamError]       = "Stream error",
+	};
+
+/** Histogram of intervals, in power-of-two microsecond buckets. */
+typedef struct
+{
+	uint32_t Buckets[HISTOGRAM_BUCKETS]; /**< Number of intervals in each bucket; bucket N holds intervals
+	                                      *   below 2^(N+1) microseconds.
+	                                      */
+	uint32_t Samples; /**< Total number of intervals recorded. */
+	double   TotalUS; /**< Sum of all recorded intervals, in microseconds. */
+	double   MaxUS; /**< Longest recorded interval, in microseconds. */
+} Histogram_t;
+
+/** Accumulated statistics for a single endpoint or pipe address. */
+typedef struct
+{
+	uint32_t    Streams; /**< Number of streams started. */
+	uint32_t    Errors; /**< Number of streams aborted with an error. */
+	uint32_t    Interrupts; /**< Number of completion interrupts. */
+	uint64_t    TotalBytes; /**< Number of bytes transferred. */
+	uint64_t    FirstTick; /**< Time of the first event on the endpoint. */
+	uint64_t    LastTick; /**< Time of the last event on the endpoint. */
+	uint64_t    StreamStartTick; /**< Time the current stream was started. */
+	uint64_t    LastBankTick; /**< Time of the current stream's last bank transition, or its start. */
+	uint16_t    StreamBytes; /**< Bytes transferred so far in the current stream. */
+	int         StreamActive; /**< Non-zero if a stream has been started but not yet completed. */
+	int         Active; /**< Non-zero if any event has been recorded against the endpoint. */
+	Histogram_t StreamLatency; /**< Histogram of stream start to completion intervals. */
+	Histogram_t BankInterval; /**< Histogram of intervals between bank transitions within a stream. */
+} EndpointStats_t;
+
+/** Statistics for each possible endpoint or pipe address. */
+static EndpointStats_t EndpointStats[256];
+
+/** Number of occurrences of each trace event. */
+static uint32_t EventCounts[TRACE_EVENT_TotalEvents];
+
+/** Number of records reported lost by the device due to a full trace ring. */
+static uint64_t RecordsLost;
+
+/** Number of records with an unknown event identifier. */
+static uint32_t UnknownRecords;
+
+/** Adds an interval to a histogram.
+ *
+ *  \param[in,out] Hist        Histogram to add the interval to.
+ *  \param[in]     IntervalUS  Interval to record, in microseconds.
+ */
+static void Histogram_Add(Histogram_t* const Hist,
+                          const double IntervalUS)
+{
+	uint8_t Bucket = 0;
+
+	while ((Bucket < (HISTOGRAM_BUCKETS - 1)) && (IntervalUS >= (double)(2UL << Bucket)))
+	  Bucket++;
+
+	Hist->Buckets[Bucket]++;
+	Hist->Samples++;
+	Hist->TotalUS += IntervalUS;
+
+	if (IntervalUS > Hist->MaxUS)
+	  Hist->MaxUS = IntervalUS;
+}
+
+/** Prints a histogram as a bar chart, omitting leading and trailing empty buckets.
+ *
+ *  \param[in] Title  Title of the histogram.
+ *  \param[in] Hist   Histogram to print.
+ */
+static void Histogram_Print(const char* const Title,
+                            const Histogram_t* const Hist)
+{
+	if (!(Hist->Samples))
+	  return;
+
+	uint8_t  FirstBucket = HISTOGRAM_BUCKETS;
+	uint8_t  LastBucket  = 0;
+	uint32_t Largest     = 0;
+
+	for (uint8_t Bucket = 0; Bucket < HISTOGRAM_BUCKETS; Bucket++)
+	{
+		if (!(Hist->Buckets[Bucket]))
+		  continue;
+
+		if (FirstBucket == HISTOGRAM_BUCKETS)
+		  FirstBucket = Bucket;
+
+		LastBucket = Bucket;
+
+		if (Hist->Buckets[Bucket] > Largest)
+		  Largest = Hist->Buckets[Bucket];
+	}
+
+	printf("    %s: %u samples, mean %.1f us, max %.1f us\n", Title, Hist->Samples,
+	       (Hist->TotalUS / Hist->Samples), Hist->MaxUS);
+
+	for (uint8_t Bucket = FirstBucket; Bucket <= LastBucket; Bucket++)
+	{
+		uint32_t BarLength = ((uint64_t)Hist->Buckets[Bucket] * HISTOGRAM_BAR_WIDTH + Largest - 1) / Largest;
+
+		printf("      < %8lu us %8u |", (2UL << Bucket), Hist->Buckets[Bucket]);
+
+		for (uint32_t i = 0; i < BarLength; i++)
+		  putchar('#');
+
+		putchar('\n');
+	}
+}
+
+/** Closes the current stream of an endpoint, adding its transferred bytes to the endpoint's total.
+ *
+ *  \param[in,out] Stats  Statistics of the endpoint whose stream is to be closed.
+ *  \param[in]     Bytes  Number of bytes transferred by the stream.
+ */
+static void Endpoint_CloseStream(EndpointStats_t* const Stats,
+                                 const uint16_t Bytes)
+{
+	Stats->TotalBytes  += Bytes;
+	Stats->StreamBytes  = 0;
+	Stats->StreamActive = 0;
+}
+
+/** Processes a single trace record.
+ *
+ *  \param[in] Tick        Unwrapped timestamp of the record.
+ *  \param[in] EventID     Event identifier of the record.
+ *  \param[in] Endpoint    Endpoint field of the record.
+ *  \param[in] ByteCount   Byte count field of the record.
+ *  \param[in] TickRateHz  Rate of the trace timestamps, in Hz.
+ */
+static void ProcessRecord(const uint64_t Tick,
+                          const uint8_t EventID,
+                          const uint8_t Endpoint,
+                          const uint16_t ByteCount,
+                          const double TickRateHz)
+{
+	EndpointStats_t* Stats  = &EndpointStats[Endpoint];
+	double           TickUS = (1000000.0 / TickRateHz);
+
+	if (EventID >= TRACE_EVENT_TotalEvents)
+	{
+		UnknownRecords++;
+		return;
+	}
+
+	EventCounts[EventID]++;
+
+	switch (EventID)
+	{
+		case TRACE_EVENT_Overflow:
+			RecordsLost += ByteCount;
+			return;
+		case TRACE_EVENT_EndpointInterrupt:
+			Stats->Interrupts++;
+			break;
+		case TRACE_EVENT_StreamStart:
+			/* A stream left open was ended early by a partial transfer; count what it sent */
+			if (Stats->StreamActive)
+			  Endpoint_CloseStream(Stats, Stats->StreamBytes);
+
+			Stats->Streams++;
+			Stats->StreamActive    = 1;
+			Stats->StreamStartTick = Tick;
+			Stats->LastBankTick    = Tick;
+			break;
+		case TRACE_EVENT_BankComplete:
+			if (Stats->StreamActive)
+			{
+				Histogram_Add(&Stats->BankInterval, (Tick - Stats->LastBankTick) * TickUS);
+
+				Stats->LastBankTick = Tick;
+				Stats->StreamBytes  = ByteCount;
+			}
+
+			break;
+		case TRACE_EVENT_StreamComplete:
+			if (Stats->StreamActive)
+			{
+				Histogram_Add(&Stats->StreamLatency, (Tick - Stats->StreamStartTick) * TickUS);
+				Endpoint_CloseStream(Stats, ByteCount);
+			}
+
+			break;
+		case TRACE_EVENT_StreamError:
+			Stats->Errors++;
+
+			if (Stats->StreamActive)
+			  Endpoint_CloseStream(Stats, Stats->StreamBytes);
+
+			break;
+		default:
+			return;
+	}
+
+	if (!(Stats->Active))
+	{
+		Stats->Active    = 1;
+		Stats->FirstTick = Tick;
+	}
+
+	Stats->LastTick = Tick;
+}
+
+/** Prints the summary of all processed records.
+ *
+ *  \param[in] TotalRecords  Number of records processed.
+ *  \param[in] TotalTicks    Unwrapped timestamp of the last record.
+ *  \param[in] TickRateHz    Rate of the trace timestamps, in Hz.
+ */
+static void PrintSummary(const uint64_t TotalRecords,
+                         const uint64_t TotalTicks,
+                         const double TickRateHz)
+{
+	printf("%llu records over %.3f ms", (unsigned long long)TotalRecords, (TotalTicks * 1000.0 / TickRateHz));
+
+	if (RecordsLost)
+	  printf(", %llu records lost on the device", (unsigned long long)RecordsLost);
+
+	if (UnknownRecords)
+	  printf(", %u unknown records", UnknownRecords);
+
+	printf("\n\nEvents:\n");
+
+	for (uint8_t EventID = 0; EventID < TRACE_EVENT_TotalEvents; EventID++)
+	{
+		if (EventCounts[EventID])
+		  printf("  %-20s %10u\n", EventNames[EventID], EventCounts[EventID]);
+	}
+
+	for (uint16_t Endpoint = 0; Endpoint < 256; Endpoint++)
+	{
+		EndpointStats_t* Stats = &EndpointStats[Endpoint];
+
+		if (!(Stats->Active))
+		  continue;
+
+		double DurationS = ((Stats->LastTick - Stats->FirstTick) / TickRateHz);
+
+		printf("\nEndpoint 0x%02X (%s %u):\n", Endpoint, (Endpoint & 0x80) ? "IN" : "OUT", (Endpoint & 0x0F));
+		printf("  %u streams, %u errors, %u interrupts, %llu bytes", Stats->Streams, Stats->Errors,
+		       Stats->Interrupts, (unsigned long long)Stats->TotalBytes);
+
+		if (DurationS > 0)
+		  printf(", %.1f bytes/s", (Stats->TotalBytes / DurationS));
+
+		putchar('\n');
+
+		Histogram_Print("Stream latency", &Stats->StreamLatency);
+		Histogram_Print("Bank interval", &Stats->BankInterval);
+	}
+}
+
+int main(int argc,
+         char* argv[])
+{
+	double TickRateHz = DEFAULT_TICK_RATE_HZ;
+	FILE*  TraceFile  = stdin;
+	int    Option;
+
+	while ((Option = getopt(argc, argv, "r:h")) != -1)
+	{
+		switch (Option)
+		{
+			case 'r':
+				TickRateHz = atof(optarg);
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-r tick rate Hz] [trace file]\n", argv[0]);
+				return (Option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	if (!(TickRateHz > 0))
+	{
+		fprintf(stderr, "Invalid tick rate.\n");
+		return EXIT_FAILURE;
+	}
+
+	if ((optind < argc) && !(TraceFile = fopen(argv[optind], "rb")))
+	{
+		perror(argv[optind]);
+		return EXIT_FAILURE;
+	}
+
+	uint8_t  Record[TRACE_RECORD_SIZE];
+	uint64_t TotalRecords  = 0;
+	uint64_t Tick          = 0;
+	uint16_t LastTimestamp = 0;
+
+	while (fread(Record, TRACE_RECORD_SIZE, 1, TraceFile) == 1)
+	{
+		uint16_t Timestamp = (Record[0] | (Record[1] << 8));
+		uint16_t ByteCount = (Record[4] | (Record[5] << 8));
+
+		/* Timestamps wrap every timer period, so unwrap them assuming the timer wrapped at most once since the last record */
+		if (TotalRecords)
+		  Tick += (uint16_t)(Timestamp - LastTimestamp);
+
+		LastTimestamp = Timestamp;
+		TotalRecords++;
+
+		ProcessRecord(Tick, Record[2], Record[3], ByteCount, TickRateHz);
+	}
+
+	if (TraceFile != stdin)
+	  fclose(TraceFile);
+
+	PrintSummary(TotalRecords, Tick, TickRateHz);
+	return EXIT_SUCCESS;
+}
@@ -87,7 +87,11 @@ int main(void)
 
 	for (;;)
 	{
+		#if defined(USB_TRACE_BUFFER_SIZE)
+		SendTraceRecords();
+		#else
 		CheckJoystickMovement();
+		#endif
 
 		/* Must throw away unused bytes from the host, or it will lock up while waiting for the device */
 		CDC_Device_ReceiveByte(&VirtualSerial_CDC_Interface);
@@ -119,6 +123,18 @@ void SetupHardware(void)
 	PMIC.CTRL = PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
 #endif
 
+#if defined(USB_TRACE_BUFFER_SIZE)
+	/* Start the trace timestamp timer free-running at F_CPU/64 */
+	#if (ARCH == ARCH_AVR8)
+	TCCR1B = ((1 << CS11) | (1 << CS10));
+	#elif (ARCH == ARCH_XMEGA)
+	TCC0.CTRLA = TC_CLKSEL_DIV64_gc;
+	#endif
+
+	/* Exclude the endpoint the trace is sent through, so that sending the trace records does not refill the ring */
+	USB_Trace_IgnoreEndpoint(CDC_TX_EPADDR);
+#endif
+
 	/* Hardware Initialization */
 	Joystick_Init();
 	LEDs_Init();
@@ -157,6 +173,24 @@ void CheckJoystickMovement(void)
 	}
 }
 
+#if defined(USB_TRACE_BUFFER_SIZE)
+/** Sends any pending USB trace records to the host through the virtual COM port, once the host has opened the
+ *  port. The records are sent in their raw binary form, for processing by the host tool in the TraceDecoder
+ *  subdirectory.
+ */
+void SendTraceRecords(void)
+{
+	USB_TraceRecord_t Records[TRACE_RECORDS_PER_PACKET];
+	uint8_t           TotalRecords;
+
+	if (!(VirtualSerial_CDC_Interface.State.ControlLineStates.HostToDevice & CDC_CONTROL_LINE_OUT_DTR))
+	  return;
+
+	if ((TotalRecords = USB_Trace_Read(Records, TRACE_RECORDS_PER_PACKET)))
+	  CDC_Device_SendData(&VirtualSerial_CDC_Interface, Records, (TotalRecords * sizeof(USB_TraceRecord_t)));
+}
+#endif
+
 /** Event handler for the library USB Connection event. */
 void EVENT_USB_Device_Connect(void)
 {
@@ -64,9 +64,13 @@
 		/** LED mask for the library LED driver, to indicate that an error has occurred in the USB interface. */
 		#define LEDMASK_USB_ERROR        (LEDS_LED1 | LEDS_LED3)
 
+		/** Maximum number of USB trace records sent to the host in each transfer, when tracing is enabled. */
+		#define TRACE_RECORDS_PER_PACKET  8
+
 	/* Function Prototypes: */
 		void SetupHardware(void);
 		void CheckJoystickMovement(void);
+		void SendTraceRecords(void);
 
 		void EVENT_USB_Device_Connect(void);
 		void EVENT_USB_Device_Disconnect(void);
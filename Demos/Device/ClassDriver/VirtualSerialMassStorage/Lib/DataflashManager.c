@@ -361,8 +361,8 @@ void DataflashManager_WriteBlocks_RAM(const uint32_t BlockAddress,
 			}
 
 			/* Write one 16-byte chunk of data to the Dataflash */
-			for (uint8_t ByteNum = 0; ByteNum < 16; ByteNum++)
-			  Dataflash_SendByte(*(BufferPtr++));
+			Dataflash_SendBlock(BufferPtr, 16);
+			BufferPtr += 16;
 
 			/* Increment the Dataflash page 16 byte block counter */
 			CurrDFPageByteDiv16++;
@@ -440,8 +440,8 @@ void DataflashManager_ReadBlocks_RAM(const uint32_t BlockAddress,
 			}
 
 			/* Read one 16-byte chunk of data from the Dataflash */
-			for (uint8_t ByteNum = 0; ByteNum < 16; ByteNum++)
-			  *(BufferPtr++) = Dataflash_ReceiveByte();
+			Dataflash_ReceiveBlock(BufferPtr, 16);
+			BufferPtr += 16;
 
 			/* Increment the Dataflash page 16 byte block counter */
 			CurrDFPageByteDiv16++;
@@ -217,12 +217,14 @@ void EVENT_USB_Device_ConfigurationChanged(void)
 	LEDs_SetAllLEDs(ConfigSuccess ? LEDMASK_USB_READY : LEDMASK_USB_ERROR);
 }
 
+#if !defined(DEVICE_MAX_INTERFACES)
 /** Event handler for the library USB Control Request reception event. */
 void EVENT_USB_Device_ControlRequest(void)
 {
 	CDC_Device_ProcessControlRequest(&VirtualSerial_CDC_Interface);
 	MS_Device_ProcessControlRequest(&Disk_MS_Interface);
 }
+#endif
 
 /** CDC class driver callback function the processing of changes to the virtual
  *  control lines sent from the host..
@@ -225,8 +225,18 @@ void EVENT_USB_Host_DeviceEnumerationComplete(void)
 		return;
 	}
 
-	if (MIDI_Host_ConfigurePipes(&Keyboard_MIDI_Interface,
-	                             ConfigDescriptorSize, ConfigDescriptorData) != MIDI_ENUMERROR_NoError)
+	/* Index the descriptor once so that the class driver can search a compact table; a table that filled up still
+	 * holds the leading interfaces of the device, which will normally contain its MIDI streaming interface */
+	USB_ConfigIndex_t ConfigIndex;
+
+	if (USB_BuildConfigIndex(&ConfigIndex, ConfigDescriptorSize, ConfigDescriptorData) == CONFIG_INDEX_InvalidData)
+	{
+		puts_P(PSTR("Invalid Configuration Descriptor.\r\n"));
+		LEDs_SetAllLEDs(LEDMASK_USB_ERROR);
+		return;
+	}
+
+	if (MIDI_Host_ConfigurePipesFromIndex(&Keyboard_MIDI_Interface, &ConfigIndex) != MIDI_ENUMERROR_NoError)
 	{
 		puts_P(PSTR("Attached Device Not a Valid MIDI Class Device.\r\n"));
 		LEDs_SetAllLEDs(LEDMASK_USB_ERROR);
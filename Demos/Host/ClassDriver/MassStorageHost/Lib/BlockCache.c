@@ -0,0 +1,323 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Block cache for the attached Mass Storage device. Small reads are served from a least recently used cache of
+ *  whole blocks, with each miss fetching the following uncached blocks in the same READ(10) transfer as read-ahead,
+ *  streamed straight into the cache slots. Reads too large to benefit from the cache are transferred directly into
+ *  the caller's buffer in as few commands as possible. Writes are passed straight through to the device, updating
+ *  any cached copies of the written blocks, so the cache never holds data that has not reached the device.
+ */
+
+#define  INCLUDE_FROM_BLOCKCACHE_C
+#include "BlockCache.h"
+
+/** Performance counters of the block cache, reset by \ref BlockCache_Init(). */
+BlockCache_Stats_t BlockCache_Stats;
+
+/** Mass Storage class driver instance of the cached device, or \c NULL if the cache has not been initialized. */
+static USB_ClassInfo_MS_Host_t* CacheInterface;
+
+/** LUN index of the cached device medium. */
+static uint8_t  CacheLUN;
+
+/** Total number of blocks in the cached device medium, used to limit read-ahead. */
+static uint32_t CacheTotalBlocks;
+
+/** Cached block data, one block per slot. */
+static uint8_t  CacheData[BLOCK_CACHE_SLOTS][BLOCK_CACHE_BLOCK_SIZE];
+
+/** Device block address held in each slot. */
+static uint32_t CacheBlockAddress[BLOCK_CACHE_SLOTS];
+
+/** Flags indicating which slots hold valid data. */
+static bool     CacheIsValid[BLOCK_CACHE_SLOTS];
+
+/** Slot indexes ordered from most to least recently used. */
+static uint8_t  CacheOrder[BLOCK_CACHE_SLOTS];
+
+
+/** Initializes the block cache for the given device medium, discarding any previously cached data.
+ *
+ *  \param[in] MSInterfaceInfo  Pointer to the Mass Storage class driver instance of the attached device.
+ *  \param[in] LUNIndex         LUN index of the medium to cache.
+ *  \param[in] DiskCapacity     Capacity of the medium, as returned by \ref MS_Host_ReadDeviceCapacity().
+ *
+ *  \return Boolean \c true if the cache was initialized, \c false if the medium's block size is not supported.
+ */
+bool BlockCache_Init(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+                     const uint8_t LUNIndex,
+                     const SCSI_Capacity_t* const DiskCapacity)
+{
+	CacheInterface = NULL;
+
+	if (DiskCapacity->BlockSize != BLOCK_CACHE_BLOCK_SIZE)
+	  return false;
+
+	CacheInterface   = MSInterfaceInfo;
+	CacheLUN         = LUNIndex;
+	CacheTotalBlocks = DiskCapacity->Blocks;
+
+	memset(&BlockCache_Stats, 0x00, sizeof(BlockCache_Stats));
+	BlockCache_Invalidate();
+
+	return true;
+}
+
+/** Discards all cached blocks, so that subsequent reads are fetched from the device. */
+void BlockCache_Invalidate(void)
+{
+	for (uint8_t Slot = 0; Slot < BLOCK_CACHE_SLOTS; Slot++)
+	{
+		CacheIsValid[Slot] = false;
+		CacheOrder[Slot]   = Slot;
+	}
+}
+
+/** Reads blocks from the device medium through the cache.
+ *
+ *  \param[in]  BlockAddress  Address of the first block to read.
+ *  \param[in]  Blocks        Number of blocks to read.
+ *  \param[out] Buffer        Buffer where the read blocks should be stored.
+ *
+ *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum or \ref MS_ERROR_LOGICAL_CMD_FAILED on failure.
+ */
+uint8_t BlockCache_ReadBlocks(const uint32_t BlockAddress,
+                              const uint8_t Blocks,
+                              void* Buffer)
+{
+	uint8_t* BufferPos = (uint8_t*)Buffer;
+	uint8_t  Block     = 0;
+	uint8_t  ErrorCode;
+
+	/* Large reads would only flush the cache, so are streamed directly into the caller's buffer instead */
+	if (Blocks >= BLOCK_CACHE_SLOTS)
+	  return BlockCache_TransferDirect(BlockAddress, Blocks, BufferPos, false);
+
+	while (Block < Blocks)
+	{
+		uint32_t CurrentBlock = (BlockAddress + Block);
+		int8_t   Slot         = BlockCache_FindSlot(CurrentBlock);
+
+		if (Slot >= 0)
+		{
+			BlockCache_Stats.Hits++;
+			BlockCache_TouchSlot(Slot);
+
+			memcpy(BufferPos, CacheData[Slot], BLOCK_CACHE_BLOCK_SIZE);
+			BufferPos += BLOCK_CACHE_BLOCK_SIZE;
+			Block++;
+		}
+		else
+		{
+			uint8_t RunBlocks = 1;
+
+			/* Fetch the following uncached blocks of the request in the same transfer, continuing past its end as read-ahead */
+			while ((RunBlocks < BLOCK_CACHE_SLOTS) && ((Block + RunBlocks) < (Blocks + BLOCK_CACHE_READ_AHEAD)) &&
+			       ((CurrentBlock + RunBlocks) < CacheTotalBlocks) && (BlockCache_FindSlot(CurrentBlock + RunBlocks) < 0))
+			{
+				RunBlocks++;
+			}
+
+			if ((ErrorCode = BlockCache_Fetch(CurrentBlock, RunBlocks)) != PIPE_RWSTREAM_NoError)
+			  return ErrorCode;
+
+			uint8_t RequestedBlocks = MIN(RunBlocks, (Blocks - Block));
+
+			BlockCache_Stats.Misses          += RequestedBlocks;
+			BlockCache_Stats.ReadAheadBlocks += (RunBlocks - RequestedBlocks);
+
+			for (uint8_t RunBlock = 0; RunBlock < RequestedBlocks; RunBlock++)
+			{
+				memcpy(BufferPos, CacheData[BlockCache_FindSlot(CurrentBlock + RunBlock)], BLOCK_CACHE_BLOCK_SIZE);
+				BufferPos += BLOCK_CACHE_BLOCK_SIZE;
+			}
+
+			Block += RequestedBlocks;
+		}
+	}
+
+	return PIPE_RWSTREAM_NoError;
+}
+
+/** Writes blocks to the device medium, updating any cached copies of the written blocks.
+ *
+ *  \param[in] BlockAddress  Address of the first block to write.
+ *  \param[in] Blocks        Number of blocks to write.
+ *  \param[in] Buffer        Buffer containing the blocks to write.
+ *
+ *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum or \ref MS_ERROR_LOGICAL_CMD_FAILED on failure.
+ */
+uint8_t BlockCache_WriteBlocks(const uint32_t BlockAddress,
+                               const uint8_t Blocks,
+                               const void* Buffer)
+{
+	uint8_t ErrorCode;
+
+	if ((ErrorCode = BlockCache_TransferDirect(BlockAddress, Blocks, (uint8_t*)Buffer, true)) != PIPE_RWSTREAM_NoError)
+	{
+		/* The device may have written some of the blocks, so any cached copies can no longer be trusted */
+		BlockCache_Invalidate();
+		return ErrorCode;
+	}
+
+	for (uint8_t Block = 0; Block < Blocks; Block++)
+	{
+		int8_t Slot = BlockCache_FindSlot(BlockAddress + Block);
+
+		if (Slot >= 0)
+		  memcpy(CacheData[Slot], &((const uint8_t*)Buffer)[(uint16_t)Block * BLOCK_CACHE_BLOCK_SIZE], BLOCK_CACHE_BLOCK_SIZE);
+	}
+
+	return PIPE_RWSTREAM_NoError;
+}
+
+/** Searches the cache for the given block.
+ *
+ *  \param[in] BlockAddress  Address of the block to search for.
+ *
+ *  \return Index of the slot holding the block, or -1 if the block is not cached.
+ */
+static int8_t BlockCache_FindSlot(const uint32_t BlockAddress)
+{
+	for (uint8_t Slot = 0; Slot < BLOCK_CACHE_SLOTS; Slot++)
+	{
+		if (CacheIsValid[Slot] && (CacheBlockAddress[Slot] == BlockAddress))
+		  return Slot;
+	}
+
+	return -1;
+}
+
+/** Marks the given slot as the most recently used.
+ *
+ *  \param[in] Slot  Index of the slot to mark.
+ */
+static void BlockCache_TouchSlot(const uint8_t Slot)
+{
+	uint8_t Position = 0;
+
+	while (CacheOrder[Position] != Slot)
+	  Position++;
+
+	while (Position)
+	{
+		CacheOrder[Position] = CacheOrder[Position - 1];
+		Position--;
+	}
+
+	CacheOrder[0] = Slot;
+}
+
+/** Fetches a run of consecutive uncached blocks from the device into the least recently used slots, in a single
+ *  transfer. The first block of the run becomes the most recently used, and the last the least recently used.
+ *
+ *  \param[in] BlockAddress  Address of the first block to fetch.
+ *  \param[in] Blocks        Number of blocks to fetch, no greater than \ref BLOCK_CACHE_SLOTS.
+ *
+ *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum or \ref MS_ERROR_LOGICAL_CMD_FAILED on failure.
+ */
+static uint8_t BlockCache_Fetch(const uint32_t BlockAddress,
+                                const uint8_t Blocks)
+{
+	void*   Segments[BLOCK_CACHE_SLOTS];
+	uint8_t Slots[BLOCK_CACHE_SLOTS];
+	uint8_t ErrorCode;
+
+	/* Victim slots are invalidated before the transfer, as a failed transfer may leave them partially overwritten */
+	for (uint8_t Block = 0; Block < Blocks; Block++)
+	{
+		uint8_t Slot = CacheOrder[BLOCK_CACHE_SLOTS - 1 - Block];
+
+		CacheIsValid[Slot] = false;
+		Slots[Block]       = Slot;
+		Segments[Block]    = CacheData[Slot];
+	}
+
+	BlockCache_Stats.DeviceCommands++;
+
+	if ((ErrorCode = MS_Host_ReadDeviceBlocksScattered(CacheInterface, CacheLUN, BlockAddress, Blocks,
+	                                                   BLOCK_CACHE_BLOCK_SIZE, Segments)) != PIPE_RWSTREAM_NoError)
+	{
+		return ErrorCode;
+	}
+
+	for (int8_t Block = (Blocks - 1); Block >= 0; Block--)
+	{
+		CacheBlockAddress[Slots[Block]] = (BlockAddress + Block);
+		CacheIsValid[Slots[Block]]      = true;
+
+		BlockCache_TouchSlot(Slots[Block]);
+	}
+
+	return PIPE_RWSTREAM_NoError;
+}
+
+/** Transfers blocks directly between the device medium and the given buffer, bypassing the cache. Transfers are
+ *  split into commands of at most \ref BLOCK_CACHE_MAX_TRANSFER_BLOCKS blocks.
+ *
+ *  \param[in]     BlockAddress  Address of the first block to transfer.
+ *  \param[in]     Blocks        Number of blocks to transfer.
+ *  \param[in,out] Buffer        Buffer to transfer the blocks to or from.
+ *  \param[in]     IsWrite       Boolean \c true if the blocks should be written to the device, \c false if they should be read.
+ *
+ *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum or \ref MS_ERROR_LOGICAL_CMD_FAILED on failure.
+ */
+static uint8_t BlockCache_TransferDirect(const uint32_t BlockAddress,
+                                         const uint8_t Blocks,
+                                         uint8_t* Buffer,
+                                         const bool IsWrite)
+{
+	uint32_t CurrentBlock = BlockAddress;
+	uint8_t  BlocksRem    = Blocks;
+	uint8_t  ErrorCode;
+
+	while (BlocksRem)
+	{
+		uint8_t TransferBlocks = MIN(BlocksRem, BLOCK_CACHE_MAX_TRANSFER_BLOCKS);
+
+		BlockCache_Stats.DeviceCommands++;
+
+		if (IsWrite)
+		  ErrorCode = MS_Host_WriteDeviceBlocks(CacheInterface, CacheLUN, CurrentBlock, TransferBlocks, BLOCK_CACHE_BLOCK_SIZE, Buffer);
+		else
+		  ErrorCode = MS_Host_ReadDeviceBlocks(CacheInterface, CacheLUN, CurrentBlock, TransferBlocks, BLOCK_CACHE_BLOCK_SIZE, Buffer);
+
+		if (ErrorCode != PIPE_RWSTREAM_NoError)
+		  return ErrorCode;
+
+		CurrentBlock += TransferBlocks;
+		Buffer       += ((uint16_t)TransferBlocks * BLOCK_CACHE_BLOCK_SIZE);
+		BlocksRem    -= TransferBlocks;
+	}
+
+	return PIPE_RWSTREAM_NoError;
+}
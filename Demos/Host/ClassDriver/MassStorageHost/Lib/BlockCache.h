@@ -0,0 +1,95 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for BlockCache.c.
+ */
+
+#ifndef _BLOCK_CACHE_H_
+#define _BLOCK_CACHE_H_
+
+	/* Includes: */
+		#include <avr/io.h>
+		#include <string.h>
+
+		#include <LUFA/Drivers/USB/USB.h>
+
+	/* Macros: */
+		/** Size of each cached block in bytes. Devices with a different block size are rejected by \ref BlockCache_Init(). */
+		#define BLOCK_CACHE_BLOCK_SIZE            512
+
+		/** Number of blocks held in the cache. */
+		#define BLOCK_CACHE_SLOTS                 4
+
+		/** Maximum number of blocks past the end of a sequential read to fetch into the cache in the same transfer. */
+		#define BLOCK_CACHE_READ_AHEAD            (BLOCK_CACHE_SLOTS - 1)
+
+		/** Maximum number of blocks transferred to or from the device in a single command when the cache is bypassed. */
+		#define BLOCK_CACHE_MAX_TRANSFER_BLOCKS   64
+
+	/* Type Defines: */
+		/** Type define for the cache performance counters, reset each time the cache is initialized. */
+		typedef struct
+		{
+			uint32_t Hits; /**< Number of blocks read from the cache. */
+			uint32_t Misses; /**< Number of blocks which had to be fetched from the device. */
+			uint32_t ReadAheadBlocks; /**< Number of blocks fetched ahead of being requested. */
+			uint32_t DeviceCommands; /**< Number of read and write commands issued to the device. */
+		} BlockCache_Stats_t;
+
+	/* External Variables: */
+		extern BlockCache_Stats_t BlockCache_Stats;
+
+	/* Function Prototypes: */
+		bool    BlockCache_Init(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+		                        const uint8_t LUNIndex,
+		                        const SCSI_Capacity_t* const DiskCapacity) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
+		void    BlockCache_Invalidate(void);
+		uint8_t BlockCache_ReadBlocks(const uint32_t BlockAddress,
+		                              const uint8_t Blocks,
+		                              void* Buffer) ATTR_NON_NULL_PTR_ARG(3);
+		uint8_t BlockCache_WriteBlocks(const uint32_t BlockAddress,
+		                               const uint8_t Blocks,
+		                               const void* Buffer) ATTR_NON_NULL_PTR_ARG(3);
+
+		#if defined(INCLUDE_FROM_BLOCKCACHE_C)
+			static int8_t  BlockCache_FindSlot(const uint32_t BlockAddress);
+			static void    BlockCache_TouchSlot(const uint8_t Slot);
+			static uint8_t BlockCache_Fetch(const uint32_t BlockAddress,
+			                                const uint8_t Blocks);
+			static uint8_t BlockCache_TransferDirect(const uint32_t BlockAddress,
+			                                         const uint8_t Blocks,
+			                                         uint8_t* Buffer,
+			                                         const bool IsWrite);
+		#endif
+
+#endif
+
@@ -0,0 +1,99 @@
+/*-----------------------------------------------------------------------*/
+/* Low level disk I/O module skeleton for FatFs     (C)ChaN, 2007        */
+/*-----------------------------------------------------------------------*/
+/* This is a stub disk I/O module that acts as front end of the existing */
+/* disk I/O modules and attach it to FatFs module with common interface. */
+/*-----------------------------------------------------------------------*/
+
+#include "diskio.h"
+
+/*-----------------------------------------------------------------------*/
+/* Initialize a Drive                                                    */
+
+DSTATUS disk_initialize (
+	BYTE drv				/* Physical drive number (0..) */
+)
+{
+	return disk_status(drv);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Return Disk Status                                                    */
+
+DSTATUS disk_status (
+	BYTE drv		/* Physical drive number (0..) */
+)
+{
+	if (drv || (USB_HostState != HOST_STATE_Configured))
+	  return STA_NOINIT;
+
+	return (_FS_READONLY ? STA_PROTECT : 0);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Read Sector(s)                                                        */
+
+DRESULT disk_read (
+	BYTE drv,		/* Physical drive number (0..) */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address (LBA) */
+	BYTE count		/* Number of sectors to read (1..128) */
+)
+{
+	if (disk_status(drv) & STA_NOINIT)
+	  return RES_NOTRDY;
+
+	return (BlockCache_ReadBlocks(sector, count, buff) ? RES_ERROR : RES_OK);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Write Sector(s)                                                       */
+
+#if _FS_READONLY == 0
+DRESULT disk_write (
+	BYTE drv,			/* Physical drive number (0..) */
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address (LBA) */
+	BYTE count			/* Number of sectors to write (1..128) */
+)
+{
+	if (disk_status(drv) & STA_NOINIT)
+	  return RES_NOTRDY;
+
+	return (BlockCache_WriteBlocks(sector, count, buff) ? RES_ERROR : RES_OK);
+}
+#endif /* _FS_READONLY */
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Miscellaneous Functions                                               */
+
+DRESULT disk_ioctl (
+	BYTE drv,		/* Physical drive number (0..) */
+	BYTE ctrl,		/* Control code */
+	void *buff		/* Buffer to send/receive control data */
+)
+{
+	/* Writes are passed straight through the block cache, so there is never any data to flush */
+	if (ctrl == CTRL_SYNC)
+	  return RES_OK;
+	else
+	  return RES_PARERR;
+}
+
+#if _FS_READONLY == 0
+DWORD get_fattime (void)
+{
+	/* No real time clock is fitted, so files are stamped with a fixed date of 2017-01-01 00:00:00 */
+	return ((DWORD)(2017 - 1980) << 25) |
+	                    ((DWORD)1 << 21) |
+	                    ((DWORD)1 << 16);
+}
+#endif
@@ -47,16 +47,19 @@ USB_ClassInfo_MS_Host_t FlashDisk_MS_Interface =
 				.DataINPipe             =
 					{
 						.Address        = (PIPE_DIR_IN  | 1),
-						.Banks          = 1,
+						.Banks          = 2,
 					},
 				.DataOUTPipe            =
 					{
 						.Address        = (PIPE_DIR_OUT | 2),
-						.Banks          = 1,
+						.Banks          = 2,
 					},
 			},
 	};
 
+/** FAT Fs structure to hold the internal state of the FAT driver for the attached disk. */
+static FATFS DiskFATState;
+
 
 /** Main program entry point. This routine configures the hardware required by the application, then
  *  enters a loop to run the application tasks in sequence.
@@ -142,9 +145,17 @@ void MassStorageHost_Task(void)
 
 	printf_P(PSTR("%lu blocks of %lu bytes.\r\n"), DiskCapacity.Blocks, DiskCapacity.BlockSize);
 
-	uint8_t BlockBuffer[DiskCapacity.BlockSize];
+	if (!(BlockCache_Init(&FlashDisk_MS_Interface, 0, &DiskCapacity)))
+	{
+		puts_P(PSTR("Unsupported device block size.\r\n"));
+		LEDs_SetAllLEDs(LEDMASK_USB_ERROR);
+		USB_Host_SetDeviceConfiguration(0);
+		return;
+	}
+
+	uint8_t BlockBuffer[BLOCK_CACHE_BLOCK_SIZE];
 
-	if (MS_Host_ReadDeviceBlocks(&FlashDisk_MS_Interface, 0, 0x00000000, 1, DiskCapacity.BlockSize, BlockBuffer))
+	if (BlockCache_ReadBlocks(0x00000000, 1, BlockBuffer))
 	{
 		puts_P(PSTR("Error reading device block.\r\n"));
 		LEDs_SetAllLEDs(LEDMASK_USB_ERROR);
@@ -154,7 +165,7 @@ void MassStorageHost_Task(void)
 
 	puts_P(PSTR("\r\nContents of first block:\r\n"));
 
-	for (uint16_t Chunk = 0; Chunk < (DiskCapacity.BlockSize >> 4); Chunk++)
+	for (uint16_t Chunk = 0; Chunk < (BLOCK_CACHE_BLOCK_SIZE >> 4); Chunk++)
 	{
 		uint8_t* ChunkPtr = &BlockBuffer[Chunk << 4];
 
@@ -177,10 +188,44 @@ void MassStorageHost_Task(void)
 		printf_P(PSTR("\r\n"));
 	}
 
+	ListRootDirectory();
+
+	printf_P(PSTR("\r\nBlock cache: %lu hits, %lu misses, %lu blocks read ahead, %lu device commands.\r\n"),
+	         BlockCache_Stats.Hits, BlockCache_Stats.Misses, BlockCache_Stats.ReadAheadBlocks, BlockCache_Stats.DeviceCommands);
+
 	LEDs_SetAllLEDs(LEDMASK_USB_READY);
 	USB_Host_SetDeviceConfiguration(0);
 }
 
+/** Mounts the FAT filesystem of the attached disk through the block cache, and lists the entries in its root
+ *  directory to the serial port.
+ */
+void ListRootDirectory(void)
+{
+	DIR     RootDirectory;
+	FILINFO FileInfo;
+
+	f_mount(0, &DiskFATState);
+
+	if (f_opendir(&RootDirectory, "/") != FR_OK)
+	{
+		puts_P(PSTR("\r\nNo FAT filesystem found.\r\n"));
+		return;
+	}
+
+	puts_P(PSTR("\r\nRoot directory:\r\n"));
+
+	while ((f_readdir(&RootDirectory, &FileInfo) == FR_OK) && FileInfo.fname[0])
+	{
+		if (FileInfo.fattrib & AM_DIR)
+		  printf_P(PSTR("  %-12s      <DIR>\r\n"), FileInfo.fname);
+		else
+		  printf_P(PSTR("  %-12s %10lu\r\n"), FileInfo.fname, FileInfo.fsize);
+	}
+
+	f_mount(0, NULL);
+}
+
 /** Event handler for the USB_DeviceAttached event. This indicates that a device has been attached to the host, and
  *  starts the library USB task to begin the enumeration and USB management process.
  */
@@ -45,6 +45,9 @@
 		#include <ctype.h>
 		#include <stdio.h>
 
+		#include "Lib/BlockCache.h"
+		#include "Lib/FATFs/ff.h"
+
 		#include <LUFA/Drivers/Misc/TerminalCodes.h>
 		#include <LUFA/Drivers/Peripheral/Serial.h>
 		#include <LUFA/Drivers/Board/LEDs.h>
@@ -70,6 +73,7 @@
 	/* Function Prototypes: */
 		void SetupHardware(void);
 		void MassStorageHost_Task(void);
+		void ListRootDirectory(void);
 
 		void EVENT_USB_Host_HostError(const uint8_t ErrorCode);
 		void EVENT_USB_Host_DeviceAttached(void);
@@ -47,7 +47,7 @@ USB_ClassInfo_SI_Host_t DigitalCamera_SI_Interface =
 				.DataINPipe             =
 					{
 						.Address        = (PIPE_DIR_IN  | 1),
-						.Banks          = 1,
+						.Banks          = 2,
 					},
 				.DataOUTPipe            =
 					{
@@ -122,9 +122,11 @@ void StillImageHost_Task(void)
 		return;
 	}
 
+	RetrieveObjects();
+
 	puts_P(PSTR("Turning off Device...\r\n"));
 
-	SI_Host_SendCommand(&DigitalCamera_SI_Interface, 0x1013, 0, NULL);
+	SI_Host_SendCommand(&DigitalCamera_SI_Interface, PIMA_OPERATION_PowerDown, 0, NULL);
 	if (SI_Host_ReceiveResponse(&DigitalCamera_SI_Interface))
 	{
 		puts_P(PSTR("Could not turn off device.\r\n"));
@@ -147,6 +149,98 @@ void StillImageHost_Task(void)
 	USB_Host_SetDeviceConfiguration(0);
 }
 
+/** Lists the objects stored on the attached device, and streams the data of each object from the device through
+ *  \ref ObjectSink() to measure the sustained transfer rate.
+ */
+void RetrieveObjects(void)
+{
+	uint32_t Handles[MAX_OBJECT_HANDLES];
+	uint32_t TotalHandles;
+	uint8_t  ErrorCode;
+
+	puts_P(PSTR("Retrieving Object Handles...\r\n"));
+
+	if ((ErrorCode = SI_Host_GetObjectHandles(&DigitalCamera_SI_Interface, 0xFFFFFFFF, Handles,
+	                                          MAX_OBJECT_HANDLES, &TotalHandles)) != PIPE_RWSTREAM_NoError)
+	{
+		printf_P(PSTR(ESC_FG_RED "Could not retrieve object handles.\r\n"
+		                         " -- Error Code: %d\r\n" ESC_FG_WHITE), ErrorCode);
+		return;
+	}
+
+	printf_P(PSTR("%lu objects on device.\r\n"), TotalHandles);
+
+	for (uint8_t i = 0; i < MIN(TotalHandles, MAX_OBJECT_HANDLES); i++)
+	{
+		PIMA_ObjectInfo_t ObjectInfo;
+		char              Filename[13];
+
+		if (SI_Host_GetObjectInfo(&DigitalCamera_SI_Interface, Handles[i], &ObjectInfo,
+		                          Filename, sizeof(Filename)) != PIPE_RWSTREAM_NoError)
+		{
+			puts_P(PSTR("Could not retrieve object information.\r\n"));
+			continue;
+		}
+
+		uint32_t ObjectSize = le32_to_cpu(ObjectInfo.ObjectCompressedSize);
+
+		printf_P(PSTR(" - %-12s %10lu bytes "), Filename, ObjectSize);
+
+		/* Associations (folders) have no object data to retrieve */
+		if (le16_to_cpu(ObjectInfo.ObjectFormat) == 0x3001)
+		{
+			puts_P(PSTR("<DIR>\r\n"));
+			continue;
+		}
+
+		ObjectTransfer_t Transfer = (ObjectTransfer_t)
+			{
+				.LastFrameNumber = USB_Host_GetFrameNumber(),
+			};
+
+		if ((ErrorCode = SI_Host_ReceiveObject(&DigitalCamera_SI_Interface, Handles[i], ObjectSize,
+		                                       PARTIAL_OBJECT_CHUNK_SIZE, ObjectSink, &Transfer)) != PIPE_RWSTREAM_NoError)
+		{
+			printf_P(PSTR(ESC_FG_RED "Error %d\r\n" ESC_FG_WHITE), ErrorCode);
+			continue;
+		}
+
+		ObjectSink(&Transfer, NULL, 0);
+
+		/* One byte per millisecond is one kilobyte per second */
+		printf_P(PSTR("in %lu ms (%lu kB/s), checksum %04X\r\n"), Transfer.ElapsedMS,
+		         (Transfer.ElapsedMS ? (Transfer.TotalBytes / Transfer.ElapsedMS) : 0), Transfer.Checksum);
+	}
+}
+
+/** Data sink for the Still Image class driver, which consumes object data as it is streamed from the device. This
+ *  demo only checksums the data and tracks the transfer time, but a sink may equally write each chunk out to a file.
+ *
+ *  \param[in] Context  Pointer to the \ref ObjectTransfer_t statistics of the current object transfer.
+ *  \param[in] Data     Pointer to the received chunk of object data.
+ *  \param[in] Length   Length of the received chunk, in bytes.
+ *
+ *  \return Boolean \c true to continue the transfer.
+ */
+bool ObjectSink(void* Context,
+                const uint8_t* Data,
+                const uint16_t Length)
+{
+	ObjectTransfer_t* Transfer = (ObjectTransfer_t*)Context;
+
+	/* The 11-bit USB frame number advances once per millisecond, and the sink runs far more often than it wraps */
+	uint16_t CurrentFrameNumber = USB_Host_GetFrameNumber();
+	Transfer->ElapsedMS       += ((CurrentFrameNumber - Transfer->LastFrameNumber) & 0x07FF);
+	Transfer->LastFrameNumber  = CurrentFrameNumber;
+
+	for (uint16_t i = 0; i < Length; i++)
+	  Transfer->Checksum += Data[i];
+
+	Transfer->TotalBytes += Length;
+
+	return true;
+}
+
 /** Event handler for the USB_DeviceAttached event. This indicates that a device has been attached to the host, and
  *  starts the library USB task to begin the enumeration and USB management process.
  */
@@ -63,9 +63,29 @@
 		/** LED mask for the library LED driver, to indicate that an error has occurred in the USB interface. */
 		#define LEDMASK_USB_ERROR        (LEDS_LED1 | LEDS_LED3)
 
+		/** Maximum number of object handles retrieved from the attached device. */
+		#define MAX_OBJECT_HANDLES        16
+
+		/** Number of object bytes requested from the device in each GetPartialObject transaction. */
+		#define PARTIAL_OBJECT_CHUNK_SIZE 32768
+
+	/* Type Defines: */
+		/** Type define for the transfer statistics of an object being streamed from the attached device. */
+		typedef struct
+		{
+			uint32_t TotalBytes; /**< Number of object bytes received so far. */
+			uint32_t ElapsedMS; /**< Number of milliseconds elapsed since the transfer started. */
+			uint16_t LastFrameNumber; /**< USB frame number at the last update of the elapsed time. */
+			uint16_t Checksum; /**< Additive checksum of the received object bytes. */
+		} ObjectTransfer_t;
+
 	/* Function Prototypes: */
 		void SetupHardware(void);
 		void StillImageHost_Task(void);
+		void RetrieveObjects(void);
+		bool ObjectSink(void* Context,
+		                const uint8_t* Data,
+		                const uint16_t Length);
 
 		void EVENT_USB_Host_HostError(const uint8_t ErrorCode);
 		void EVENT_USB_Host_DeviceAttached(void);
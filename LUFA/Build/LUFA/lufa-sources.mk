@@ -14,7 +14,8 @@ DMBS_BUILD_PROVIDED_VARS   += LUFA_SRC_USB_DEVICE LUFA_SRC_USB_HOST    \
                               LUFA_SRC_USB LUFA_SRC_USBCLASS_DEVICE    \
                               LUFA_SRC_USBCLASS_HOST LUFA_SRC_USBCLASS \
                               LUFA_SRC_TEMPERATURE LUFA_SRC_SERIAL     \
-                              LUFA_SRC_TWI LUFA_SRC_PLATFORM
+                              LUFA_SRC_TWI LUFA_SRC_ADC                \
+                              LUFA_SRC_PLATFORM
 DMBS_BUILD_PROVIDED_MACROS +=
 
 SHELL = /bin/sh
@@ -37,11 +38,14 @@ LUFA_SRC_USB_COMMON      := $(LUFA_ROOT_PATH)/Drivers/USB/Core/$(ARCH)/USBContro
                             $(LUFA_ROOT_PATH)/Drivers/USB/Core/ConfigDescriptors.c               \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Core/Events.c                          \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Core/USBTask.c                         \
+                            $(LUFA_ROOT_PATH)/Drivers/USB/Core/USBTrace.c                        \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Class/Common/HIDParser.c               \
 
 LUFA_SRC_USB_HOST        := $(LUFA_ROOT_PATH)/Drivers/USB/Core/$(ARCH)/Host_$(ARCH).c            \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Core/$(ARCH)/Pipe_$(ARCH).c            \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Core/$(ARCH)/PipeStream_$(ARCH).c      \
+                            $(LUFA_ROOT_PATH)/Drivers/USB/Core/HostDevices.c                     \
+                            $(LUFA_ROOT_PATH)/Drivers/USB/Core/HostPeriodic.c                    \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Core/HostStandardReq.c                 \
                             $(LUFA_SRC_USB_COMMON)
 
@@ -63,6 +67,7 @@ LUFA_SRC_USBCLASS_HOST   := $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/AndroidAcce
                             $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/AudioClassHost.c            \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/CDCClassHost.c              \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/HIDClassHost.c              \
+                            $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/HubClassHost.c              \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/MassStorageClassHost.c      \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/MIDIClassHost.c             \
                             $(LUFA_ROOT_PATH)/Drivers/USB/Class/Host/PrinterClassHost.c          \
@@ -79,6 +84,12 @@ LUFA_SRC_SERIAL          := $(LUFA_ROOT_PATH)/Drivers/Peripheral/$(ARCH)/Serial_
 
 LUFA_SRC_TWI             := $(LUFA_ROOT_PATH)/Drivers/Peripheral/$(ARCH)/TWI_$(ARCH).c
 
+ifeq ($(ARCH), AVR8)
+   LUFA_SRC_ADC          := $(LUFA_ROOT_PATH)/Drivers/Peripheral/AVR8/ADC_AVR8.c
+else
+   LUFA_SRC_ADC          :=
+endif
+
 ifeq ($(ARCH), UC3)
    LUFA_SRC_PLATFORM     := $(LUFA_ROOT_PATH)/Platform/UC3/Exception.S   \
                             $(LUFA_ROOT_PATH)/Platform/UC3/InterruptManagement.c
@@ -92,4 +103,5 @@ LUFA_SRC_ALL_FILES   := $(LUFA_SRC_USB)            \
                         $(LUFA_SRC_TEMPERATURE)    \
                         $(LUFA_SRC_SERIAL)         \
                         $(LUFA_SRC_TWI)            \
+                        $(LUFA_SRC_ADC)            \
                         $(LUFA_SRC_PLATFORM)
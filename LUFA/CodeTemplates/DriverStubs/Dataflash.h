@@ -123,6 +123,32 @@
 				// TODO
 			}
 
+			/** Sends a block of bytes to the currently selected dataflash IC, and ignores the response bytes from the dataflash.
+			 *
+			 *  \param[in] Buffer  Pointer to the data to send to the dataflash
+			 *  \param[in] Length  Number of bytes to send
+			 */
+			static inline void Dataflash_SendBlock(const void* Buffer,
+			                                       const uint16_t Length) ATTR_ALWAYS_INLINE;
+			static inline void Dataflash_SendBlock(const void* Buffer,
+			                                       const uint16_t Length)
+			{
+				// TODO
+			}
+
+			/** Sends dummy bytes to the currently selected dataflash IC, and stores the returned block of bytes from the dataflash.
+			 *
+			 *  \param[out] Buffer  Pointer to a buffer where the data read from the dataflash is to be stored
+			 *  \param[in]  Length  Number of bytes to read
+			 */
+			static inline void Dataflash_ReceiveBlock(void* Buffer,
+			                                          const uint16_t Length) ATTR_ALWAYS_INLINE;
+			static inline void Dataflash_ReceiveBlock(void* Buffer,
+			                                          const uint16_t Length)
+			{
+				// TODO
+			}
+
 			/** Determines the currently selected dataflash chip.
 			 *
 			 *  \return Mask of the currently selected Dataflash chip, either \ref DATAFLASH_NO_CHIP if no chip is selected
@@ -65,6 +65,7 @@
 //		#define USB_DEVICE_ONLY
 //		#define USB_HOST_ONLY
 //		#define USB_STREAM_TIMEOUT_MS            {Insert Value Here}
+//		#define USB_TRACE_BUFFER_SIZE            {Insert Value Here}
 //		#define NO_LIMITED_CONTROLLER_CONNECT
 //		#define NO_SOF_EVENTS
 
@@ -78,6 +79,8 @@
 //		#define FIXED_NUM_CONFIGURATIONS         {Insert Value Here}
 //		#define CONTROL_ONLY_DEVICE
 //		#define INTERRUPT_CONTROL_ENDPOINT
+//		#define INTERRUPT_DATA_ENDPOINTS
+//		#define DEVICE_MAX_INTERFACES            {Insert Value Here}
 //		#define NO_DEVICE_REMOTE_WAKEUP
 //		#define NO_DEVICE_SELF_POWER
 
@@ -105,6 +108,7 @@
 		/* General USB Driver Related Tokens: */
 //		#define USE_STATIC_OPTIONS               {Insert Value Here}
 //		#define USB_STREAM_TIMEOUT_MS            {Insert Value Here}
+//		#define USB_TRACE_BUFFER_SIZE            {Insert Value Here}
 //		#define NO_LIMITED_CONTROLLER_CONNECT
 //		#define NO_SOF_EVENTS
 
@@ -117,6 +121,8 @@
 //		#define DEVICE_STATE_AS_GPIOR            {Insert Value Here}
 //		#define FIXED_NUM_CONFIGURATIONS         {Insert Value Here}
 //		#define CONTROL_ONLY_DEVICE
+//		#define INTERRUPT_DATA_ENDPOINTS
+//		#define DEVICE_MAX_INTERFACES            {Insert Value Here}
 // 		#define MAX_ENDPOINT_INDEX               {Insert Value Here}
 //		#define NO_DEVICE_REMOTE_WAKEUP
 //		#define NO_DEVICE_SELF_POWER
@@ -141,6 +147,7 @@
 //		#define USB_DEVICE_ONLY
 //		#define USB_HOST_ONLY
 //		#define USB_STREAM_TIMEOUT_MS            {Insert Value Here}
+//		#define USB_TRACE_BUFFER_SIZE            {Insert Value Here}
 //		#define NO_SOF_EVENTS
 
 		/* USB Device Mode Driver Related Tokens: */
@@ -149,6 +156,8 @@
 //		#define FIXED_NUM_CONFIGURATIONS         {Insert Value Here}
 //		#define CONTROL_ONLY_DEVICE
 //		#define INTERRUPT_CONTROL_ENDPOINT
+//		#define INTERRUPT_DATA_ENDPOINTS
+//		#define DEVICE_MAX_INTERFACES            {Insert Value Here}
 //		#define NO_DEVICE_REMOTE_WAKEUP
 //		#define NO_DEVICE_SELF_POWER
 
@@ -85,10 +85,23 @@
 				 *  \return Boolean \c true if the given value is known to be a compile time constant, \c false otherwise.
 				 */
 				#define GCC_IS_COMPILE_CONST(x)               __builtin_constant_p(x)
+
+				/** Checks the given constant expression at compile time, failing the build with the given message if the
+				 *  expression evaluates to \c false. This may be used both at file scope and within functions.
+				 *
+				 *  \param[in] Condition  Constant expression which must evaluate to \c true.
+				 *  \param[in] Message    String literal to display if the check fails.
+				 */
+				#if defined(__cplusplus)
+					#define GCC_STATIC_ASSERT(Condition, Message) static_assert(Condition, Message)
+				#else
+					#define GCC_STATIC_ASSERT(Condition, Message) _Static_assert(Condition, Message)
+				#endif
 			#else
 				#define GCC_FORCE_POINTER_ACCESS(StructPtr)
 				#define GCC_MEMORY_BARRIER()
 				#define GCC_IS_COMPILE_CONST(x)               0
+				#define GCC_STATIC_ASSERT(Condition, Message)
 			#endif
 
 #endif
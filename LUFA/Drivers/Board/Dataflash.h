@@ -216,6 +216,22 @@
 			 */
 			static inline uint8_t Dataflash_ReceiveByte(void) ATTR_ALWAYS_INLINE ATTR_WARN_UNUSED_RESULT;
 
+			/** Sends a block of bytes to the currently selected dataflash IC, and ignores the response bytes from the dataflash.
+			 *
+			 *  \param[in] Buffer  Pointer to the data to send to the dataflash
+			 *  \param[in] Length  Number of bytes to send
+			 */
+			static inline void Dataflash_SendBlock(const void* Buffer,
+			                                       const uint16_t Length) ATTR_ALWAYS_INLINE;
+
+			/** Sends dummy bytes to the currently selected dataflash IC, and stores the returned block of bytes from the dataflash.
+			 *
+			 *  \param[out] Buffer  Pointer to a buffer where the data read from the dataflash is to be stored
+			 *  \param[in]  Length  Number of bytes to read
+			 */
+			static inline void Dataflash_ReceiveBlock(void* Buffer,
+			                                          const uint16_t Length) ATTR_ALWAYS_INLINE;
+
 		/* Includes: */
 			#if (BOARD == BOARD_NONE)
 				#define DATAFLASH_TOTALCHIPS  0
@@ -227,6 +243,10 @@
 				static inline uint8_t Dataflash_TransferByte(const uint8_t Byte) { return 0; };
 				static inline void    Dataflash_SendByte(const uint8_t Byte) {};
 				static inline uint8_t Dataflash_ReceiveByte(void) { return 0; };
+				static inline void    Dataflash_SendBlock(const void* Buffer,
+				                                          const uint16_t Length) {};
+				static inline void    Dataflash_ReceiveBlock(void* Buffer,
+				                                             const uint16_t Length) {};
 				static inline uint8_t Dataflash_GetSelectedChip(void) { return 0; };
 				static inline void    Dataflash_SelectChip(const uint8_t ChipMask) {};
 				static inline void    Dataflash_DeselectChip(void) {};
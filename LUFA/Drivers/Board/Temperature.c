@@ -47,20 +47,55 @@ static const uint16_t PROGMEM Temperature_Lookup[TEMP_TABLE_SIZE] =
 	0x04E, 0x04C, 0x049, 0x047, 0x045, 0x043, 0x041, 0x03F, 0x03D, 0x03C, 0x03A, 0x038
 };
 
+static uint8_t Temperature_FindTableIndex(const uint16_t Reading,
+                                          const uint8_t FractionBits)
+{
+	uint8_t Lower = 0;
+	uint8_t Upper = TEMP_TABLE_SIZE;
+
+	/* Lookup table is monotonically decreasing; find the first entry that is below the reading */
+	while (Lower < Upper)
+	{
+		uint8_t Middle = ((Lower + Upper) >> 1);
+
+		if (Reading > (pgm_read_word(&Temperature_Lookup[Middle]) << FractionBits))
+		  Upper = Middle;
+		else
+		  Lower = (Middle + 1);
+	}
+
+	return Lower;
+}
+
 int8_t Temperature_GetTemperature(void)
 {
 	uint16_t Temp_ADC = ADC_GetChannelReading(ADC_REFERENCE_AVCC | ADC_RIGHT_ADJUSTED | TEMP_ADC_CHANNEL_MASK);
+	uint8_t  Index    = Temperature_FindTableIndex(Temp_ADC, 0);
 
-	if (Temp_ADC > pgm_read_word(&Temperature_Lookup[0]))
-	  return TEMP_MIN_TEMP;
+	if (Index == TEMP_TABLE_SIZE)
+	  return TEMP_MAX_TEMP;
 
-	for (uint16_t Index = 0; Index < TEMP_TABLE_SIZE; Index++)
-	{
-		if (Temp_ADC > pgm_read_word(&Temperature_Lookup[Index]))
-		  return (Index + TEMP_TABLE_OFFSET_DEGREES);
-	}
+	return (Index + TEMP_TABLE_OFFSET_DEGREES);
+}
+
+int16_t Temperature_ConvertReading(const uint16_t Reading,
+                                   const uint8_t FractionBits)
+{
+	uint8_t Index = Temperature_FindTableIndex(Reading, FractionBits);
+
+	if (!(Index))
+	  return (TEMP_MIN_TEMP * 10);
+	else if (Index == TEMP_TABLE_SIZE)
+	  return (TEMP_MAX_TEMP * 10);
+
+	uint16_t UpperReading = (pgm_read_word(&Temperature_Lookup[Index - 1]) << FractionBits);
+	uint16_t LowerReading = (pgm_read_word(&Temperature_Lookup[Index])     << FractionBits);
+	uint16_t Span         = (UpperReading - LowerReading);
+
+	/* Interpolate linearly between the two bracketing table entries, rounding to the nearest tenth of a degree */
+	uint16_t Fraction = ((((uint32_t)(UpperReading - Reading) * 10) + (Span >> 1)) / Span);
 
-	return TEMP_MAX_TEMP;
+	return ((((int16_t)Index - 1 + TEMP_TABLE_OFFSET_DEGREES) * 10) + Fraction);
 }
 
 #endif
@@ -128,6 +128,20 @@
 			 */
 			int8_t Temperature_GetTemperature(void) ATTR_WARN_UNUSED_RESULT;
 
+			/** Converts a raw or oversampled ADC reading of the temperature sensor channel into a temperature, linearly
+			 *  interpolated between the lookup table entries. This does not start a conversion itself, and so may be used
+			 *  to convert samples obtained by other means, such as from the interrupt driven ADC acquisition engine.
+			 *
+			 *  \param[in] Reading       Right adjusted ADC reading of the temperature sensor channel.
+			 *  \param[in] FractionBits  Number of extra resolution bits present in the reading, or zero for a plain 10-bit
+			 *                           reading; must not exceed \ref ADC_MAX_OVERSAMPLE_BITS.
+			 *
+			 *  \return Signed temperature value in tenths of a degree Celsius, between \ref TEMP_MIN_TEMP and
+			 *          \ref TEMP_MAX_TEMP (multiplied by ten).
+			 */
+			int16_t Temperature_ConvertReading(const uint16_t Reading,
+			                                   const uint8_t FractionBits) ATTR_WARN_UNUSED_RESULT;
+
 	/* Private Interface - For use in library only: */
 	#if !defined(__DOXYGEN__)
 		/* Macros: */
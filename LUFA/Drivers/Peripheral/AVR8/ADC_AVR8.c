@@ -0,0 +1,173 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+#include "../../../Common/Common.h"
+#if (ARCH == ARCH_AVR8) && defined(INTERRUPT_ADC_ACQUISITION)
+
+#define  __INCLUDE_FROM_ADC_C
+#include "../ADC.h"
+
+volatile uint16_t ADC_SamplesDropped;
+
+static ADC_Sample_t      ADC_SampleBuffer[ADC_ACQUISITION_BUFFER_SIZE];
+static volatile uint8_t  ADC_SampleIn;
+static volatile uint8_t  ADC_SampleOut;
+
+static uint16_t          ADC_MUXMasks[ADC_ACQUISITION_MAX_CHANNELS];
+static uint8_t           ADC_TotalChannels;
+static uint8_t           ADC_OversampleBits;
+static uint16_t          ADC_ConversionsPerSample;
+
+static uint8_t           ADC_CurrentChannel;
+static uint16_t          ADC_SampleConversions;
+static bool              ADC_DiscardResult;
+static uint32_t          ADC_Accumulator;
+static uint16_t          ADC_Timestamp;
+
+static void ADC_SelectMUXMask(const uint16_t MUXMask)
+{
+	ADMUX = MUXMask;
+
+	#if (defined(__AVR_ATmega16U4__) || defined(__AVR_ATmega32U4__))
+	if (MUXMask & (1 << 8))
+	  ADCSRB |=  (1 << MUX5);
+	else
+	  ADCSRB &= ~(1 << MUX5);
+	#endif
+}
+
+ISR(ADC_vect, ISR_BLOCK)
+{
+	uint16_t Result = ADC;
+
+	ADC_Timestamp++;
+
+	if (ADC_DiscardResult)
+	{
+		ADC_DiscardResult = false;
+		return;
+	}
+
+	ADC_Accumulator += Result;
+
+	if (++ADC_SampleConversions != ADC_ConversionsPerSample)
+	  return;
+
+	uint8_t SampleIn = ADC_SampleIn;
+
+	if ((uint8_t)(SampleIn - ADC_SampleOut) == ADC_ACQUISITION_BUFFER_SIZE)
+	{
+		ADC_SamplesDropped++;
+	}
+	else
+	{
+		ADC_Sample_t* Sample = &ADC_SampleBuffer[SampleIn & (ADC_ACQUISITION_BUFFER_SIZE - 1)];
+
+		Sample->Timestamp = ADC_Timestamp;
+		Sample->Channel   = ADC_CurrentChannel;
+		Sample->Value     = (ADC_Accumulator >> ADC_OversampleBits);
+
+		ADC_SampleIn = (SampleIn + 1);
+	}
+
+	ADC_Accumulator       = 0;
+	ADC_SampleConversions = 0;
+
+	if (ADC_TotalChannels > 1)
+	{
+		if (++ADC_CurrentChannel == ADC_TotalChannels)
+		  ADC_CurrentChannel = 0;
+
+		/* The next free running conversion has already started, and as the channel selection can only be changed safely
+		 * a full ADC clock cycle after a conversion starts, it may have been made on either channel; discard its result */
+		ADC_SelectMUXMask(ADC_MUXMasks[ADC_CurrentChannel]);
+		ADC_DiscardResult = true;
+	}
+}
+
+bool ADC_StartAcquisition(const uint16_t* MUXMasks,
+                          const uint8_t TotalChannels,
+                          const uint8_t OversampleBits)
+{
+	if (!(TotalChannels) || (TotalChannels > ADC_ACQUISITION_MAX_CHANNELS) || (OversampleBits > ADC_MAX_OVERSAMPLE_BITS))
+	  return false;
+
+	ADC_StopAcquisition();
+
+	for (uint8_t Channel = 0; Channel < TotalChannels; Channel++)
+	  ADC_MUXMasks[Channel] = MUXMasks[Channel];
+
+	ADC_TotalChannels        = TotalChannels;
+	ADC_OversampleBits       = OversampleBits;
+	ADC_ConversionsPerSample = (1 << (OversampleBits * 2));
+
+	ADC_CurrentChannel       = 0;
+	ADC_SampleConversions    = 0;
+	ADC_DiscardResult        = false;
+	ADC_Accumulator          = 0;
+	ADC_Timestamp            = 0;
+
+	ADC_SampleIn             = 0;
+	ADC_SampleOut            = 0;
+
+	ADC_SelectMUXMask(MUXMasks[0]);
+
+	ADCSRA |= ((1 << ADATE) | (1 << ADIE) | (1 << ADIF));
+	ADCSRA |= (1 << ADSC);
+
+	return true;
+}
+
+void ADC_StopAcquisition(void)
+{
+	ADCSRA &= ~((1 << ADATE) | (1 << ADIE));
+	while (ADCSRA & (1 << ADSC));
+	ADCSRA |= (1 << ADIF);
+}
+
+uint8_t ADC_SamplesAvailable(void)
+{
+	return (uint8_t)(ADC_SampleIn - ADC_SampleOut);
+}
+
+bool ADC_ReadSample(ADC_Sample_t* const Sample)
+{
+	uint8_t SampleOut = ADC_SampleOut;
+
+	if (ADC_SampleIn == SampleOut)
+	  return false;
+
+	*Sample = ADC_SampleBuffer[SampleOut & (ADC_ACQUISITION_BUFFER_SIZE - 1)];
+	ADC_SampleOut = (SampleOut + 1);
+
+	return true;
+}
+
+#endif
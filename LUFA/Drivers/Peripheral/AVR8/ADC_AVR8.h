@@ -72,6 +72,38 @@
  *      }
  *  \endcode
  *
+ *  \section Sec_ADC_AVR8_Acquisition Interrupt Driven Acquisition
+ *  When the \c INTERRUPT_ADC_ACQUISITION compile time token is defined and the \c LUFA_SRC_ADC module source is
+ *  compiled into the application, an interrupt driven acquisition engine is also available. The engine keeps the
+ *  ADC in free running mode, cycling through a list of up to \c ADC_ACQUISITION_MAX_CHANNELS channels (4 by default).
+ *  Each channel is oversampled by a factor of four per extra bit of requested resolution, and the decimated result is
+ *  timestamped and pushed into a ring of \c ADC_ACQUISITION_BUFFER_SIZE samples (32 by default, which must be a power
+ *  of two no larger than 128) for the application to read out at its leisure. When more than one channel is sampled,
+ *  the conversion in progress when the engine switches channels is discarded, as it may have been made on either channel.
+ *  The engine defines the ADC conversion complete interrupt handler, which therefore cannot be defined by the user
+ *  application.
+ *
+ *  \code
+ *      // Initialize the ADC driver and the inputs of the channels to sample
+ *      ADC_Init(ADC_FREE_RUNNING | ADC_PRESCALE_128);
+ *      ADC_SetupChannel(0);
+ *      ADC_SetupChannel(1);
+ *
+ *      // Sample both channels in turn, with 12-bit results from 16 oversampled conversions each
+ *      static const uint16_t Channels[] = {ADC_REFERENCE_AVCC | ADC_RIGHT_ADJUSTED | ADC_CHANNEL0,
+ *                                          ADC_REFERENCE_AVCC | ADC_RIGHT_ADJUSTED | ADC_CHANNEL1};
+ *      ADC_StartAcquisition(Channels, 2, 2);
+ *      GlobalInterruptEnable();
+ *
+ *      for (;;)
+ *      {
+ *           ADC_Sample_t Sample;
+ *
+ *           while (ADC_ReadSample(&Sample))
+ *             printf("Channel %d at %u: %u\r\n", Sample.Channel, Sample.Timestamp, Sample.Value);
+ *      }
+ *  \endcode
+ *
  *  @{
  */
 
@@ -435,6 +467,95 @@
 				return ((ADCSRA & (1 << ADEN)) ? true : false);
 			}
 
+		#if defined(INTERRUPT_ADC_ACQUISITION) || defined(__DOXYGEN__)
+		/* Macros: */
+			/** Maximum number of extra bits of resolution that can be requested from \ref ADC_StartAcquisition(), each
+			 *  requiring four times as many conversions per sample.
+			 */
+			#define ADC_MAX_OVERSAMPLE_BITS         6
+
+		/* Type Defines: */
+			/** Type define for a decimated sample produced by the interrupt driven ADC acquisition engine.
+			 *
+			 *  \note Only available when the \c INTERRUPT_ADC_ACQUISITION compile time token is defined.
+			 */
+			typedef struct
+			{
+				uint16_t Timestamp; /**< Time at which the last conversion of the sample completed, measured in ADC conversion
+				                     *   periods (13 ADC clock cycles) since the acquisition was started, wrapping on overflow.
+				                     */
+				uint8_t  Channel; /**< Index of the sampled channel within the channel list given to \ref ADC_StartAcquisition(). */
+				uint16_t Value; /**< Decimated sample value, right adjusted with (10 + \c OversampleBits) bits of resolution. */
+			} ADC_Sample_t;
+
+		/* External Variables: */
+			/** Number of completed samples discarded by the acquisition engine because the sample buffer was full. This
+			 *  may be cleared by the application at any time.
+			 *
+			 *  \note Only available when the \c INTERRUPT_ADC_ACQUISITION compile time token is defined.
+			 */
+			extern volatile uint16_t ADC_SamplesDropped;
+
+		/* Function Prototypes: */
+			/** Starts the interrupt driven acquisition engine, which continuously samples the given list of channels in turn
+			 *  from the ADC conversion complete interrupt. Each channel is converted <tt>4^OversampleBits</tt> times in a row,
+			 *  with the sum of the conversions decimated into a single sample with \c OversampleBits extra bits of resolution.
+			 *  Any acquisition already in progress is stopped and its buffered samples discarded.
+			 *
+			 *  \pre The ADC must first be enabled via \ref ADC_Init(), and each channel's input set up via \ref ADC_SetupChannel().
+			 *
+			 *  \note All channels should use the same ADC reference, as the reference is not given time to settle when the
+			 *        engine switches between channels.
+			 *
+			 *  \param[in] MUXMasks        Pointer to an array of ADC MUX masks, each comprising an ADC channel mask, reference mask
+			 *                             and the \ref ADC_RIGHT_ADJUSTED adjustment mask.
+			 *  \param[in] TotalChannels   Number of channels in the MUX mask array, between 1 and \c ADC_ACQUISITION_MAX_CHANNELS.
+			 *  \param[in] OversampleBits  Number of extra bits of resolution to produce, up to \ref ADC_MAX_OVERSAMPLE_BITS.
+			 *
+			 *  \return Boolean \c true if the acquisition was started, \c false if the given parameters were invalid.
+			 */
+			bool ADC_StartAcquisition(const uint16_t* MUXMasks,
+			                          const uint8_t TotalChannels,
+			                          const uint8_t OversampleBits) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Stops the interrupt driven acquisition engine, leaving the ADC enabled but idle. Samples already in the sample
+			 *  buffer may still be read out via \ref ADC_ReadSample().
+			 */
+			void ADC_StopAcquisition(void);
+
+			/** Retrieves the number of samples waiting in the acquisition engine's sample buffer.
+			 *
+			 *  \return Number of samples which can be read via \ref ADC_ReadSample().
+			 */
+			uint8_t ADC_SamplesAvailable(void) ATTR_WARN_UNUSED_RESULT;
+
+			/** Removes the oldest sample from the acquisition engine's sample buffer.
+			 *
+			 *  \param[out] Sample  Pointer to a location where the sample is to be stored.
+			 *
+			 *  \return Boolean \c true if a sample was read, \c false if the sample buffer was empty.
+			 */
+			bool ADC_ReadSample(ADC_Sample_t* const Sample) ATTR_NON_NULL_PTR_ARG(1);
+		#endif
+
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Macros: */
+			#if defined(INTERRUPT_ADC_ACQUISITION)
+				#if !defined(ADC_ACQUISITION_MAX_CHANNELS)
+					#define ADC_ACQUISITION_MAX_CHANNELS    4
+				#endif
+
+				#if !defined(ADC_ACQUISITION_BUFFER_SIZE)
+					#define ADC_ACQUISITION_BUFFER_SIZE     32
+				#endif
+
+				#if ((ADC_ACQUISITION_BUFFER_SIZE > 128) || (ADC_ACQUISITION_BUFFER_SIZE & (ADC_ACQUISITION_BUFFER_SIZE - 1)))
+					#error ADC_ACQUISITION_BUFFER_SIZE must be a power of two no larger than 128.
+				#endif
+			#endif
+	#endif
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
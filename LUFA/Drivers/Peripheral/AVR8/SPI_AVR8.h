@@ -69,6 +69,12 @@
  *
  *      // Send a byte, and store the received byte from the same transaction
  *      uint8_t ResponseByte = SPI_TransferByte(0xDC);
+ *
+ *      // Send and then receive a block of bytes
+ *      uint8_t Command[4] = {0x01, 0x02, 0x03, 0x04};
+ *      uint8_t Response[16];
+ *      SPI_SendBlock(Command, sizeof(Command));
+ *      SPI_ReceiveBlock(Response, sizeof(Response));
  *  \endcode
  *
  *  @{
@@ -247,6 +253,106 @@
 				return SPDR;
 			}
 
+			/** Sends a block of bytes through the SPI interface, blocking until the transfer is complete. Each byte is
+			 *  fetched from the buffer while the previous byte is being shifted out, so that consecutive bytes are sent
+			 *  with minimal delay between them. The response bytes from the attached SPI device are ignored.
+			 *
+			 *  \param[in] Buffer  Pointer to the source data buffer.
+			 *  \param[in] Length  Number of bytes to send through the SPI interface.
+			 */
+			static inline void SPI_SendBlock(const void* Buffer,
+			                                 uint16_t Length) ATTR_NON_NULL_PTR_ARG(1);
+			static inline void SPI_SendBlock(const void* Buffer,
+			                                 uint16_t Length)
+			{
+				const uint8_t* DataIn = (const uint8_t*)Buffer;
+
+				if (!(Length))
+				  return;
+
+				SPDR = *(DataIn++);
+
+				while (--Length)
+				{
+					uint8_t NextByte = *(DataIn++);
+
+					while (!(SPSR & (1 << SPIF)));
+					SPDR = NextByte;
+				}
+
+				while (!(SPSR & (1 << SPIF)));
+			}
+
+			/** Receives a block of bytes through the SPI interface, sending a dummy 0x00 byte for each and blocking
+			 *  until the transfer is complete. Each transfer is started immediately after the previous response byte
+			 *  is read out, before it is stored to the buffer.
+			 *
+			 *  \param[out] Buffer  Pointer to the destination data buffer.
+			 *  \param[in]  Length  Number of bytes to receive through the SPI interface.
+			 */
+			static inline void SPI_ReceiveBlock(void* Buffer,
+			                                    uint16_t Length) ATTR_NON_NULL_PTR_ARG(1);
+			static inline void SPI_ReceiveBlock(void* Buffer,
+			                                    uint16_t Length)
+			{
+				uint8_t* DataOut = (uint8_t*)Buffer;
+
+				if (!(Length))
+				  return;
+
+				SPDR = 0x00;
+
+				while (--Length)
+				{
+					while (!(SPSR & (1 << SPIF)));
+
+					uint8_t ReceivedByte = SPDR;
+					SPDR = 0x00;
+					*(DataOut++) = ReceivedByte;
+				}
+
+				while (!(SPSR & (1 << SPIF)));
+				*DataOut = SPDR;
+			}
+
+			/** Sends and receives a block of bytes through the SPI interface, blocking until the transfer is complete.
+			 *  The source and destination buffers may be the same buffer, in which case the sent data is replaced
+			 *  with the response data.
+			 *
+			 *  \param[in]  TxBuffer  Pointer to the source data buffer.
+			 *  \param[out] RxBuffer  Pointer to the destination buffer for the response bytes from the attached SPI device.
+			 *  \param[in]  Length    Number of bytes to transfer through the SPI interface.
+			 */
+			static inline void SPI_TransferBlock(const void* TxBuffer,
+			                                     void* RxBuffer,
+			                                     uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+			static inline void SPI_TransferBlock(const void* TxBuffer,
+			                                     void* RxBuffer,
+			                                     uint16_t Length)
+			{
+				const uint8_t* DataIn  = (const uint8_t*)TxBuffer;
+				uint8_t*       DataOut = (uint8_t*)RxBuffer;
+
+				if (!(Length))
+				  return;
+
+				SPDR = *(DataIn++);
+
+				while (--Length)
+				{
+					uint8_t NextByte = *(DataIn++);
+
+					while (!(SPSR & (1 << SPIF)));
+
+					uint8_t ReceivedByte = SPDR;
+					SPDR = NextByte;
+					*(DataOut++) = ReceivedByte;
+				}
+
+				while (!(SPSR & (1 << SPIF)));
+				*DataOut = SPDR;
+			}
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
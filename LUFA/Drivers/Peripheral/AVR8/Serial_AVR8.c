@@ -36,6 +36,161 @@
 
 FILE USARTSerialStream;
 
+#if defined(INTERRUPT_SERIAL_BUFFERS)
+volatile Serial_ErrorCounters_t Serial_ErrorCounters;
+
+static uint8_t          Serial_RxBuffer[SERIAL_RX_BUFFER_SIZE];
+static uint8_t          Serial_TxBuffer[SERIAL_TX_BUFFER_SIZE];
+
+/* Free running buffer indexes; each is only written by one side (the ISR or the application), and the
+ * buffer sizes are limited so that the difference between a buffer's indexes is always its fill count.
+ */
+static volatile uint8_t Serial_RxIn;
+static volatile uint8_t Serial_RxOut;
+static volatile uint8_t Serial_TxIn;
+static volatile uint8_t Serial_TxOut;
+
+ISR(USART1_RX_vect, ISR_BLOCK)
+{
+	uint8_t Status       = UCSR1A;
+	uint8_t ReceivedByte = UDR1;
+
+	if (Status & (1 << DOR1))
+	  Serial_ErrorCounters.DataOverruns++;
+
+	if (Status & (1 << FE1))
+	{
+		Serial_ErrorCounters.FramingErrors++;
+		return;
+	}
+
+	if ((uint8_t)(Serial_RxIn - Serial_RxOut) == SERIAL_RX_BUFFER_SIZE)
+	{
+		Serial_ErrorCounters.BufferOverruns++;
+		return;
+	}
+
+	Serial_RxBuffer[Serial_RxIn & (SERIAL_RX_BUFFER_SIZE - 1)] = ReceivedByte;
+	Serial_RxIn++;
+}
+
+ISR(USART1_UDRE_vect, ISR_BLOCK)
+{
+	uint8_t TxOut = Serial_TxOut;
+
+	if (Serial_TxIn == TxOut)
+	{
+		UCSR1B &= ~(1 << UDRIE1);
+		return;
+	}
+
+	/* Clear any stale transmit complete flag, so that it only indicates the end of the buffered transmission */
+	UCSR1A = ((UCSR1A & ((1 << U2X1) | (1 << MPCM1))) | (1 << TXC1));
+
+	UDR1 = Serial_TxBuffer[TxOut & (SERIAL_TX_BUFFER_SIZE - 1)];
+	Serial_TxOut = (TxOut + 1);
+}
+
+bool Serial_IsCharReceived(void)
+{
+	return (Serial_RxIn != Serial_RxOut);
+}
+
+bool Serial_IsSendReady(void)
+{
+	return ((uint8_t)(Serial_TxIn - Serial_TxOut) != SERIAL_TX_BUFFER_SIZE);
+}
+
+bool Serial_IsSendComplete(void)
+{
+	return ((Serial_TxIn == Serial_TxOut) && (UCSR1A & (1 << TXC1)));
+}
+
+void Serial_SendByte(const char DataByte)
+{
+	uint8_t TxIn = Serial_TxIn;
+
+	while (!(Serial_IsSendReady()));
+
+	Serial_TxBuffer[TxIn & (SERIAL_TX_BUFFER_SIZE - 1)] = DataByte;
+	Serial_TxIn = (TxIn + 1);
+
+	UCSR1B |= (1 << UDRIE1);
+}
+
+int16_t Serial_ReceiveByte(void)
+{
+	uint8_t RxOut = Serial_RxOut;
+
+	if (Serial_RxIn == RxOut)
+	  return -1;
+
+	uint8_t ReceivedByte = Serial_RxBuffer[RxOut & (SERIAL_RX_BUFFER_SIZE - 1)];
+	Serial_RxOut = (RxOut + 1);
+
+	return ReceivedByte;
+}
+
+uint16_t Serial_BytesReceived(void)
+{
+	return (uint8_t)(Serial_RxIn - Serial_RxOut);
+}
+
+uint16_t Serial_SendBufferSpace(void)
+{
+	return (SERIAL_TX_BUFFER_SIZE - (uint8_t)(Serial_TxIn - Serial_TxOut));
+}
+
+uint16_t Serial_ReadData(void* Buffer,
+                         uint16_t Length)
+{
+	uint8_t* DataOut   = (uint8_t*)Buffer;
+	uint8_t  RxOut     = Serial_RxOut;
+	uint16_t BytesRead = 0;
+
+	while (Length-- && (Serial_RxIn != RxOut))
+	{
+		*(DataOut++) = Serial_RxBuffer[RxOut & (SERIAL_RX_BUFFER_SIZE - 1)];
+		Serial_RxOut = ++RxOut;
+		BytesRead++;
+	}
+
+	return BytesRead;
+}
+
+uint16_t Serial_WriteData(const void* Buffer,
+                          uint16_t Length)
+{
+	const uint8_t* DataIn      = (const uint8_t*)Buffer;
+	uint8_t        TxIn        = Serial_TxIn;
+	uint16_t       BytesQueued = 0;
+
+	while (Length-- && ((uint8_t)(TxIn - Serial_TxOut) != SERIAL_TX_BUFFER_SIZE))
+	{
+		Serial_TxBuffer[TxIn & (SERIAL_TX_BUFFER_SIZE - 1)] = *(DataIn++);
+		Serial_TxIn = ++TxIn;
+		BytesQueued++;
+	}
+
+	if (BytesQueued)
+	  UCSR1B |= (1 << UDRIE1);
+
+	return BytesQueued;
+}
+
+int Serial_putchar_NonBlocking(char DataByte,
+                               FILE *Stream)
+{
+	(void)Stream;
+
+	if (!(Serial_IsSendReady()))
+	  return _FDEV_ERR;
+
+	Serial_SendByte(DataByte);
+	return 0;
+}
+#endif
+
 int Serial_putchar(char DataByte,
                    FILE *Stream)
 {
@@ -103,7 +258,11 @@ void Serial_CreateStream(FILE* Stream)
 		stdout = Stream;
 	}
 
+	#if defined(INTERRUPT_SERIAL_BUFFERS)
+	*Stream = (FILE)FDEV_SETUP_STREAM(Serial_putchar_NonBlocking, Serial_getchar, _FDEV_SETUP_RW);
+	#else
 	*Stream = (FILE)FDEV_SETUP_STREAM(Serial_putchar, Serial_getchar, _FDEV_SETUP_RW);
+	#endif
 }
 
 void Serial_CreateBlockingStream(FILE* Stream)
@@ -43,6 +43,15 @@
  *  \section Sec_Serial_AVR8_ModDescription Module Description
  *  On-chip serial USART driver for the 8-bit AVR microcontrollers.
  *
+ *  By default the driver busy-waits on the USART hardware for each transmitted byte, and received bytes must be polled
+ *  from the hardware before the next byte arrives. When the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined,
+ *  the driver instead transmits and receives through interrupt driven ring buffers of \c SERIAL_TX_BUFFER_SIZE and
+ *  \c SERIAL_RX_BUFFER_SIZE bytes (64 bytes each by default, which must be powers of two no larger than 128), so that
+ *  transmissions only block while the transmit buffer is full and no received data is lost while the application is
+ *  busy elsewhere. The additional block transfer functions and error counters of this mode are then available. The
+ *  driver defines the USART receive and data register empty interrupt handlers in this mode, which therefore cannot be
+ *  defined by the user application.
+ *
  *  \note This file should not be included directly. It is automatically included as needed by the USART driver
  *        dispatch header located in LUFA/Drivers/Peripheral/Serial.h.
  *
@@ -64,6 +73,20 @@
  *      int16_t DataByte = Serial_ReceiveByte();
  *  \endcode
  *
+ *  <b>Interrupt Driven Buffers Example:</b>
+ *  \code
+ *      // Initialize the serial USART driver before first use, with 115200 baud in double-speed mode
+ *      Serial_Init(115200, true);
+ *      GlobalInterruptEnable();
+ *
+ *      // Queue as much of a block as currently fits in the transmit buffer, without blocking
+ *      uint16_t BytesQueued = Serial_WriteData(Block, sizeof(Block));
+ *
+ *      // Read out up to 16 bytes of received data, without blocking
+ *      uint8_t  Received[16];
+ *      uint16_t BytesRead = Serial_ReadData(Received, sizeof(Received));
+ *  \endcode
+ *
  *  @{
  */
 
@@ -96,6 +119,28 @@
 			                   FILE *Stream);
 			int Serial_getchar(FILE *Stream);
 			int Serial_getchar_Blocking(FILE *Stream);
+
+			#if defined(INTERRUPT_SERIAL_BUFFERS)
+				int Serial_putchar_NonBlocking(char DataByte,
+				                               FILE *Stream);
+			#endif
+
+		/* Macros: */
+			#if defined(INTERRUPT_SERIAL_BUFFERS)
+				#if !defined(SERIAL_RX_BUFFER_SIZE)
+					#define SERIAL_RX_BUFFER_SIZE   64
+				#endif
+
+				#if !defined(SERIAL_TX_BUFFER_SIZE)
+					#define SERIAL_TX_BUFFER_SIZE   64
+				#endif
+
+				#if ((SERIAL_RX_BUFFER_SIZE > 128) || (SERIAL_RX_BUFFER_SIZE & (SERIAL_RX_BUFFER_SIZE - 1)))
+					#error SERIAL_RX_BUFFER_SIZE must be a power of two no larger than 128.
+				#elif ((SERIAL_TX_BUFFER_SIZE > 128) || (SERIAL_TX_BUFFER_SIZE & (SERIAL_TX_BUFFER_SIZE - 1)))
+					#error SERIAL_TX_BUFFER_SIZE must be a power of two no larger than 128.
+				#endif
+			#endif
 	#endif
 
 	/* Public Interface - May be used in end-application: */
@@ -118,6 +163,72 @@
 			 */
 			#define SERIAL_2X_UBBRVAL(Baud) ((((F_CPU / 8) + (Baud / 2)) / (Baud)) - 1)
 
+		#if defined(INTERRUPT_SERIAL_BUFFERS) || defined(__DOXYGEN__)
+		/* Type Defines: */
+			/** Type define for the USART reception error counters, maintained by the driver's receive interrupt.
+			 *
+			 *  \note Only available when the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined.
+			 */
+			typedef struct
+			{
+				uint16_t BufferOverruns; /**< Number of received bytes discarded because the receive buffer was full. */
+				uint16_t DataOverruns; /**< Number of times the USART hardware lost received data because the receive
+				                        *   interrupt was not serviced in time.
+				                        */
+				uint16_t FramingErrors; /**< Number of received bytes discarded due to an invalid stop bit. */
+			} Serial_ErrorCounters_t;
+
+		/* External Variables: */
+			/** USART reception error counters, incremented by the driver's receive interrupt. These may be cleared by the
+			 *  application at any time.
+			 *
+			 *  \note Only available when the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined.
+			 */
+			extern volatile Serial_ErrorCounters_t Serial_ErrorCounters;
+
+		/* Function Prototypes: */
+			/** Retrieves the number of received bytes waiting in the receive buffer.
+			 *
+			 *  \note Only available when the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined.
+			 *
+			 *  \return Number of bytes which can be read without blocking.
+			 */
+			uint16_t Serial_BytesReceived(void) ATTR_WARN_UNUSED_RESULT;
+
+			/** Retrieves the amount of free space in the transmit buffer.
+			 *
+			 *  \note Only available when the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined.
+			 *
+			 *  \return Number of bytes which can be sent without blocking.
+			 */
+			uint16_t Serial_SendBufferSpace(void) ATTR_WARN_UNUSED_RESULT;
+
+			/** Reads up to the given number of bytes from the receive buffer, without blocking.
+			 *
+			 *  \note Only available when the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined.
+			 *
+			 *  \param[out] Buffer  Pointer to a buffer where the received data is to be stored.
+			 *  \param[in]  Length  Maximum number of bytes to read.
+			 *
+			 *  \return Number of bytes read into the buffer.
+			 */
+			uint16_t Serial_ReadData(void* Buffer,
+			                         uint16_t Length) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Queues up to the given number of bytes into the transmit buffer for transmission, without blocking.
+			 *
+			 *  \note Only available when the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined.
+			 *
+			 *  \param[in] Buffer  Pointer to a buffer containing the data to send.
+			 *  \param[in] Length  Length of the data to send, in bytes.
+			 *
+			 *  \return Number of bytes queued for transmission, which may be less than \c Length if the transmit buffer
+			 *          became full.
+			 */
+			uint16_t Serial_WriteData(const void* Buffer,
+			                          uint16_t Length) ATTR_NON_NULL_PTR_ARG(1);
+		#endif
+
 		/* Function Prototypes: */
 			/** Transmits a given NUL terminated string located in program space (FLASH) through the USART.
 			 *
@@ -147,6 +258,9 @@
 			 *  be used when the read data is processed byte-per-bye (via \c getc()) or when the user application will implement its own
 			 *  line buffering.
 			 *
+			 *  When the \c INTERRUPT_SERIAL_BUFFERS compile time token is defined, writing to this stream is also non-blocking;
+			 *  characters written while the transmit buffer is full are discarded, and the stream's error flag is set.
+			 *
 			 *  \param[in,out] Stream  Pointer to a FILE structure where the created stream should be placed, if \c NULL, \c stdout
 			 *                         and \c stdin will be configured to use the USART.
 			 *
@@ -181,7 +295,11 @@
 
 				UCSR1C = ((1 << UCSZ11) | (1 << UCSZ10));
 				UCSR1A = (DoubleSpeed ? (1 << U2X1) : 0);
+				#if defined(INTERRUPT_SERIAL_BUFFERS)
+				UCSR1B = ((1 << RXCIE1) | (1 << TXEN1) | (1 << RXEN1));
+				#else
 				UCSR1B = ((1 << TXEN1)  | (1 << RXEN1));
+				#endif
 
 				DDRD  |= (1 << 3);
 				PORTD |= (1 << 2);
@@ -201,6 +319,7 @@
 				PORTD &= ~(1 << 2);
 			}
 
+			#if !defined(INTERRUPT_SERIAL_BUFFERS) || defined(__DOXYGEN__)
 			/** Indicates whether a character has been received through the USART.
 			 *
 			 *  \return Boolean \c true if a character has been received, \c false otherwise.
@@ -259,6 +378,13 @@
 
 				return UDR1;
 			}
+			#else
+			bool    Serial_IsCharReceived(void) ATTR_WARN_UNUSED_RESULT;
+			bool    Serial_IsSendReady(void) ATTR_WARN_UNUSED_RESULT;
+			bool    Serial_IsSendComplete(void) ATTR_WARN_UNUSED_RESULT;
+			void    Serial_SendByte(const char DataByte);
+			int16_t Serial_ReceiveByte(void);
+			#endif
 
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
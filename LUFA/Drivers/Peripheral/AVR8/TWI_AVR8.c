@@ -206,4 +206,183 @@ uint8_t TWI_WritePacket(const uint8_t SlaveAddress,
 	return ErrorCode;
 }
 
+#if defined(INTERRUPT_TWI_TRANSACTIONS)
+static TWI_Transaction_t* volatile TWI_QueueHead;
+static TWI_Transaction_t* volatile TWI_QueueTail;
+static TWI_Transaction_t* volatile TWI_CompletedHead;
+static TWI_Transaction_t* volatile TWI_CompletedTail;
+
+static uint8_t* TWI_DataPointer;
+static uint16_t TWI_DataBytesRemaining;
+static uint8_t  TWI_AddressBytesRemaining;
+
+bool TWI_QueueTransaction(TWI_Transaction_t* const Transaction)
+{
+	if ((Transaction->SlaveAddress & TWI_ADDRESS_READ) && !(Transaction->Length))
+	  return false;
+
+	if (Transaction->InternalAddressLen > 2)
+	  return false;
+
+	Transaction->Status          = TWI_TRANSACTION_PENDING;
+	Transaction->NextTransaction = NULL;
+
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	if (TWI_QueueHead)
+	{
+		TWI_QueueTail->NextTransaction = Transaction;
+		TWI_QueueTail = Transaction;
+	}
+	else
+	{
+		TWI_QueueHead = Transaction;
+		TWI_QueueTail = Transaction;
+
+		/* Queue was idle, start the new transaction by capturing the bus once any previous STOP has been sent */
+		while (TWCR & (1 << TWSTO));
+		TWCR = ((1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE));
+	}
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	return true;
+}
+
+void TWI_TransactionTask(void)
+{
+	for (;;)
+	{
+		uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+		GlobalInterruptDisable();
+
+		TWI_Transaction_t* Transaction = TWI_CompletedHead;
+
+		if (Transaction)
+		  TWI_CompletedHead = Transaction->NextTransaction;
+
+		SetGlobalInterruptMask(CurrentGlobalInt);
+
+		if (!(Transaction))
+		  break;
+
+		Transaction->NextTransaction = NULL;
+		Transaction->Callback(Transaction);
+	}
+}
+
+bool TWI_IsTransactionQueueIdle(void)
+{
+	return (TWI_QueueHead == NULL);
+}
+
+static void TWI_CompleteTransaction(const uint8_t Status)
+{
+	TWI_Transaction_t* const Transaction = TWI_QueueHead;
+
+	TWI_QueueHead = Transaction->NextTransaction;
+
+	/* Release the bus, immediately followed by a new START condition if further transactions are queued */
+	if (TWI_QueueHead)
+	  TWCR = ((1 << TWINT) | (1 << TWSTO) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE));
+	else
+	  TWCR = ((1 << TWINT) | (1 << TWSTO) | (1 << TWEN));
+
+	Transaction->NextTransaction = NULL;
+	Transaction->Status          = Status;
+
+	/* Pass transactions with a completion callback to the main program loop */
+	if (Transaction->Callback)
+	{
+		if (TWI_CompletedHead)
+		  TWI_CompletedTail->NextTransaction = Transaction;
+		else
+		  TWI_CompletedHead = Transaction;
+
+		TWI_CompletedTail = Transaction;
+	}
+}
+
+ISR(TWI_vect, ISR_BLOCK)
+{
+	TWI_Transaction_t* const Transaction = TWI_QueueHead;
+	uint8_t                  TWCRMask    = ((1 << TWINT) | (1 << TWEN) | (1 << TWIE));
+
+	switch (TWSR & TW_STATUS_MASK)
+	{
+		case TW_START:
+			/* Bus captured for a new (or restarted) transaction, address the slave for writing if an internal address
+			 * must be sent first, otherwise address it in the direction of the data transfer */
+			TWI_AddressBytesRemaining = Transaction->InternalAddressLen;
+			TWI_DataPointer           = Transaction->Buffer;
+			TWI_DataBytesRemaining    = Transaction->Length;
+
+			if (TWI_AddressBytesRemaining)
+			  TWDR = ((Transaction->SlaveAddress & TWI_DEVICE_ADDRESS_MASK) | TWI_ADDRESS_WRITE);
+			else
+			  TWDR = Transaction->SlaveAddress;
+
+			break;
+		case TW_REP_START:
+			/* Internal address sent, address the slave for reading the data */
+			TWDR = ((Transaction->SlaveAddress & TWI_DEVICE_ADDRESS_MASK) | TWI_ADDRESS_READ);
+			break;
+		case TW_MT_SLA_ACK:
+		case TW_MT_DATA_ACK:
+			if (TWI_AddressBytesRemaining)
+			{
+				TWI_AddressBytesRemaining--;
+				TWDR = (TWI_AddressBytesRemaining ? (Transaction->InternalAddress >> 8) : Transaction->InternalAddress);
+			}
+			else if (Transaction->SlaveAddress & TWI_ADDRESS_READ)
+			{
+				TWCRMask |= (1 << TWSTA);
+			}
+			else if (TWI_DataBytesRemaining)
+			{
+				TWI_DataBytesRemaining--;
+				TWDR = *(TWI_DataPointer++);
+			}
+			else
+			{
+				TWI_CompleteTransaction(TWI_ERROR_NoError);
+				return;
+			}
+
+			break;
+		case TW_MR_DATA_ACK:
+			*(TWI_DataPointer++) = TWDR;
+			TWI_DataBytesRemaining--;
+			/* Fall through */
+		case TW_MR_SLA_ACK:
+			/* ACK each received byte except for the last, which is NAKed to end the read */
+			if (TWI_DataBytesRemaining > 1)
+			  TWCRMask |= (1 << TWEA);
+
+			break;
+		case TW_MR_DATA_NACK:
+			*(TWI_DataPointer++) = TWDR;
+			TWI_CompleteTransaction(TWI_ERROR_NoError);
+			return;
+		case TW_MT_ARB_LOST:
+			/* Another bus master won arbitration, restart the transaction once the bus is free */
+			TWCRMask |= (1 << TWSTA);
+			break;
+		case TW_MT_SLA_NACK:
+		case TW_MR_SLA_NACK:
+			TWI_CompleteTransaction(TWI_ERROR_SlaveNotReady);
+			return;
+		case TW_MT_DATA_NACK:
+			TWI_CompleteTransaction(TWI_ERROR_SlaveNAK);
+			return;
+		default:
+			TWI_CompleteTransaction(TWI_ERROR_BusFault);
+			return;
+	}
+
+	TWCR = TWCRMask;
+}
+#endif
+
 #endif
@@ -43,6 +43,12 @@
  *  \section Sec_TWI_AVR8_ModDescription Module Description
  *  Master mode TWI driver for the 8-bit AVR microcontrollers which contain a hardware TWI module.
  *
+ *  The standard driver functions busy-wait on the TWI hardware for each transferred byte. When the
+ *  \c INTERRUPT_TWI_TRANSACTIONS compile time token is defined, an additional interrupt driven transaction
+ *  engine is enabled; complete register read and write transactions are queued via \ref TWI_QueueTransaction()
+ *  and performed by the TWI interrupt, without blocking the main program loop. The blocking driver functions must
+ *  not be used while queued transactions are pending.
+ *
  *  \note This file should not be included directly. It is automatically included as needed by the TWI driver
  *        dispatch header located in LUFA/Drivers/Peripheral/TWI.h.
  *
@@ -109,6 +115,42 @@
  *                     &ReadPacket, sizeof(ReadPacket);
  *  \endcode
  *
+ *  <b>Interrupt Driven Transaction API Example:</b>
+ *  \code
+ *      static uint8_t           SensorData[6];
+ *      static TWI_Transaction_t SensorRead =
+ *          {
+ *              .SlaveAddress       = (0x3C | TWI_ADDRESS_READ),
+ *              .InternalAddressLen = 1,
+ *              .InternalAddress    = 0x03,
+ *              .Buffer             = SensorData,
+ *              .Length             = sizeof(SensorData),
+ *              .Callback           = SensorRead_Complete,
+ *          };
+ *
+ *      // Called from TWI_TransactionTask() in the main loop once the sensor read has completed
+ *      void SensorRead_Complete(TWI_Transaction_t* const Transaction)
+ *      {
+ *          if (Transaction->Status == TWI_ERROR_NoError)
+ *            ProcessSensorData(SensorData);
+ *
+ *          // Immediately start the next sensor read
+ *          TWI_QueueTransaction(Transaction);
+ *      }
+ *
+ *      // Initialize the TWI driver before first use at 400KHz, start the first sensor read
+ *      TWI_Init(TWI_BIT_PRESCALE_1, TWI_BITLENGTH_FROM_FREQ(1, 400000));
+ *      GlobalInterruptEnable();
+ *
+ *      TWI_QueueTransaction(&SensorRead);
+ *
+ *      for (;;)
+ *      {
+ *          TWI_TransactionTask();
+ *          USB_USBTask();
+ *      }
+ *  \endcode
+ *
  *  @{
  */
 
@@ -294,6 +336,85 @@
 			                        const uint8_t* Buffer,
 			                        uint16_t Length) ATTR_NON_NULL_PTR_ARG(3);
 
+		#if defined(INTERRUPT_TWI_TRANSACTIONS) || defined(__DOXYGEN__)
+		/* Macros: */
+			/** Value of the \c Status element of a \ref TWI_Transaction_t while the transaction is queued or in progress. */
+			#define TWI_TRANSACTION_PENDING  0xFF
+
+		/* Type Defines: */
+			struct TWI_Transaction;
+
+			/** Type define for a queued TWI transaction completion callback function, called from \ref TWI_TransactionTask()
+			 *  once the given transaction has completed.
+			 *
+			 *  \param[in] Transaction  Pointer to the completed transaction.
+			 */
+			typedef void (*TWI_TransactionCallback_t)(struct TWI_Transaction* const Transaction);
+
+			/** \brief Interrupt Driven TWI Transaction.
+			 *
+			 *  Type define for a single transaction performed by the interrupt driven TWI transaction engine. Each transaction
+			 *  optionally writes an internal (register) address to the slave device, and then reads or writes a block of data
+			 *  from or to the device, releasing the bus once complete. The transaction and its data buffer must remain valid
+			 *  and unmodified until the transaction has completed.
+			 *
+			 *  \note Only available when the \c INTERRUPT_TWI_TRANSACTIONS compile time token is defined.
+			 */
+			typedef struct TWI_Transaction
+			{
+				uint8_t  SlaveAddress; /**< Base address of the TWI slave device, ORed with \ref TWI_ADDRESS_READ or \ref TWI_ADDRESS_WRITE
+				                        *   to give the direction of the data transfer.
+				                        */
+				uint8_t  InternalAddressLen; /**< Size of the internal device address to write before the data, in bytes (0-2). */
+				uint16_t InternalAddress; /**< Internal device address to write before the data, sent most significant byte first. */
+				uint8_t* Buffer; /**< Pointer to the buffer holding the data to write, or where the read data is to be stored. */
+				uint16_t Length; /**< Number of data bytes to transfer; must be non-zero for read transactions. */
+				TWI_TransactionCallback_t Callback; /**< Optional callback to run from \ref TWI_TransactionTask() once the
+				                                     *   transaction has completed, or \c NULL if no callback is required.
+				                                     */
+
+				volatile uint8_t Status; /**< \ref TWI_TRANSACTION_PENDING while the transaction is pending, then a value from the
+				                          *   \ref TWI_ErrorCodes_t enum once complete. Set by the driver.
+				                          */
+				struct TWI_Transaction* NextTransaction; /**< Transaction queue link, managed by the driver. */
+			} TWI_Transaction_t;
+
+		/* Function Prototypes: */
+			/** Adds a transaction to the end of the TWI transaction queue, to be performed by the TWI interrupt once all
+			 *  previously queued transactions have completed. The transaction's \c Status is set to \ref TWI_TRANSACTION_PENDING
+			 *  until it completes.
+			 *
+			 *  A transaction must not be queued again until it has completed, and, if it has a callback, its callback
+			 *  has been run; transactions may be re-queued from within their own callback.
+			 *
+			 *  \note Global interrupts must be enabled for queued transactions to be performed.
+			 *
+			 *  \param[in,out] Transaction  Pointer to the transaction to queue.
+			 *
+			 *  \return Boolean \c true if the transaction was queued, \c false if it is invalid.
+			 */
+			bool TWI_QueueTransaction(TWI_Transaction_t* const Transaction) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Runs the completion callbacks of all transactions which have completed since the last call, in completion order.
+			 *  This should be called regularly from the main program loop when transaction callbacks are used.
+			 */
+			void TWI_TransactionTask(void);
+
+			/** Determines if the TWI transaction queue is empty, so that the blocking TWI driver functions may be used.
+			 *
+			 *  \return Boolean \c true if no queued transactions are pending, \c false otherwise.
+			 */
+			bool TWI_IsTransactionQueueIdle(void) ATTR_WARN_UNUSED_RESULT;
+		#endif
+
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Function Prototypes: */
+			#if defined(__INCLUDE_FROM_TWI_C) && defined(INTERRUPT_TWI_TRANSACTIONS)
+				static void TWI_CompleteTransaction(const uint8_t Status);
+			#endif
+	#endif
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
@@ -240,6 +240,115 @@
 				return SPI->DATA;
 			}
 
+			/** Sends a block of bytes through the SPI interface, blocking until the transfer is complete. Each byte is
+			 *  fetched from the buffer while the previous byte is being shifted out, so that consecutive bytes are sent
+			 *  with minimal delay between them. The response bytes from the attached SPI device are ignored.
+			 *
+			 *  \param[in,out] SPI     Pointer to the base of the SPI peripheral within the device.
+			 *  \param[in]     Buffer  Pointer to the source data buffer.
+			 *  \param[in]     Length  Number of bytes to send through the SPI interface.
+			 */
+			static inline void SPI_SendBlock(SPI_t* const SPI,
+			                                 const void* Buffer,
+			                                 uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+			static inline void SPI_SendBlock(SPI_t* const SPI,
+			                                 const void* Buffer,
+			                                 uint16_t Length)
+			{
+				const uint8_t* DataIn = (const uint8_t*)Buffer;
+
+				if (!(Length))
+				  return;
+
+				SPI->DATA = *(DataIn++);
+
+				while (--Length)
+				{
+					uint8_t NextByte = *(DataIn++);
+
+					while (!(SPI->STATUS & SPI_IF_bm));
+					SPI->DATA = NextByte;
+				}
+
+				while (!(SPI->STATUS & SPI_IF_bm));
+			}
+
+			/** Receives a block of bytes through the SPI interface, sending a dummy 0x00 byte for each and blocking
+			 *  until the transfer is complete. Each transfer is started immediately after the previous response byte
+			 *  is read out, before it is stored to the buffer.
+			 *
+			 *  \param[in,out] SPI     Pointer to the base of the SPI peripheral within the device.
+			 *  \param[out]    Buffer  Pointer to the destination data buffer.
+			 *  \param[in]     Length  Number of bytes to receive through the SPI interface.
+			 */
+			static inline void SPI_ReceiveBlock(SPI_t* const SPI,
+			                                    void* Buffer,
+			                                    uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+			static inline void SPI_ReceiveBlock(SPI_t* const SPI,
+			                                    void* Buffer,
+			                                    uint16_t Length)
+			{
+				uint8_t* DataOut = (uint8_t*)Buffer;
+
+				if (!(Length))
+				  return;
+
+				SPI->DATA = 0x00;
+
+				while (--Length)
+				{
+					while (!(SPI->STATUS & SPI_IF_bm));
+
+					uint8_t ReceivedByte = SPI->DATA;
+					SPI->DATA = 0x00;
+					*(DataOut++) = ReceivedByte;
+				}
+
+				while (!(SPI->STATUS & SPI_IF_bm));
+				*DataOut = SPI->DATA;
+			}
+
+			/** Sends and receives a block of bytes through the SPI interface, blocking until the transfer is complete.
+			 *  The source and destination buffers may be the same buffer, in which case the sent data is replaced
+			 *  with the response data.
+			 *
+			 *  \param[in,out] SPI       Pointer to the base of the SPI peripheral within the device.
+			 *  \param[in]     TxBuffer  Pointer to the source data buffer.
+			 *  \param[out]    RxBuffer  Pointer to the destination buffer for the response bytes from the attached SPI device.
+			 *  \param[in]     Length    Number of bytes to transfer through the SPI interface.
+			 */
+			static inline void SPI_TransferBlock(SPI_t* const SPI,
+			                                     const void* TxBuffer,
+			                                     void* RxBuffer,
+			                                     uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2) ATTR_NON_NULL_PTR_ARG(3);
+			static inline void SPI_TransferBlock(SPI_t* const SPI,
+			                                     const void* TxBuffer,
+			                                     void* RxBuffer,
+			                                     uint16_t Length)
+			{
+				const uint8_t* DataIn  = (const uint8_t*)TxBuffer;
+				uint8_t*       DataOut = (uint8_t*)RxBuffer;
+
+				if (!(Length))
+				  return;
+
+				SPI->DATA = *(DataIn++);
+
+				while (--Length)
+				{
+					uint8_t NextByte = *(DataIn++);
+
+					while (!(SPI->STATUS & SPI_IF_bm));
+
+					uint8_t ReceivedByte = SPI->DATA;
+					SPI->DATA = NextByte;
+					*(DataOut++) = ReceivedByte;
+				}
+
+				while (!(SPI->STATUS & SPI_IF_bm));
+				*DataOut = SPI->DATA;
+			}
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
@@ -201,6 +201,133 @@
 				return SerialSPI_TransferByte(USART, 0);
 			}
 
+			/** Sends and receives a block of bytes through the USART SPI interface, blocking until the transfer is complete.
+			 *  The USART's double buffered transmit register is kept loaded while the previous byte is shifted out, so that
+			 *  consecutive bytes are transferred back to back without gaps. The source and destination buffers may be the
+			 *  same buffer, in which case the sent data is replaced with the response data.
+			 *
+			 *  \param[in,out] USART     Pointer to the base of the USART peripheral within the device.
+			 *  \param[in]     TxBuffer  Pointer to the source data buffer.
+			 *  \param[out]    RxBuffer  Pointer to the destination buffer for the response bytes from the attached SPI device.
+			 *  \param[in]     Length    Number of bytes to transfer through the USART SPI interface.
+			 */
+			static inline void SerialSPI_TransferBlock(USART_t* const USART,
+			                                           const void* TxBuffer,
+			                                           void* RxBuffer,
+			                                           uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2) ATTR_NON_NULL_PTR_ARG(3);
+			static inline void SerialSPI_TransferBlock(USART_t* const USART,
+			                                           const void* TxBuffer,
+			                                           void* RxBuffer,
+			                                           uint16_t Length)
+			{
+				const uint8_t* DataIn      = (const uint8_t*)TxBuffer;
+				uint8_t*       DataOut     = (uint8_t*)RxBuffer;
+				uint16_t       BytesToSend = Length;
+
+				if (!(Length))
+				  return;
+
+				while (Length)
+				{
+					/* Only queue another byte while fewer than two response bytes are outstanding, to avoid a receive overrun */
+					if (BytesToSend && ((Length - BytesToSend) < 2) && (USART->STATUS & USART_DREIF_bm))
+					{
+						USART->DATA   = *(DataIn++);
+						USART->STATUS = USART_TXCIF_bm;
+						BytesToSend--;
+					}
+
+					if (USART->STATUS & USART_RXCIF_bm)
+					{
+						*(DataOut++) = USART->DATA;
+						Length--;
+					}
+				}
+
+				while (!(USART->STATUS & USART_TXCIF_bm));
+				USART->STATUS = USART_TXCIF_bm;
+			}
+
+			/** Sends a block of bytes through the USART SPI interface, blocking until the transfer is complete. The response
+			 *  bytes from the attached SPI device are ignored.
+			 *
+			 *  \param[in,out] USART   Pointer to the base of the USART peripheral within the device.
+			 *  \param[in]     Buffer  Pointer to the source data buffer.
+			 *  \param[in]     Length  Number of bytes to send through the USART SPI interface.
+			 */
+			static inline void SerialSPI_SendBlock(USART_t* const USART,
+			                                       const void* Buffer,
+			                                       uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+			static inline void SerialSPI_SendBlock(USART_t* const USART,
+			                                       const void* Buffer,
+			                                       uint16_t Length)
+			{
+				const uint8_t* DataIn      = (const uint8_t*)Buffer;
+				uint16_t       BytesToSend = Length;
+
+				if (!(Length))
+				  return;
+
+				while (Length)
+				{
+					if (BytesToSend && ((Length - BytesToSend) < 2) && (USART->STATUS & USART_DREIF_bm))
+					{
+						USART->DATA   = *(DataIn++);
+						USART->STATUS = USART_TXCIF_bm;
+						BytesToSend--;
+					}
+
+					if (USART->STATUS & USART_RXCIF_bm)
+					{
+						(void)USART->DATA;
+						Length--;
+					}
+				}
+
+				while (!(USART->STATUS & USART_TXCIF_bm));
+				USART->STATUS = USART_TXCIF_bm;
+			}
+
+			/** Receives a block of bytes through the USART SPI interface, sending a dummy 0x00 byte for each and blocking
+			 *  until the transfer is complete.
+			 *
+			 *  \param[in,out] USART   Pointer to the base of the USART peripheral within the device.
+			 *  \param[out]    Buffer  Pointer to the destination data buffer.
+			 *  \param[in]     Length  Number of bytes to receive through the USART SPI interface.
+			 */
+			static inline void SerialSPI_ReceiveBlock(USART_t* const USART,
+			                                          void* Buffer,
+			                                          uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+			static inline void SerialSPI_ReceiveBlock(USART_t* const USART,
+			                                          void* Buffer,
+			                                          uint16_t Length)
+			{
+				uint8_t* DataOut     = (uint8_t*)Buffer;
+				uint16_t BytesToSend = Length;
+
+				if (!(Length))
+				  return;
+
+				while (Length)
+				{
+					if (BytesToSend && ((Length - BytesToSend) < 2) && (USART->STATUS & USART_DREIF_bm))
+					{
+						USART->DATA   = 0x00;
+						USART->STATUS = USART_TXCIF_bm;
+						BytesToSend--;
+					}
+
+					if (USART->STATUS & USART_RXCIF_bm)
+					{
+						*(DataOut++) = USART->DATA;
+						Length--;
+					}
+				}
+
+				while (!(USART->STATUS & USART_TXCIF_bm));
+				USART->STATUS = USART_TXCIF_bm;
+			}
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
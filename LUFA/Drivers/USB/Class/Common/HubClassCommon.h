@@ -0,0 +1,194 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *  \brief Common definitions and declarations for the library USB Hub Class driver.
+ *
+ *  Common definitions and declarations for the library USB Hub Class driver.
+ *
+ *  \note This file should not be included directly. It is automatically included as needed by the USB module driver
+ *        dispatch header located in LUFA/Drivers/USB.h.
+ */
+
+/** \ingroup Group_USBClassHub
+ *  \defgroup Group_USBClassHubCommon  Common Class Definitions
+ *
+ *  \section Sec_USBClassHubCommon_ModDescription Module Description
+ *  Constants, Types and Enum definitions that are common to both Device and Host modes for the USB
+ *  Hub Class.
+ *
+ *  @{
+ */
+
+#ifndef _HUB_CLASS_COMMON_H_
+#define _HUB_CLASS_COMMON_H_
+
+	/* Includes: */
+		#include "../../Core/StdDescriptors.h"
+
+	/* Enable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			extern "C" {
+		#endif
+
+	/* Preprocessor Checks: */
+		#if !defined(__INCLUDE_FROM_HUB_DRIVER)
+			#error Do not include this file directly. Include LUFA/Drivers/USB.h instead.
+		#endif
+
+	/* Macros: */
+		/** \name Hub Port Status Masks */
+		//@{
+		/** Port status mask indicating that a device is connected to the hub port. */
+		#define HUB_PORTSTATUS_CONNECTION   (1 << 0)
+
+		/** Port status mask indicating that the hub port is enabled. */
+		#define HUB_PORTSTATUS_ENABLE       (1 << 1)
+
+		/** Port status mask indicating that the hub port is suspended. */
+		#define HUB_PORTSTATUS_SUSPEND      (1 << 2)
+
+		/** Port status mask indicating that an over-current condition exists on the hub port. */
+		#define HUB_PORTSTATUS_OVERCURRENT  (1 << 3)
+
+		/** Port status mask indicating that the hub port is currently being reset. */
+		#define HUB_PORTSTATUS_RESET        (1 << 4)
+
+		/** Port status mask indicating that the hub port is powered. */
+		#define HUB_PORTSTATUS_POWER        (1 << 8)
+
+		/** Port status mask indicating that a Low Speed device is attached to the hub port. */
+		#define HUB_PORTSTATUS_LOWSPEED     (1 << 9)
+
+		/** Port status mask indicating that a High Speed device is attached to the hub port. */
+		#define HUB_PORTSTATUS_HIGHSPEED    (1 << 10)
+		//@}
+
+		/** \name Hub Port Change Masks */
+		//@{
+		/** Port change mask indicating that the connection status of the hub port has changed. */
+		#define HUB_PORTCHANGE_CONNECTION   (1 << 0)
+
+		/** Port change mask indicating that the hub port has been disabled due to an error. */
+		#define HUB_PORTCHANGE_ENABLE       (1 << 1)
+
+		/** Port change mask indicating that the hub port has completed a resume. */
+		#define HUB_PORTCHANGE_SUSPEND      (1 << 2)
+
+		/** Port change mask indicating that the over-current status of the hub port has changed. */
+		#define HUB_PORTCHANGE_OVERCURRENT  (1 << 3)
+
+		/** Port change mask indicating that the hub port has completed a reset. */
+		#define HUB_PORTCHANGE_RESET        (1 << 4)
+		//@}
+
+	/* Enums: */
+		/** Enum for possible Class, Subclass and Protocol values of device and interface descriptors relating to the Hub
+		 *  device class.
+		 */
+		enum HUB_Descriptor_ClassSubclassProtocol_t
+		{
+			HUB_CSCP_HubClass               = 0x09, /**< Descriptor Class value indicating that the device or interface
+			                                         *   belongs to the Hub class.
+			                                         */
+			HUB_CSCP_NoSpecificSubclass     = 0x00, /**< Descriptor Subclass value indicating that the device or interface
+			                                         *   belongs to no specific subclass of the Hub class.
+			                                         */
+			HUB_CSCP_FullSpeedProtocol      = 0x00, /**< Descriptor Protocol value indicating that the device or interface
+			                                         *   belongs to the Full Speed hub protocol of the Hub class.
+			                                         */
+		};
+
+		/** Enum for the Hub class specific descriptor types. */
+		enum HUB_DescriptorTypes_t
+		{
+			HUB_DTYPE_Hub                   = 0x29, /**< Descriptor header type value, to indicate a Hub class descriptor. */
+		};
+
+		/** Enum for the Hub class feature selectors, used with the standard SET FEATURE and CLEAR FEATURE requests
+		 *  when issued to a hub or one of its ports.
+		 */
+		enum HUB_Features_t
+		{
+			HUB_FEATURE_CHubLocalPower      = 0,  /**< Hub feature selector for the hub local power change indicator. */
+			HUB_FEATURE_CHubOverCurrent     = 1,  /**< Hub feature selector for the hub over-current change indicator. */
+			HUB_FEATURE_PortConnection      = 0,  /**< Port feature selector for the port connection status. */
+			HUB_FEATURE_PortEnable          = 1,  /**< Port feature selector for the port enable status. */
+			HUB_FEATURE_PortSuspend         = 2,  /**< Port feature selector for the port suspend status. */
+			HUB_FEATURE_PortOverCurrent     = 3,  /**< Port feature selector for the port over-current status. */
+			HUB_FEATURE_PortReset           = 4,  /**< Port feature selector for the port reset status. */
+			HUB_FEATURE_PortPower           = 8,  /**< Port feature selector for the port power status. */
+			HUB_FEATURE_PortLowSpeed        = 9,  /**< Port feature selector for the port Low Speed device status. */
+			HUB_FEATURE_CPortConnection     = 16, /**< Port feature selector for the port connection change indicator. */
+			HUB_FEATURE_CPortEnable         = 17, /**< Port feature selector for the port enable change indicator. */
+			HUB_FEATURE_CPortSuspend        = 18, /**< Port feature selector for the port suspend change indicator. */
+			HUB_FEATURE_CPortOverCurrent    = 19, /**< Port feature selector for the port over-current change indicator. */
+			HUB_FEATURE_CPortReset          = 20, /**< Port feature selector for the port reset change indicator. */
+		};
+
+	/* Type Defines: */
+		/** \brief Hub Class Descriptor.
+		 *
+		 *  Type define for the fixed portion of the Hub class descriptor, which describes the number of downstream
+		 *  ports of a hub and their power switching characteristics. The variable length port bitmaps which follow
+		 *  this in the full descriptor are not included.
+		 *
+		 *  \note Regardless of CPU architecture, these values should be stored as little endian.
+		 */
+		typedef struct
+		{
+			USB_Descriptor_Header_t Header; /**< Regular descriptor header containing the descriptor's type and length. */
+
+			uint8_t  TotalPorts; /**< Number of downstream ports on the hub. */
+			uint16_t HubCharacteristics; /**< Hub power switching and over-current protection characteristics. */
+			uint8_t  PowerOnToPowerGood; /**< Time from port power on until the port's power is good, in 2ms units. */
+			uint8_t  HubControlCurrent; /**< Maximum current requirement of the hub controller, in mA. */
+		} ATTR_PACKED HUB_Descriptor_Hub_t;
+
+		/** \brief Hub Port Status.
+		 *
+		 *  Type define for the status of a hub port, returned by the hub in response to a GET STATUS request
+		 *  issued to one of its ports.
+		 */
+		typedef struct
+		{
+			uint16_t Status; /**< Current status of the port, a mask of \c HUB_PORTSTATUS_* masks. */
+			uint16_t Change; /**< Changes in the status of the port, a mask of \c HUB_PORTCHANGE_* masks. */
+		} ATTR_PACKED HUB_PortStatus_t;
+
+	/* Disable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			}
+		#endif
+
+#endif
+
+/** @} */
+
@@ -137,6 +137,16 @@
 		 */
 		#define MIDI_EVENT(virtualcable, command)  (((virtualcable) << 4) | ((command) >> 4))
 
+		/** Calculates the maximum number of \ref MIDI_EventPacket_t MIDI event packets that can be packed into a single
+		 *  endpoint or pipe packet of the given size, for sizing event arrays passed to the batched MIDI send and
+		 *  receive functions.
+		 *
+		 *  \param[in] packetsize  Size of the endpoint or pipe bank, in bytes.
+		 *
+		 *  \return Maximum number of MIDI event packets per USB packet.
+		 */
+		#define MIDI_EVENTS_PER_PACKET(packetsize) ((packetsize) / sizeof(MIDI_EventPacket_t))
+
 	/* Enums: */
 		/** Enum for the possible MIDI jack types in a MIDI device jack descriptor. */
 		enum MIDI_JackTypes_t
@@ -352,6 +362,12 @@
 			uint8_t  Data3; /**< Third byte of data in the MIDI event. */
 		} ATTR_PACKED MIDI_EventPacket_t;
 
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Macros: */
+			#define MIDI_FRAME_NUMBER_MASK             0x07FF
+	#endif
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
@@ -114,6 +114,18 @@
 			                                             */
 		};
 
+		/** Enum for the PIMA operation codes issued by the Still Image class drivers. */
+		enum PIMA_OperationCodes_t
+		{
+			PIMA_OPERATION_OpenSession          = 0x1002, /**< Opens a new session with the device. */
+			PIMA_OPERATION_CloseSession         = 0x1003, /**< Closes the current session with the device. */
+			PIMA_OPERATION_GetObjectHandles     = 0x1007, /**< Retrieves the handles of the objects stored on the device. */
+			PIMA_OPERATION_GetObjectInfo        = 0x1008, /**< Retrieves the ObjectInfo dataset of a single object. */
+			PIMA_OPERATION_GetObject            = 0x1009, /**< Retrieves the complete data of a single object. */
+			PIMA_OPERATION_PowerDown            = 0x1013, /**< Requests that the device power itself down. */
+			PIMA_OPERATION_GetPartialObject     = 0x101B, /**< Retrieves a byte range of the data of a single object. */
+		};
+
 		/** Enums for the possible status codes of a returned Response Block from an attached PIMA compliant Still Image device. */
 		enum PIMA_ResponseCodes_t
 		{
@@ -150,6 +162,33 @@
 			uint32_t Params[3]; /**< Block parameters to be issued along with the block code (command blocks only). */
 		} ATTR_PACKED PIMA_Container_t;
 
+		/** \brief PIMA Still Image Device ObjectInfo Dataset.
+		 *
+		 *  Type define for the fixed length leading portion of a PIMA ObjectInfo dataset, as returned by the device in
+		 *  response to a \ref PIMA_OPERATION_GetObjectInfo operation. The variable length filename, date and keyword
+		 *  strings which follow in the dataset are not included.
+		 *
+		 *  \note Regardless of CPU architecture, these values should be stored as little endian.
+		 */
+		typedef struct
+		{
+			uint32_t StorageID; /**< Identifier of the storage medium the object resides on. */
+			uint16_t ObjectFormat; /**< PIMA format code of the object. */
+			uint16_t ProtectionStatus; /**< Non-zero if the object is write protected. */
+			uint32_t ObjectCompressedSize; /**< Size of the object's data, in bytes. */
+			uint16_t ThumbFormat; /**< PIMA format code of the object's thumbnail. */
+			uint32_t ThumbCompressedSize; /**< Size of the object's thumbnail data, in bytes. */
+			uint32_t ThumbPixWidth; /**< Width of the object's thumbnail, in pixels. */
+			uint32_t ThumbPixHeight; /**< Height of the object's thumbnail, in pixels. */
+			uint32_t ImagePixWidth; /**< Width of the image object, in pixels. */
+			uint32_t ImagePixHeight; /**< Height of the image object, in pixels. */
+			uint32_t ImageBitDepth; /**< Bit depth of the image object. */
+			uint32_t ParentObject; /**< Handle of the association (folder) containing the object, or zero if at the root. */
+			uint16_t AssociationType; /**< Association type, if the object is itself an association. */
+			uint32_t AssociationDesc; /**< Association specific description. */
+			uint32_t SequenceNumber; /**< Sequence number of the object within a capture sequence. */
+		} ATTR_PACKED PIMA_ObjectInfo_t;
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
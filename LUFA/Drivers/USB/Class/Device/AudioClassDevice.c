@@ -72,6 +72,8 @@ void Audio_Device_ProcessControlRequest(USB_ClassInfo_Audio_Device_t* const Audi
 				Endpoint_ClearStatusStage();
 
 				AudioInterfaceInfo->State.InterfaceEnabled = ((USB_ControlRequest.wValue & 0xFF) != 0);
+				Audio_Device_ResetSampleBuffer(AudioInterfaceInfo);
+
 				EVENT_Audio_Device_StreamStartStop(AudioInterfaceInfo);
 			}
 
@@ -176,8 +178,9 @@ bool Audio_Device_ConfigureEndpoints(USB_ClassInfo_Audio_Device_t* const AudioIn
 {
 	memset(&AudioInterfaceInfo->State, 0x00, sizeof(AudioInterfaceInfo->State));
 
-	AudioInterfaceInfo->Config.DataINEndpoint.Type  = EP_TYPE_ISOCHRONOUS;
-	AudioInterfaceInfo->Config.DataOUTEndpoint.Type = EP_TYPE_ISOCHRONOUS;
+	AudioInterfaceInfo->Config.DataINEndpoint.Type     = EP_TYPE_ISOCHRONOUS;
+	AudioInterfaceInfo->Config.DataOUTEndpoint.Type    = EP_TYPE_ISOCHRONOUS;
+	AudioInterfaceInfo->Config.FeedbackINEndpoint.Type = EP_TYPE_ISOCHRONOUS;
 
 	if (!(Endpoint_ConfigureEndpointTable(&AudioInterfaceInfo->Config.DataINEndpoint, 1)))
 	  return false;
@@ -185,13 +188,214 @@ bool Audio_Device_ConfigureEndpoints(USB_ClassInfo_Audio_Device_t* const AudioIn
 	if (!(Endpoint_ConfigureEndpointTable(&AudioInterfaceInfo->Config.DataOUTEndpoint, 1)))
 	  return false;
 
+	if (!(Endpoint_ConfigureEndpointTable(&AudioInterfaceInfo->Config.FeedbackINEndpoint, 1)))
+	  return false;
+
+	#if defined(DEVICE_MAX_INTERFACES)
+	if (!(USB_Device_SetControlRequestHandler(AudioInterfaceInfo->Config.ControlInterfaceNumber,
+	                                          Audio_Device_ControlRequestHandler,
+	                                          AudioInterfaceInfo)) ||
+	    !(USB_Device_SetControlRequestHandler(AudioInterfaceInfo->Config.StreamingInterfaceNumber,
+	                                          Audio_Device_ControlRequestHandler,
+	                                          AudioInterfaceInfo)))
+	{
+		return false;
+	}
+
+	if (AudioInterfaceInfo->Config.DataINEndpoint.Address)
+	  USB_Device_SetEndpointInterface(AudioInterfaceInfo->Config.DataINEndpoint.Address, AudioInterfaceInfo->Config.StreamingInterfaceNumber);
+
+	if (AudioInterfaceInfo->Config.DataOUTEndpoint.Address)
+	  USB_Device_SetEndpointInterface(AudioInterfaceInfo->Config.DataOUTEndpoint.Address, AudioInterfaceInfo->Config.StreamingInterfaceNumber);
+	#endif
+
 	return true;
 }
 
+void Audio_Device_USBTask(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+{
+	if ((USB_DeviceState != DEVICE_STATE_Configured) || !(AudioInterfaceInfo->State.InterfaceEnabled))
+	  return;
+
+	if (AudioInterfaceInfo->Config.SampleBuffer == NULL)
+	  return;
+
+	if (AudioInterfaceInfo->Config.DataOUTEndpoint.Address)
+	  Audio_Device_ReceiveBufferedSamples(AudioInterfaceInfo);
+
+	if (AudioInterfaceInfo->Config.DataINEndpoint.Address)
+	  Audio_Device_SendBufferedSamples(AudioInterfaceInfo);
+
+	if (AudioInterfaceInfo->Config.FeedbackINEndpoint.Address)
+	  Audio_Device_SendRateFeedback(AudioInterfaceInfo);
+}
+
+void Audio_Device_ProcessStartOfFrame(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+{
+	/* Only measure the rate while the application is consuming or producing samples at its true rate */
+	if (!(AudioInterfaceInfo->State.InterfaceEnabled) || !(AudioInterfaceInfo->State.SampleBufferPrimed))
+	{
+		AudioInterfaceInfo->State.FeedbackFrameCount = 0;
+		AudioInterfaceInfo->State.FeedbackSampleMark = AudioInterfaceInfo->State.SamplesTransferred;
+		return;
+	}
+
+	if (++AudioInterfaceInfo->State.FeedbackFrameCount < (1 << AUDIO_FEEDBACK_REFRESH_EXPONENT))
+	  return;
+
+	uint8_t  ChannelCount      = AudioInterfaceInfo->Config.ChannelCount ? AudioInterfaceInfo->Config.ChannelCount : 1;
+	uint16_t PeriodSamples     = (AudioInterfaceInfo->State.SamplesTransferred - AudioInterfaceInfo->State.FeedbackSampleMark);
+	int16_t  FillErrorSamples  = ((AudioInterfaceInfo->Config.SampleBufferSize / 2) - AudioInterfaceInfo->State.SampleCount);
+
+	AudioInterfaceInfo->State.FeedbackFrameCount = 0;
+	AudioInterfaceInfo->State.FeedbackSampleMark = AudioInterfaceInfo->State.SamplesTransferred;
+
+	/* Convert the measured samples per period to 10.14 format samples per frame, and correct for the buffer fill level
+	 * error over four measurement periods so that the buffer settles at half full without oscillating */
+	int32_t Feedback = (((int32_t)(PeriodSamples / ChannelCount)) << (14 - AUDIO_FEEDBACK_REFRESH_EXPONENT));
+	Feedback += ((int32_t)(FillErrorSamples / ChannelCount) * (1 << (14 - AUDIO_FEEDBACK_REFRESH_EXPONENT - 2)));
+
+	AudioInterfaceInfo->State.FeedbackValue = (Feedback > 0) ? Feedback : 0;
+}
+
+static void Audio_Device_ResetSampleBuffer(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	AudioInterfaceInfo->State.SampleIn           = 0;
+	AudioInterfaceInfo->State.SampleOut          = 0;
+	AudioInterfaceInfo->State.SampleCount        = 0;
+	AudioInterfaceInfo->State.SampleBufferPrimed = false;
+	AudioInterfaceInfo->State.FeedbackFrameCount = 0;
+	AudioInterfaceInfo->State.FeedbackSampleMark = AudioInterfaceInfo->State.SamplesTransferred;
+	AudioInterfaceInfo->State.FeedbackValue      = 0;
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+static void Audio_Device_ReceiveBufferedSamples(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+{
+	Endpoint_SelectEndpoint(AudioInterfaceInfo->Config.DataOUTEndpoint.Address);
+
+	if (!(Endpoint_IsOUTReceived()))
+	  return;
+
+	uint16_t PacketSamples = (Endpoint_BytesInEndpoint() / sizeof(int16_t));
+	uint16_t SampleCount;
+
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+	SampleCount = AudioInterfaceInfo->State.SampleCount;
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	/* Discard complete packets that do not fit, so that the buffer always holds whole multi-channel sample frames */
+	if ((AudioInterfaceInfo->Config.SampleBufferSize - SampleCount) < PacketSamples)
+	{
+		AudioInterfaceInfo->State.OverrunCount += PacketSamples;
+		Endpoint_ClearOUT();
+		return;
+	}
+
+	int16_t* const SampleBuffer = AudioInterfaceInfo->Config.SampleBuffer;
+	uint16_t       SampleIn     = AudioInterfaceInfo->State.SampleIn;
+
+	for (uint16_t i = 0; i < PacketSamples; i++)
+	{
+		SampleBuffer[SampleIn] = (int16_t)Endpoint_Read_16_LE();
+
+		if (++SampleIn == AudioInterfaceInfo->Config.SampleBufferSize)
+		  SampleIn = 0;
+	}
+
+	Endpoint_ClearOUT();
+
+	AudioInterfaceInfo->State.SampleIn = SampleIn;
+
+	CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+	AudioInterfaceInfo->State.SampleCount += PacketSamples;
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+static void Audio_Device_SendBufferedSamples(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+{
+	Endpoint_SelectEndpoint(AudioInterfaceInfo->Config.DataINEndpoint.Address);
+
+	if (!(Endpoint_IsINReady()))
+	  return;
+
+	uint8_t  ChannelCount  = AudioInterfaceInfo->Config.ChannelCount ? AudioInterfaceInfo->Config.ChannelCount : 1;
+	uint16_t PacketSamples = (AudioInterfaceInfo->Config.DataINEndpoint.Size / sizeof(int16_t));
+	uint16_t SampleCount;
+
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+	SampleCount = AudioInterfaceInfo->State.SampleCount;
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	/* Send all whole sample frames buffered since the last packet, up to a full endpoint bank */
+	if (SampleCount < PacketSamples)
+	  PacketSamples = SampleCount;
+
+	PacketSamples -= (PacketSamples % ChannelCount);
+
+	if (!(PacketSamples))
+	  return;
+
+	int16_t* const SampleBuffer = AudioInterfaceInfo->Config.SampleBuffer;
+	uint16_t       SampleOut    = AudioInterfaceInfo->State.SampleOut;
+
+	for (uint16_t i = 0; i < PacketSamples; i++)
+	{
+		Endpoint_Write_16_LE(SampleBuffer[SampleOut]);
+
+		if (++SampleOut == AudioInterfaceInfo->Config.SampleBufferSize)
+		  SampleOut = 0;
+	}
+
+	Endpoint_ClearIN();
+
+	AudioInterfaceInfo->State.SampleOut = SampleOut;
+
+	CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+	AudioInterfaceInfo->State.SampleCount -= PacketSamples;
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+static void Audio_Device_SendRateFeedback(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+{
+	uint32_t FeedbackValue;
+
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+	FeedbackValue = AudioInterfaceInfo->State.FeedbackValue;
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	/* Let the host use its nominal rate until the first measurement period has completed */
+	if (!(FeedbackValue))
+	  return;
+
+	Endpoint_SelectEndpoint(AudioInterfaceInfo->Config.FeedbackINEndpoint.Address);
+
+	if (!(Endpoint_IsINReady()))
+	  return;
+
+	/* Full speed feedback values are sent as three byte, 10.14 fixed point little endian values */
+	Endpoint_Write_16_LE(FeedbackValue & 0xFFFF);
+	Endpoint_Write_8(FeedbackValue >> 16);
+	Endpoint_ClearIN();
+}
+
 void Audio_Device_Event_Stub(void)
 {
 
 }
 
+#if defined(DEVICE_MAX_INTERFACES)
+USB_DEVICE_CONTROL_REQUEST_HANDLER(Audio_Device_ControlRequestHandler, USB_ClassInfo_Audio_Device_t, Audio_Device_ProcessControlRequest)
+#endif
+
 #endif
 
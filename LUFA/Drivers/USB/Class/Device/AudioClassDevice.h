@@ -47,6 +47,13 @@
  *  \section Sec_USBClassAudioDevice_ModDescription Module Description
  *  Device Mode USB Class driver framework interface, for the Audio 1.0 USB Class driver.
  *
+ *  Samples may either be transferred one at a time directly to and from the streaming endpoints, or through the
+ *  driver's buffered streaming mode. In the buffered mode, \ref Audio_Device_USBTask() moves whole isochronous packets
+ *  between the streaming endpoints and an application supplied sample buffer, which the application's sample timer
+ *  then reads from or writes to with \ref Audio_Device_ReadBufferedSample16() and \ref Audio_Device_WriteBufferedSample16()
+ *  without touching the USB controller. An optional asynchronous rate feedback endpoint reports the application's true
+ *  sample rate to the host, measured against the USB Start of Frame and corrected by the sample buffer fill level.
+ *
  *  @{
  */
 
@@ -68,6 +75,13 @@
 		#endif
 
 	/* Public Interface - May be used in end-application: */
+		/* Macros: */
+			/** Exponent of the rate feedback measurement period, in USB frames. The measured rate is updated every
+			 *  2^AUDIO_FEEDBACK_REFRESH_EXPONENT frames; this value should be used as the \c Refresh value of the
+			 *  feedback endpoint's descriptor.
+			 */
+			#define AUDIO_FEEDBACK_REFRESH_EXPONENT    6
+
 		/* Type Defines: */
 			/** \brief Audio Class Device Mode Configuration and State Structure.
 			 *
@@ -88,6 +102,18 @@
 
 					USB_Endpoint_Table_t DataINEndpoint; /**< Data IN endpoint configuration table. */
 					USB_Endpoint_Table_t DataOUTEndpoint; /**< Data OUT endpoint configuration table. */
+					USB_Endpoint_Table_t FeedbackINEndpoint; /**< Asynchronous rate feedback IN endpoint configuration table. The
+					                                          *   address should be left as zero if rate feedback is not used.
+					                                          */
+
+					int16_t* SampleBuffer; /**< Sample buffer for the buffered streaming mode, shared by the streaming endpoint of
+					                        *   the interface and the application's sample timer. This should be \c NULL if the
+					                        *   buffered streaming mode is not used.
+					                        */
+					uint16_t SampleBufferSize; /**< Size of the \c SampleBuffer buffer, in samples. This should be a multiple of
+					                            *   the streaming endpoint size in samples, for best performance.
+					                            */
+					uint8_t  ChannelCount; /**< Number of audio channels in the stream, for the buffered streaming mode. */
 				} Config; /**< Config data for the USB class interface within the device. All elements in this section
 				           *   <b>must</b> be set or the interface will fail to enumerate and operate correctly.
 				           */
@@ -96,6 +122,25 @@
 					bool InterfaceEnabled; /**< Set and cleared by the class driver to indicate if the host has enabled the streaming endpoints
 					                        *   of the Audio Streaming interface.
 					                        */
+
+					uint16_t          SampleIn; /**< Sample buffer index of the next sample to be stored in the buffered streaming mode. */
+					uint16_t          SampleOut; /**< Sample buffer index of the next sample to be retrieved in the buffered streaming mode. */
+					volatile uint16_t SampleCount; /**< Number of samples currently stored in the sample buffer. */
+					bool              SampleBufferPrimed; /**< Set once the sample buffer has been half filled after the stream starts,
+					                                       *   cleared again on an underrun.
+					                                       */
+					uint16_t          SamplesTransferred; /**< Running count of samples read from or written to the sample buffer
+					                                       *   by the application, for the rate feedback measurement.
+					                                       */
+					uint16_t          FeedbackSampleMark; /**< Value of \c SamplesTransferred at the start of the current
+					                                       *   rate feedback measurement period.
+					                                       */
+					uint8_t           FeedbackFrameCount; /**< Number of frames elapsed in the current rate feedback measurement period. */
+					uint32_t          FeedbackValue; /**< Current rate feedback value in samples per frame, in 10.14 fixed point format,
+					                                  *   or zero if no rate has been measured yet.
+					                                  */
+					uint16_t          UnderrunCount; /**< Number of samples the application has read from an empty sample buffer. */
+					uint16_t          OverrunCount; /**< Number of samples discarded due to a full sample buffer. */
 				} State; /**< State data for the USB class interface within the device. All elements in this section
 				          *   are reset to their defaults when the interface is enumerated.
 				          */
@@ -185,17 +230,102 @@
 			 */
 			void EVENT_Audio_Device_StreamStartStop(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo);
 
-		/* Inline Functions: */
 			/** General management task for a given Audio class interface, required for the correct operation of the interface. This should
 			 *  be called frequently in the main program loop, before the master USB management task \ref USB_USBTask().
 			 *
+			 *  When the buffered streaming mode is enabled, this moves complete packets between the streaming endpoints and the
+			 *  interface's sample buffer, and sends the current rate feedback value to the host if a feedback endpoint is used.
+			 *
+			 *  \param[in,out] AudioInterfaceInfo  Pointer to a structure containing an Audio Class configuration and state.
+			 */
+			void Audio_Device_USBTask(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Updates the rate feedback measurement of the given Audio interface. This should be linked to the library
+			 *  \ref EVENT_USB_Device_StartOfFrame() event when a rate feedback endpoint is used, with Start of Frame events enabled
+			 *  via \ref USB_Device_EnableSOFEvents().
+			 *
+			 *  \note This function runs in interrupt context, and must not be interrupted by the application's sample timer ISR.
+			 *
+			 *  \param[in,out] AudioInterfaceInfo  Pointer to a structure containing an Audio Class configuration and state.
+			 */
+			void Audio_Device_ProcessStartOfFrame(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+
+		/* Inline Functions: */
+			/** Reads the next 16-bit audio sample from the sample buffer of the given audio interface, in the buffered streaming
+			 *  mode. Silence is returned while the buffer is being primed after the stream starts, and after a buffer underrun
+			 *  until it has been primed again.
+			 *
+			 *  \note This function must only be called from the application's sample timer ISR, or with global interrupts disabled.
+			 *
 			 *  \param[in,out] AudioInterfaceInfo  Pointer to a structure containing an Audio Class configuration and state.
+			 *
+			 *  \return Signed 16-bit audio sample from the sample buffer.
 			 */
-			static inline void Audio_Device_USBTask(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
-			                                        ATTR_NON_NULL_PTR_ARG(1) ATTR_ALWAYS_INLINE;
-			static inline void Audio_Device_USBTask(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+			static inline int16_t Audio_Device_ReadBufferedSample16(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+			                                                        ATTR_NON_NULL_PTR_ARG(1) ATTR_ALWAYS_INLINE;
+			static inline int16_t Audio_Device_ReadBufferedSample16(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
 			{
-				(void)AudioInterfaceInfo;
+				uint16_t SampleCount = AudioInterfaceInfo->State.SampleCount;
+
+				if (!(AudioInterfaceInfo->State.SampleBufferPrimed))
+				{
+					if (SampleCount < (AudioInterfaceInfo->Config.SampleBufferSize / 2))
+					  return 0;
+
+					AudioInterfaceInfo->State.SampleBufferPrimed = true;
+				}
+
+				if (!(SampleCount))
+				{
+					AudioInterfaceInfo->State.SampleBufferPrimed = false;
+					AudioInterfaceInfo->State.UnderrunCount++;
+					return 0;
+				}
+
+				uint16_t SampleOut = AudioInterfaceInfo->State.SampleOut;
+				int16_t  Sample    = AudioInterfaceInfo->Config.SampleBuffer[SampleOut];
+
+				if (++SampleOut == AudioInterfaceInfo->Config.SampleBufferSize)
+				  SampleOut = 0;
+
+				AudioInterfaceInfo->State.SampleOut   = SampleOut;
+				AudioInterfaceInfo->State.SampleCount = (SampleCount - 1);
+				AudioInterfaceInfo->State.SamplesTransferred++;
+
+				return Sample;
+			}
+
+			/** Writes the next 16-bit audio sample to the sample buffer of the given audio interface, in the buffered streaming
+			 *  mode. The sample is discarded if the buffer is full.
+			 *
+			 *  \note This function must only be called from the application's sample timer ISR, or with global interrupts disabled.
+			 *
+			 *  \param[in,out] AudioInterfaceInfo  Pointer to a structure containing an Audio Class configuration and state.
+			 *  \param[in]     Sample              Signed 16-bit audio sample.
+			 */
+			static inline void Audio_Device_WriteBufferedSample16(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo,
+			                                                      const int16_t Sample) ATTR_NON_NULL_PTR_ARG(1) ATTR_ALWAYS_INLINE;
+			static inline void Audio_Device_WriteBufferedSample16(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo,
+			                                                      const int16_t Sample)
+			{
+				uint16_t SampleCount = AudioInterfaceInfo->State.SampleCount;
+
+				if (SampleCount == AudioInterfaceInfo->Config.SampleBufferSize)
+				{
+					AudioInterfaceInfo->State.OverrunCount++;
+					return;
+				}
+
+				uint16_t SampleIn = AudioInterfaceInfo->State.SampleIn;
+
+				AudioInterfaceInfo->Config.SampleBuffer[SampleIn] = Sample;
+
+				if (++SampleIn == AudioInterfaceInfo->Config.SampleBufferSize)
+				  SampleIn = 0;
+
+				AudioInterfaceInfo->State.SampleIn    = SampleIn;
+				AudioInterfaceInfo->State.SampleCount = (SampleCount + 1);
+				AudioInterfaceInfo->State.SamplesTransferred++;
 			}
 
 			/** Determines if the given audio interface is ready for a sample to be read from it, and selects the streaming
@@ -381,6 +511,19 @@
 
 				void EVENT_Audio_Device_StreamStartStop(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
 				                                        ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1) ATTR_ALIAS(Audio_Device_Event_Stub);
+
+				static void Audio_Device_ResetSampleBuffer(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+				                                           ATTR_NON_NULL_PTR_ARG(1);
+				static void Audio_Device_ReceiveBufferedSamples(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+				                                                ATTR_NON_NULL_PTR_ARG(1);
+				static void Audio_Device_SendBufferedSamples(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+				                                             ATTR_NON_NULL_PTR_ARG(1);
+				static void Audio_Device_SendRateFeedback(USB_ClassInfo_Audio_Device_t* const AudioInterfaceInfo)
+				                                          ATTR_NON_NULL_PTR_ARG(1);
+
+				#if defined(DEVICE_MAX_INTERFACES)
+				static void Audio_Device_ControlRequestHandler(void* const InterfaceInfo);
+				#endif
 			#endif
 
 	#endif
@@ -129,6 +129,23 @@ bool CDC_Device_ConfigureEndpoints(USB_ClassInfo_CDC_Device_t* const CDCInterfac
 	if (!(Endpoint_ConfigureEndpointTable(&CDCInterfaceInfo->Config.NotificationEndpoint, 1)))
 	  return false;
 
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	if (!(Endpoint_SetCompletionHandler(CDCInterfaceInfo->Config.DataOUTEndpoint.Address,
+	                                    CDC_Device_DataOUTHandler, CDCInterfaceInfo)))
+	{
+		return false;
+	}
+	#endif
+
+	#if defined(DEVICE_MAX_INTERFACES)
+	if (!(USB_Device_SetControlRequestHandler(CDCInterfaceInfo->Config.ControlInterfaceNumber,
+	                                          CDC_Device_ControlRequestHandler,
+	                                          CDCInterfaceInfo)))
+	{
+		return false;
+	}
+	#endif
+
 	return true;
 }
 
@@ -137,6 +154,10 @@ void CDC_Device_USBTask(USB_ClassInfo_CDC_Device_t* const CDCInterfaceInfo)
 	if ((USB_DeviceState != DEVICE_STATE_Configured) || !(CDCInterfaceInfo->State.LineEncoding.BaudRateBPS))
 	  return;
 
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	Endpoint_EnableCompletionInterrupt(CDCInterfaceInfo->Config.DataOUTEndpoint.Address);
+	#endif
+
 	#if !defined(NO_CLASS_DRIVER_AUTOFLUSH)
 	Endpoint_SelectEndpoint(CDCInterfaceInfo->Config.DataINEndpoint.Address);
 
@@ -353,10 +374,25 @@ static int CDC_Device_getchar_Blocking(FILE* Stream)
 }
 #endif
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+static bool CDC_Device_DataOUTHandler(const uint8_t Address,
+                                      void* const Context)
+{
+	EVENT_CDC_Device_DataReceived((USB_ClassInfo_CDC_Device_t*)Context);
+
+	Endpoint_SelectEndpoint(Address);
+	return !(Endpoint_IsOUTReceived());
+}
+#endif
+
 void CDC_Device_Event_Stub(void)
 {
 
 }
 
+#if defined(DEVICE_MAX_INTERFACES)
+USB_DEVICE_CONTROL_REQUEST_HANDLER(CDC_Device_ControlRequestHandler, USB_ClassInfo_CDC_Device_t, CDC_Device_ProcessControlRequest)
+#endif
+
 #endif
 
@@ -150,6 +150,9 @@
 			/** General management task for a given CDC class interface, required for the correct operation of the interface. This should
 			 *  be called frequently in the main program loop, before the master USB management task \ref USB_USBTask().
 			 *
+			 *  When the \c INTERRUPT_DATA_ENDPOINTS token is defined, this also re-enables the \ref EVENT_CDC_Device_DataReceived()
+			 *  event if it was disabled due to unread data.
+			 *
 			 *  \param[in,out] CDCInterfaceInfo  Pointer to a structure containing a CDC Class configuration and state.
 			 */
 			void CDC_Device_USBTask(USB_ClassInfo_CDC_Device_t* const CDCInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
@@ -182,6 +185,20 @@
 			void EVENT_CDC_Device_BreakSent(USB_ClassInfo_CDC_Device_t* const CDCInterfaceInfo,
 			                                const uint8_t Duration) ATTR_NON_NULL_PTR_ARG(1);
 
+			#if defined(INTERRUPT_DATA_ENDPOINTS) || defined(__DOXYGEN__)
+				/** CDC class driver event for the reception of data from the host on a CDC interface. This event fires from the USB
+				 *  controller interrupt each time a packet is received on the interface's data OUT endpoint, so that received data can
+				 *  be processed without waiting for the main program loop. Data should be read from the interface inside the event
+				 *  via \ref CDC_Device_ReceiveByte(); any data left unread disables the event until the next call to
+				 *  \ref CDC_Device_USBTask(), so that its processing can be deferred to the main program loop.
+				 *
+				 *  \note Only available when the \c INTERRUPT_DATA_ENDPOINTS token is defined.
+				 *
+				 *  \param[in,out] CDCInterfaceInfo  Pointer to a structure containing a CDC Class configuration and state.
+				 */
+				void EVENT_CDC_Device_DataReceived(USB_ClassInfo_CDC_Device_t* const CDCInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+			#endif
+
 			/** Sends a given data buffer to the attached USB host, if connected. If a host is not connected when the function is
 			 *  called, the string is discarded. Bytes will be queued for transmission to the host until either the endpoint bank
 			 *  becomes full, or the \ref CDC_Device_Flush() function is called to flush the pending data to the host. This allows
@@ -371,6 +388,18 @@
 				void EVENT_CDC_Device_BreakSent(USB_ClassInfo_CDC_Device_t* const CDCInterfaceInfo,
 				                                const uint8_t Duration) ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1)
 				                                ATTR_ALIAS(CDC_Device_Event_Stub);
+
+				#if defined(INTERRUPT_DATA_ENDPOINTS)
+				static bool CDC_Device_DataOUTHandler(const uint8_t Address,
+				                                      void* const Context);
+
+				void EVENT_CDC_Device_DataReceived(USB_ClassInfo_CDC_Device_t* const CDCInterfaceInfo)
+				                                   ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1) ATTR_ALIAS(CDC_Device_Event_Stub);
+				#endif
+
+				#if defined(DEVICE_MAX_INTERFACES)
+				static void CDC_Device_ControlRequestHandler(void* const InterfaceInfo);
+				#endif
 			#endif
 
 	#endif
@@ -57,6 +57,12 @@ void HID_Device_ProcessControlRequest(USB_ClassInfo_HID_Device_t* const HIDInter
 
 				memset(ReportData, 0, sizeof(ReportData));
 
+				#if defined(INTERRUPT_DATA_ENDPOINTS)
+				/* Mask the report endpoint's interrupt so that the report callback and previous report buffer are never
+				 * re-entered from the endpoint's completion handler while being used here */
+				Endpoint_DisableCompletionInterrupt(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+				#endif
+
 				CALLBACK_HID_Device_CreateHIDReport(HIDInterfaceInfo, &ReportID, ReportType, ReportData, &ReportSize);
 
 				if (HIDInterfaceInfo->Config.PrevReportINBuffer != NULL)
@@ -65,6 +71,11 @@ void HID_Device_ProcessControlRequest(USB_ClassInfo_HID_Device_t* const HIDInter
 					       HIDInterfaceInfo->Config.PrevReportINBufferSize);
 				}
 
+				#if defined(INTERRUPT_DATA_ENDPOINTS)
+				if (USB_DeviceState == DEVICE_STATE_Configured)
+				  Endpoint_EnableCompletionInterrupt(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+				#endif
+
 				Endpoint_SelectEndpoint(ENDPOINT_CONTROLEP);
 
 				Endpoint_ClearSETUP();
@@ -150,6 +161,23 @@ bool HID_Device_ConfigureEndpoints(USB_ClassInfo_HID_Device_t* const HIDInterfac
 	if (!(Endpoint_ConfigureEndpointTable(&HIDInterfaceInfo->Config.ReportINEndpoint, 1)))
 	  return false;
 
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	if (!(Endpoint_SetCompletionHandler(HIDInterfaceInfo->Config.ReportINEndpoint.Address,
+	                                    HID_Device_ReportINHandler, HIDInterfaceInfo)))
+	{
+		return false;
+	}
+	#endif
+
+	#if defined(DEVICE_MAX_INTERFACES)
+	if (!(USB_Device_SetControlRequestHandler(HIDInterfaceInfo->Config.InterfaceNumber,
+	                                          HID_Device_ControlRequestHandler,
+	                                          HIDInterfaceInfo)))
+	{
+		return false;
+	}
+	#endif
+
 	return true;
 }
 
@@ -158,6 +186,19 @@ void HID_Device_USBTask(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo)
 	if (USB_DeviceState != DEVICE_STATE_Configured)
 	  return;
 
+	if (HIDInterfaceInfo->Config.ReportQueue != NULL)
+	{
+		#if defined(INTERRUPT_DATA_ENDPOINTS)
+		if (HID_Device_QueuedReports(HIDInterfaceInfo))
+		  Endpoint_EnableCompletionInterrupt(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+		#else
+		Endpoint_SelectEndpoint(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+		HID_Device_SendQueuedReports(HIDInterfaceInfo);
+		#endif
+
+		return;
+	}
+
 	if (HIDInterfaceInfo->State.PrevFrameNum == USB_Device_GetFrameNumber())
 	{
 		#if defined(USB_DEVICE_OPT_LOWSPEED)
@@ -168,44 +209,168 @@ void HID_Device_USBTask(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo)
 		#endif
 	}
 
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	Endpoint_EnableCompletionInterrupt(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+	#else
 	Endpoint_SelectEndpoint(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
 
 	if (Endpoint_IsReadWriteAllowed())
-	{
-		uint8_t  ReportINData[HIDInterfaceInfo->Config.PrevReportINBufferSize];
-		uint8_t  ReportID     = 0;
-		uint16_t ReportINSize = 0;
+	  HID_Device_SendReportIN(HIDInterfaceInfo);
+	#endif
+}
+
+static bool HID_Device_SendReportIN(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo)
+{
+	uint8_t  ReportINData[HIDInterfaceInfo->Config.PrevReportINBufferSize];
+	uint8_t  ReportID     = 0;
+	uint16_t ReportINSize = 0;
+	bool     ReportSent   = false;
+
+	bool StatesChanged     = false;
+	bool IdlePeriodElapsed = (HIDInterfaceInfo->State.IdleCount && !(HIDInterfaceInfo->State.IdleMSRemaining));
 
-		memset(ReportINData, 0, sizeof(ReportINData));
+	if (HIDInterfaceInfo->Config.TrackReportChanges)
+	{
+		uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+		GlobalInterruptDisable();
 
-		bool ForceSend         = CALLBACK_HID_Device_CreateHIDReport(HIDInterfaceInfo, &ReportID, HID_REPORT_ITEM_In,
-		                                                             ReportINData, &ReportINSize);
-		bool StatesChanged     = false;
-		bool IdlePeriodElapsed = (HIDInterfaceInfo->State.IdleCount && !(HIDInterfaceInfo->State.IdleMSRemaining));
+		HID_ReportMask_t ChangedReports = HIDInterfaceInfo->State.ChangedReports;
 
-		if (HIDInterfaceInfo->Config.PrevReportINBuffer != NULL)
+		/* Take the lowest numbered flagged report, leaving any others for later frames */
+		if (ChangedReports)
 		{
-			StatesChanged = (memcmp(ReportINData, HIDInterfaceInfo->Config.PrevReportINBuffer, ReportINSize) != 0);
-			memcpy(HIDInterfaceInfo->Config.PrevReportINBuffer, ReportINData, HIDInterfaceInfo->Config.PrevReportINBufferSize);
+			while (!(ChangedReports & ((HID_ReportMask_t)1 << ReportID)))
+			  ReportID++;
+
+			HIDInterfaceInfo->State.ChangedReports = (ChangedReports & ~((HID_ReportMask_t)1 << ReportID));
 		}
 
-		if (ReportINSize && (ForceSend || StatesChanged || IdlePeriodElapsed))
+		SetGlobalInterruptMask(CurrentGlobalInt);
+
+		/* Nothing has changed and the idle period is still running, so no report needs to be created at all */
+		if (!(ChangedReports) && !(IdlePeriodElapsed))
 		{
-			HIDInterfaceInfo->State.IdleMSRemaining = HIDInterfaceInfo->State.IdleCount;
+			HIDInterfaceInfo->State.PrevFrameNum = USB_Device_GetFrameNumber();
+			return false;
+		}
 
-			Endpoint_SelectEndpoint(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+		StatesChanged = true;
+	}
 
-			if (ReportID)
-			  Endpoint_Write_8(ReportID);
+	memset(ReportINData, 0, sizeof(ReportINData));
 
-			Endpoint_Write_Stream_LE(ReportINData, ReportINSize, NULL);
+	bool ForceSend = CALLBACK_HID_Device_CreateHIDReport(HIDInterfaceInfo, &ReportID, HID_REPORT_ITEM_In,
+	                                                     ReportINData, &ReportINSize);
 
-			Endpoint_ClearIN();
-		}
+	if (!(HIDInterfaceInfo->Config.TrackReportChanges) && (HIDInterfaceInfo->Config.PrevReportINBuffer != NULL))
+	{
+		StatesChanged = (memcmp(ReportINData, HIDInterfaceInfo->Config.PrevReportINBuffer, ReportINSize) != 0);
+		memcpy(HIDInterfaceInfo->Config.PrevReportINBuffer, ReportINData, HIDInterfaceInfo->Config.PrevReportINBufferSize);
+	}
+
+	if (ReportINSize && (ForceSend || StatesChanged || IdlePeriodElapsed))
+	{
+		HIDInterfaceInfo->State.IdleMSRemaining = HIDInterfaceInfo->State.IdleCount;
+
+		Endpoint_SelectEndpoint(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+
+		if (ReportID)
+		  Endpoint_Write_8(ReportID);
+
+		Endpoint_Write_Stream_LE(ReportINData, ReportINSize, NULL);
+
+		Endpoint_ClearIN();
+
+		ReportSent = true;
+	}
 
-		HIDInterfaceInfo->State.PrevFrameNum = USB_Device_GetFrameNumber();
+	HIDInterfaceInfo->State.PrevFrameNum = USB_Device_GetFrameNumber();
+
+	return ReportSent;
+}
+
+bool HID_Device_QueueReport(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo,
+                            const void* const ReportData)
+{
+	uint8_t QueueIn = HIDInterfaceInfo->State.ReportQueueIn;
+
+	if ((uint8_t)(QueueIn - HIDInterfaceInfo->State.ReportQueueOut) == HIDInterfaceInfo->Config.ReportQueueDepth)
+	{
+		HIDInterfaceInfo->State.ReportsDropped++;
+		return false;
+	}
+
+	uint8_t  ReportSize = HIDInterfaceInfo->Config.PrevReportINBufferSize;
+	uint8_t* QueueSlot  = (uint8_t*)HIDInterfaceInfo->Config.ReportQueue +
+	                      ((uint16_t)(QueueIn & (HIDInterfaceInfo->Config.ReportQueueDepth - 1)) * ReportSize);
+
+	memcpy(QueueSlot, ReportData, ReportSize);
+	HIDInterfaceInfo->State.ReportQueueIn = (QueueIn + 1);
+
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	if (USB_DeviceState == DEVICE_STATE_Configured)
+	  Endpoint_EnableCompletionInterrupt(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+	#endif
+
+	return true;
+}
+
+void HID_Device_MarkReportsChanged(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo,
+                                   const HID_ReportMask_t ReportMask)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	HIDInterfaceInfo->State.ChangedReports |= ReportMask;
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	if (USB_DeviceState == DEVICE_STATE_Configured)
+	  Endpoint_EnableCompletionInterrupt(HIDInterfaceInfo->Config.ReportINEndpoint.Address);
+	#endif
+}
+
+static bool HID_Device_SendQueuedReports(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo)
+{
+	uint8_t ReportSize = HIDInterfaceInfo->Config.PrevReportINBufferSize;
+	uint8_t QueueOut   = HIDInterfaceInfo->State.ReportQueueOut;
+
+	/* Load a queued report into every free endpoint bank, so that each IN token from the host is answered with data */
+	while (Endpoint_IsINReady())
+	{
+		if (HIDInterfaceInfo->State.ReportQueueIn == QueueOut)
+		  return false;
+
+		uint8_t* QueueSlot = (uint8_t*)HIDInterfaceInfo->Config.ReportQueue +
+		                     ((uint16_t)(QueueOut & (HIDInterfaceInfo->Config.ReportQueueDepth - 1)) * ReportSize);
+
+		Endpoint_Write_Stream_LE(QueueSlot, ReportSize, NULL);
+		Endpoint_ClearIN();
+
+		HIDInterfaceInfo->State.ReportQueueOut = ++QueueOut;
+		HIDInterfaceInfo->State.ReportsSent++;
 	}
+
+	return true;
 }
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+static bool HID_Device_ReportINHandler(const uint8_t Address,
+                                       void* const Context)
+{
+	USB_ClassInfo_HID_Device_t* HIDInterfaceInfo = (USB_ClassInfo_HID_Device_t*)Context;
+
+	if (HIDInterfaceInfo->Config.ReportQueue != NULL)
+	  return HID_Device_SendQueuedReports(HIDInterfaceInfo);
+
+	return HID_Device_SendReportIN(HIDInterfaceInfo);
+}
+#endif
+
+#if defined(DEVICE_MAX_INTERFACES)
+USB_DEVICE_CONTROL_REQUEST_HANDLER(HID_Device_ControlRequestHandler, USB_ClassInfo_HID_Device_t, HID_Device_ProcessControlRequest)
+#endif
+
 #endif
 
@@ -47,6 +47,18 @@
  *  \section Sec_USBClassHIDDevice_ModDescription Module Description
  *  Device Mode USB Class driver framework interface, for the HID USB Class driver.
  *
+ *  By default, \ref HID_Device_USBTask() requests at most one new IN report from the application per USB frame via
+ *  \ref CALLBACK_HID_Device_CreateHIDReport(), and only sends it if it has changed or the idle period has elapsed. For
+ *  data streaming applications the driver also supports a report queue mode, enabled by supplying a \c ReportQueue
+ *  buffer in the interface configuration. In this mode the application pushes complete reports into the queue via
+ *  \ref HID_Device_QueueReport(), and the driver sends one queued report for every IN token the host issues, filling
+ *  every bank of the report endpoint ahead of time so that each polling interval (down to the minimum 1ms) is used.
+ *
+ *  Devices whose reports only change in response to input events can instead enable report change tracking in the
+ *  interface configuration. In this mode the application flags changed reports via \ref HID_Device_MarkReportsChanged(),
+ *  and the driver only requests a new report from the application when a report has been flagged or the idle period has
+ *  elapsed, skipping both the creation of unchanged reports and their comparison against the previous report.
+ *
  *  @{
  */
 
@@ -67,8 +79,34 @@
 			#error Do not include this file directly. Include LUFA/Drivers/USB.h instead.
 		#endif
 
+		#if defined(HID_MAX_CHANGED_REPORT_ID) && ((HID_MAX_CHANGED_REPORT_ID < 0) || (HID_MAX_CHANGED_REPORT_ID > 31))
+			#error HID_MAX_CHANGED_REPORT_ID must be between 0 and 31.
+		#endif
+
 	/* Public Interface - May be used in end-application: */
+		/* Macros: */
+			#if !defined(HID_MAX_CHANGED_REPORT_ID) || defined(__DOXYGEN__)
+				/** Highest report ID which may be flagged as changed via \ref HID_Device_MarkReportsChanged(), which sets the
+				 *  width of the \ref HID_ReportMask_t changed report mask type to the smallest of 8, 16 or 32 bits that can hold it.
+				 *
+				 *  The default value may be overridden in the user project makefile by defining the \c HID_MAX_CHANGED_REPORT_ID
+				 *  token to the highest report ID used by the device's HID interfaces, and passed to the compiler using the -D switch.
+				 */
+				#define HID_MAX_CHANGED_REPORT_ID      7
+			#endif
+
 		/* Type Defines: */
+			#if (HID_MAX_CHANGED_REPORT_ID < 8) || defined(__DOXYGEN__)
+				/** Type define for a mask of HID report IDs, where bit N corresponds to report ID N. This is sized to fit
+				 *  report IDs up to \ref HID_MAX_CHANGED_REPORT_ID.
+				 */
+				typedef uint8_t HID_ReportMask_t;
+			#elif (HID_MAX_CHANGED_REPORT_ID < 16)
+				typedef uint16_t HID_ReportMask_t;
+			#else
+				typedef uint32_t HID_ReportMask_t;
+			#endif
+
 			/** \brief HID Class Device Mode Configuration and State Structure.
 			 *
 			 *  Class state structure. An instance of this structure should be made for each HID interface
@@ -105,6 +143,21 @@
 					                                  *  exclusively (i.e. \c PrevReportINBuffer is \c NULL) this value must still be
 					                                  *  set to the size of the largest report the device can issue to the host.
 					                                  */
+
+					void*    ReportQueue; /**< Pointer to a buffer for the report queue mode, large enough to hold \c ReportQueueDepth
+					                       *   reports of \c PrevReportINBufferSize bytes each, or \c NULL if the report queue mode is
+					                       *   not used. In the report queue mode, IN reports are only sent from the queue, and
+					                       *   \ref CALLBACK_HID_Device_CreateHIDReport() is only called for GET_REPORT control requests.
+					                       */
+					uint8_t  ReportQueueDepth; /**< Number of reports that can be stored in the \c ReportQueue buffer. This must be a
+					                            *   power of two no larger than 128.
+					                            */
+
+					bool     TrackReportChanges; /**< If set, IN reports are only created when flagged as changed by the application via
+					                              *   \ref HID_Device_MarkReportsChanged(), or when the idle period elapses, rather than
+					                              *   being created and compared against \c PrevReportINBuffer each frame. In this mode
+					                              *   \c PrevReportINBuffer is not used and may be \c NULL.
+					                              */
 				} Config; /**< Config data for the USB class interface within the device. All elements in this section
 				           *   <b>must</b> be set or the interface will fail to enumerate and operate correctly.
 				           */
@@ -115,6 +168,13 @@
 					uint16_t IdleCount; /**< Report idle period, in milliseconds, set by the host. */
 					uint16_t IdleMSRemaining; /**< Total number of milliseconds remaining before the idle period elapsed - this
 				                               *   should be decremented by the user application if non-zero each millisecond. */
+					volatile uint8_t ReportQueueIn; /**< Running count of reports added to the report queue, modulo 256. */
+					volatile uint8_t ReportQueueOut; /**< Running count of reports sent from the report queue, modulo 256. */
+					uint16_t ReportsSent; /**< Number of reports sent to the host from the report queue. */
+					uint16_t ReportsDropped; /**< Number of reports discarded by \ref HID_Device_QueueReport() due to a full report queue. */
+					volatile HID_ReportMask_t ChangedReports; /**< Mask of reports flagged as changed via \ref HID_Device_MarkReportsChanged(),
+					                                           *   one bit per report ID.
+					                                           */
 				} State; /**< State data for the USB class interface within the device. All elements in this section
 				          *   are reset to their defaults when the interface is enumerated.
 				          */
@@ -141,16 +201,60 @@
 			/** General management task for a given HID class interface, required for the correct operation of the interface. This should
 			 *  be called frequently in the main program loop, before the master USB management task \ref USB_USBTask().
 			 *
+			 *  When the \c INTERRUPT_DATA_ENDPOINTS token is defined, IN reports are instead created and sent from the USB controller
+			 *  interrupt as soon as the report endpoint is ready, and this function only re-enables the endpoint's interrupt once per
+			 *  frame after an unchanged report was discarded.
+			 *
+			 *  In the report queue mode, this sends queued reports into every free bank of the report endpoint, or when the
+			 *  \c INTERRUPT_DATA_ENDPOINTS token is defined, re-enables the endpoint's interrupt while reports are queued.
+			 *
 			 *  \param[in,out] HIDInterfaceInfo  Pointer to a structure containing a HID Class configuration and state.
 			 */
 			void HID_Device_USBTask(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
 
+			/** Adds a complete IN report to the report queue of the given HID interface, to be sent to the host at the next
+			 *  available IN opportunity of the report endpoint. This may only be used when a \c ReportQueue buffer has been
+			 *  set in the interface configuration.
+			 *
+			 *  \note Reports are always sent with a length of \c PrevReportINBufferSize bytes. If the interface uses report
+			 *        IDs, the report ID must be included as the first byte of the report data.
+			 *
+			 *  \param[in,out] HIDInterfaceInfo  Pointer to a structure containing a HID Class configuration and state.
+			 *  \param[in]     ReportData        Pointer to the report data to queue, of \c PrevReportINBufferSize bytes.
+			 *
+			 *  \return Boolean \c true if the report was queued, \c false if the queue was full and the report was discarded.
+			 */
+			bool HID_Device_QueueReport(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo,
+			                            const void* const ReportData) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+
+			/** Flags one or more IN reports of the given HID interface as changed, so that they are created and sent to the host
+			 *  at the next IN opportunity of the report endpoint. Flagged reports are created one per frame in ascending report ID
+			 *  order, with the report ID preset in the \ref CALLBACK_HID_Device_CreateHIDReport() callback. This may only be used
+			 *  when \c TrackReportChanges has been set in the interface configuration, and may be called from an interrupt.
+			 *
+			 *  \note Only report IDs up to \ref HID_MAX_CHANGED_REPORT_ID can be flagged; the \c HID_MAX_CHANGED_REPORT_ID token
+			 *        must be raised for interfaces which send reports with higher IDs.
+			 *
+			 *  \param[in,out] HIDInterfaceInfo  Pointer to a structure containing a HID Class configuration and state.
+			 *  \param[in]     ReportMask        Mask of changed reports, where bit N corresponds to report ID N. Interfaces which
+			 *                                   do not use report IDs should use a mask of \c 0x01.
+			 */
+			void HID_Device_MarkReportsChanged(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo,
+			                                   const HID_ReportMask_t ReportMask) ATTR_NON_NULL_PTR_ARG(1);
+
 			/** HID class driver callback for the user creation of a HID IN report. This callback may fire in response to either
 			 *  HID class control requests from the host, or by the normal HID endpoint polling procedure. Inside this callback the
 			 *  user is responsible for the creation of the next HID input report to be sent to the host.
 			 *
+			 *  \note When the \c INTERRUPT_DATA_ENDPOINTS token is defined, this callback is run from the USB controller interrupt
+			 *        when creating reports for the report IN endpoint. It must then be interrupt safe: it should only read data
+			 *        which is updated atomically by the application, and must not block or wait on other interrupts. The driver
+			 *        masks the report endpoint's interrupt while the callback is run for a GET_REPORT control request, so the
+			 *        callback is never re-entered for the same interface, regardless of the \c INTERRUPT_CONTROL_ENDPOINT token.
+			 *
 			 *  \param[in,out] HIDInterfaceInfo  Pointer to a structure containing a HID Class configuration and state.
-			 *  \param[in,out] ReportID          If preset to a non-zero value, this is the report ID being requested by the host. If zero,
+			 *  \param[in,out] ReportID          If preset to a non-zero value, this is the report ID being requested by the host (or flagged
+			 *                                   as changed via \ref HID_Device_MarkReportsChanged()). If zero,
 			 *                                   this should be set to the report ID of the generated HID input report (if any). If multiple
 			 *                                   reports are not sent via the given HID interface, this parameter should be ignored.
 			 *  \param[in]     ReportType        Type of HID report to generate, either \ref HID_REPORT_ITEM_In or \ref HID_REPORT_ITEM_Feature.
@@ -199,6 +303,36 @@
 				  HIDInterfaceInfo->State.IdleMSRemaining--;
 			}
 
+			/** Retrieves the number of reports waiting to be sent in the report queue of the given HID interface.
+			 *
+			 *  \param[in,out] HIDInterfaceInfo  Pointer to a structure containing a HID Class configuration and state.
+			 *
+			 *  \return Number of reports currently queued.
+			 */
+			static inline uint8_t HID_Device_QueuedReports(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo) ATTR_ALWAYS_INLINE ATTR_NON_NULL_PTR_ARG(1);
+			static inline uint8_t HID_Device_QueuedReports(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo)
+			{
+				return (uint8_t)(HIDInterfaceInfo->State.ReportQueueIn - HIDInterfaceInfo->State.ReportQueueOut);
+			}
+
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Function Prototypes: */
+			#if defined(__INCLUDE_FROM_HID_DEVICE_C)
+				static bool HID_Device_SendReportIN(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+				static bool HID_Device_SendQueuedReports(USB_ClassInfo_HID_Device_t* const HIDInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+
+				#if defined(INTERRUPT_DATA_ENDPOINTS)
+					static bool HID_Device_ReportINHandler(const uint8_t Address,
+					                                       void* const Context);
+				#endif
+
+				#if defined(DEVICE_MAX_INTERFACES)
+					static void HID_Device_ControlRequestHandler(void* const InterfaceInfo);
+				#endif
+			#endif
+	#endif
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
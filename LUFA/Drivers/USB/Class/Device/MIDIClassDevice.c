@@ -61,13 +61,33 @@ void MIDI_Device_USBTask(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo)
 	#if !defined(NO_CLASS_DRIVER_AUTOFLUSH)
 	Endpoint_SelectEndpoint(MIDIInterfaceInfo->Config.DataINEndpoint.Address);
 
-	if (Endpoint_IsINReady())
-	  MIDI_Device_Flush(MIDIInterfaceInfo);
+	if (!(Endpoint_IsINReady()))
+	  return;
+
+	if (MIDIInterfaceInfo->Config.FlushIntervalFrames)
+	{
+		uint16_t CurrentFrame = USB_Device_GetFrameNumber();
+		uint16_t ElapsedFrames = ((CurrentFrame - MIDIInterfaceInfo->State.LastFlushFrame) & MIDI_FRAME_NUMBER_MASK);
+
+		if (ElapsedFrames < MIDIInterfaceInfo->Config.FlushIntervalFrames)
+		  return;
+
+		MIDIInterfaceInfo->State.LastFlushFrame = CurrentFrame;
+	}
+
+	MIDI_Device_Flush(MIDIInterfaceInfo);
 	#endif
 }
 
 uint8_t MIDI_Device_SendEventPacket(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
                                     const MIDI_EventPacket_t* const Event)
+{
+	return MIDI_Device_SendEventPackets(MIDIInterfaceInfo, Event, 1);
+}
+
+uint8_t MIDI_Device_SendEventPackets(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
+                                     const MIDI_EventPacket_t* const Events,
+                                     const uint8_t TotalEvents)
 {
 	if (USB_DeviceState != DEVICE_STATE_Configured)
 	  return ENDPOINT_RWSTREAM_DeviceDisconnected;
@@ -76,7 +96,7 @@ uint8_t MIDI_Device_SendEventPacket(USB_ClassInfo_MIDI_Device_t* const MIDIInter
 
 	Endpoint_SelectEndpoint(MIDIInterfaceInfo->Config.DataINEndpoint.Address);
 
-	if ((ErrorCode = Endpoint_Write_Stream_LE(Event, sizeof(MIDI_EventPacket_t), NULL)) != ENDPOINT_RWSTREAM_NoError)
+	if ((ErrorCode = Endpoint_Write_Stream_LE(Events, (TotalEvents * sizeof(MIDI_EventPacket_t)), NULL)) != ENDPOINT_RWSTREAM_NoError)
 	  return ErrorCode;
 
 	if (!(Endpoint_IsReadWriteAllowed()))
@@ -107,24 +127,35 @@ uint8_t MIDI_Device_Flush(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo)
 
 bool MIDI_Device_ReceiveEventPacket(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
                                     MIDI_EventPacket_t* const Event)
+{
+	return (MIDI_Device_ReceiveEventPackets(MIDIInterfaceInfo, Event, 1) != 0);
+}
+
+uint8_t MIDI_Device_ReceiveEventPackets(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
+                                        MIDI_EventPacket_t* const Events,
+                                        const uint8_t MaxEvents)
 {
 	if (USB_DeviceState != DEVICE_STATE_Configured)
-	  return false;
+	  return 0;
 
 	Endpoint_SelectEndpoint(MIDIInterfaceInfo->Config.DataOUTEndpoint.Address);
 
 	if (!(Endpoint_IsOUTReceived()))
-		return false;
+	  return 0;
 
-	if (!(Endpoint_IsReadWriteAllowed()))
-	  return false;
+	uint16_t TotalEvents = (Endpoint_BytesInEndpoint() / sizeof(MIDI_EventPacket_t));
 
-	Endpoint_Read_Stream_LE(Event, sizeof(MIDI_EventPacket_t), NULL);
+	if (TotalEvents > MaxEvents)
+	  TotalEvents = MaxEvents;
 
-	if (!(Endpoint_IsReadWriteAllowed()))
+	if (TotalEvents)
+	  Endpoint_Read_Stream_LE(Events, (TotalEvents * sizeof(MIDI_EventPacket_t)), NULL);
+
+	/* Release the bank once all complete events have been read, discarding any incomplete trailing event */
+	if (Endpoint_BytesInEndpoint() < sizeof(MIDI_EventPacket_t))
 	  Endpoint_ClearOUT();
 
-	return true;
+	return TotalEvents;
 }
 
 #endif
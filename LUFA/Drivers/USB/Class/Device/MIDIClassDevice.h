@@ -83,13 +83,19 @@
 
 					USB_Endpoint_Table_t DataINEndpoint; /**< Data IN endpoint configuration table. */
 					USB_Endpoint_Table_t DataOUTEndpoint; /**< Data OUT endpoint configuration table. */
+
+					uint8_t  FlushIntervalFrames; /**< Minimum number of USB frames between automatic flushes of partially filled
+					                               *   IN endpoint banks by \ref MIDI_Device_USBTask(), so that dense event streams
+					                               *   are coalesced into full packets. Full banks are always sent immediately. If
+					                               *   zero, queued events are flushed on every call to \ref MIDI_Device_USBTask().
+					                               */
 				} Config; /**< Config data for the USB class interface within the device. All elements in this section
 				           *   <b>must</b> be set or the interface will fail to enumerate and operate correctly.
 				           */
 
 				struct
 				{
-					uint8_t RESERVED; // No state information for this class
+					uint16_t LastFlushFrame; /**< USB frame number of the last automatic flush of the IN endpoint. */
 				} State; /**< State data for the USB class interface within the device. All elements in this section
 				          *   are reset to their defaults when the interface is enumerated.
 				          */
@@ -128,6 +134,23 @@
 			uint8_t MIDI_Device_SendEventPacket(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
 			                                    const MIDI_EventPacket_t* const Event) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 
+			/** Sends an array of MIDI event packets to the host. If no host is connected, the event packets are discarded. The
+			 *  endpoint is selected once for the entire array and the events are written as a single stream, so that up to
+			 *  \ref MIDI_EVENTS_PER_PACKET() events are packed into each endpoint packet. Each endpoint bank is sent as soon as it
+			 *  is full; any remaining events are queued until the bank is full or \ref MIDI_Device_Flush() is called.
+			 *
+			 *  \pre This function must only be called when the Device state machine is in the \ref DEVICE_STATE_Configured state or
+			 *       the call will fail.
+			 *
+			 *  \param[in,out] MIDIInterfaceInfo  Pointer to a structure containing a MIDI Class configuration and state.
+			 *  \param[in]     Events             Pointer to an array of populated \ref MIDI_EventPacket_t structures to send.
+			 *  \param[in]     TotalEvents        Number of MIDI event packets in the array to send.
+			 *
+			 *  \return A value from the \ref Endpoint_Stream_RW_ErrorCodes_t enum.
+			 */
+			uint8_t MIDI_Device_SendEventPackets(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
+			                                     const MIDI_EventPacket_t* const Events,
+			                                     const uint8_t TotalEvents) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 
 			/** Flushes the MIDI send buffer, sending any queued MIDI events to the host. This should be called to override the
 			 *  \ref MIDI_Device_SendEventPacket() function's packing behavior, to flush queued events.
@@ -152,6 +175,24 @@
 			bool MIDI_Device_ReceiveEventPacket(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
 			                                    MIDI_EventPacket_t* const Event) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 
+			/** Receives up to the given number of MIDI event packets from the host in a single call. The events still waiting in
+			 *  the current OUT endpoint bank are read as a single stream, and the bank is released once it has been emptied. An
+			 *  array of \ref MIDI_EVENTS_PER_PACKET() events is sufficient to empty a full endpoint bank in one call.
+			 *
+			 *  \pre This function must only be called when the Device state machine is in the \ref DEVICE_STATE_Configured state or
+			 *       the call will fail.
+			 *
+			 *  \param[in,out] MIDIInterfaceInfo  Pointer to a structure containing a MIDI Class configuration and state.
+			 *  \param[out]    Events             Pointer to an array of \ref MIDI_EventPacket_t structures where the received events
+			 *                                    are to be placed.
+			 *  \param[in]     MaxEvents          Maximum number of MIDI event packets to store into the array.
+			 *
+			 *  \return Number of MIDI event packets received, zero if no events were received.
+			 */
+			uint8_t MIDI_Device_ReceiveEventPackets(USB_ClassInfo_MIDI_Device_t* const MIDIInterfaceInfo,
+			                                        MIDI_EventPacket_t* const Events,
+			                                        const uint8_t MaxEvents) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+
 		/* Inline Functions: */
 			/** Processes incoming control requests from the host, that are directed to the given MIDI class interface. This should be
 			 *  linked to the library \ref EVENT_USB_Device_ControlRequest() event.
@@ -84,6 +84,15 @@ bool MS_Device_ConfigureEndpoints(USB_ClassInfo_MS_Device_t* const MSInterfaceIn
 	if (!(Endpoint_ConfigureEndpointTable(&MSInterfaceInfo->Config.DataOUTEndpoint, 1)))
 	  return false;
 
+	#if defined(DEVICE_MAX_INTERFACES)
+	if (!(USB_Device_SetControlRequestHandler(MSInterfaceInfo->Config.InterfaceNumber,
+	                                          MS_Device_ControlRequestHandler,
+	                                          MSInterfaceInfo)))
+	{
+		return false;
+	}
+	#endif
+
 	return true;
 }
 
@@ -211,5 +220,9 @@ static void MS_Device_ReturnCommandStatus(USB_ClassInfo_MS_Device_t* const MSInt
 	Endpoint_ClearIN();
 }
 
+#if defined(DEVICE_MAX_INTERFACES)
+USB_DEVICE_CONTROL_REQUEST_HANDLER(MS_Device_ControlRequestHandler, USB_ClassInfo_MS_Device_t, MS_Device_ProcessControlRequest)
+#endif
+
 #endif
 
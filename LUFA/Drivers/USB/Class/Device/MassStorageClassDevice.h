@@ -146,6 +146,10 @@
 			#if defined(__INCLUDE_FROM_MASSSTORAGE_DEVICE_C)
 				static void MS_Device_ReturnCommandStatus(USB_ClassInfo_MS_Device_t* const MSInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
 				static bool MS_Device_ReadInCommandBlock(USB_ClassInfo_MS_Device_t* const MSInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+
+				#if defined(DEVICE_MAX_INTERFACES)
+				static void MS_Device_ControlRequestHandler(void* const InterfaceInfo);
+				#endif
 			#endif
 
 	#endif
@@ -110,6 +110,15 @@ bool PRNT_Device_ConfigureEndpoints(USB_ClassInfo_PRNT_Device_t* const PRNTInter
 	if (!(Endpoint_ConfigureEndpointTable(&PRNTInterfaceInfo->Config.DataOUTEndpoint, 1)))
 	  return false;
 
+	#if defined(DEVICE_MAX_INTERFACES)
+	if (!(USB_Device_SetControlRequestHandler(PRNTInterfaceInfo->Config.InterfaceNumber,
+	                                          PRNT_Device_ControlRequestHandler,
+	                                          PRNTInterfaceInfo)))
+	{
+		return false;
+	}
+	#endif
+
 	return true;
 }
 
@@ -310,5 +319,9 @@ void PRNT_Device_Event_Stub(void)
 
 }
 
+#if defined(DEVICE_MAX_INTERFACES)
+USB_DEVICE_CONTROL_REQUEST_HANDLER(PRNT_Device_ControlRequestHandler, USB_ClassInfo_PRNT_Device_t, PRNT_Device_ProcessControlRequest)
+#endif
+
 #endif
 
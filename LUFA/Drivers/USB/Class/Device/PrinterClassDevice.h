@@ -278,6 +278,10 @@
 				void EVENT_PRNT_Device_SoftReset(USB_ClassInfo_PRNT_Device_t* const PRNTInterfaceInfo)
 				                                 ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1) ATTR_ALIAS(PRNT_Device_Event_Stub);
 
+				#if defined(DEVICE_MAX_INTERFACES)
+				static void PRNT_Device_ControlRequestHandler(void* const InterfaceInfo);
+				#endif
+
 			#endif
 
 	#endif
@@ -134,6 +134,15 @@ bool RNDIS_Device_ConfigureEndpoints(USB_ClassInfo_RNDIS_Device_t* const RNDISIn
 	if (!(Endpoint_ConfigureEndpointTable(&RNDISInterfaceInfo->Config.NotificationEndpoint, 1)))
 	  return false;
 
+	#if defined(DEVICE_MAX_INTERFACES)
+	if (!(USB_Device_SetControlRequestHandler(RNDISInterfaceInfo->Config.ControlInterfaceNumber,
+	                                          RNDIS_Device_ControlRequestHandler,
+	                                          RNDISInterfaceInfo)))
+	{
+		return false;
+	}
+	#endif
+
 	return true;
 }
 
@@ -504,5 +513,9 @@ uint8_t RNDIS_Device_SendPacket(USB_ClassInfo_RNDIS_Device_t* const RNDISInterfa
 	return ENDPOINT_RWSTREAM_NoError;
 }
 
+#if defined(DEVICE_MAX_INTERFACES)
+USB_DEVICE_CONTROL_REQUEST_HANDLER(RNDIS_Device_ControlRequestHandler, USB_ClassInfo_RNDIS_Device_t, RNDIS_Device_ProcessControlRequest)
+#endif
+
 #endif
 
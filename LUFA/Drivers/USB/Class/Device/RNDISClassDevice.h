@@ -192,6 +192,10 @@
 			                                        const void* SetData,
                                                     const uint16_t SetSize) ATTR_NON_NULL_PTR_ARG(1)
 			                                        ATTR_NON_NULL_PTR_ARG(3);
+
+			#if defined(DEVICE_MAX_INTERFACES)
+			static void RNDIS_Device_ControlRequestHandler(void* const InterfaceInfo);
+			#endif
 		#endif
 
 	#endif
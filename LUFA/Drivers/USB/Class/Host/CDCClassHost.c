@@ -111,6 +111,76 @@ uint8_t CDC_Host_ConfigurePipes(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo
 	CDCInterfaceInfo->Config.NotificationPipe.EndpointAddress = NotificationEndpoint->EndpointAddress;
 	CDCInterfaceInfo->Config.NotificationPipe.Type = EP_TYPE_INTERRUPT;
 
+	return CDC_Host_ConfigureInterfacePipes(CDCInterfaceInfo, CDCControlInterface->InterfaceNumber,
+	                                        NotificationEndpoint->PollingIntervalMS);
+}
+
+uint8_t CDC_Host_ConfigurePipesFromIndex(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo,
+                                         const USB_ConfigIndex_t* const ConfigIndex)
+{
+	const USB_ConfigIndex_Endpoint_t*  DataINEndpoint       = NULL;
+	const USB_ConfigIndex_Endpoint_t*  DataOUTEndpoint      = NULL;
+	const USB_ConfigIndex_Endpoint_t*  NotificationEndpoint = NULL;
+	const USB_ConfigIndex_Interface_t* CDCControlInterface  = NULL;
+
+	memset(&CDCInterfaceInfo->State, 0x00, sizeof(CDCInterfaceInfo->State));
+
+	while (!(DataINEndpoint) || !(DataOUTEndpoint) || !(NotificationEndpoint))
+	{
+		CDCControlInterface = USB_FindIndexedInterface(ConfigIndex, CDCControlInterface, CDC_CSCP_CDCClass,
+		                                               CDC_CSCP_ACMSubclass, CDC_CSCP_ATCommandProtocol,
+		                                               CONFIG_INDEX_MATCH_ALL);
+
+		if (!(CDCControlInterface))
+		  return CDC_ENUMERROR_NoCompatibleInterfaceFound;
+
+		NotificationEndpoint = USB_FindIndexedEndpoint(ConfigIndex, CDCControlInterface, ENDPOINT_DIR_IN, EP_TYPE_INTERRUPT);
+
+		if (!(NotificationEndpoint) || Pipe_IsEndpointBound(NotificationEndpoint->EndpointAddress))
+		{
+			NotificationEndpoint = NULL;
+			continue;
+		}
+
+		const USB_ConfigIndex_Interface_t* CDCDataInterface = USB_FindIndexedInterface(ConfigIndex, CDCControlInterface,
+		                                                                               CDC_CSCP_CDCDataClass,
+		                                                                               CDC_CSCP_NoDataSubclass,
+		                                                                               CDC_CSCP_NoDataProtocol,
+		                                                                               CONFIG_INDEX_MATCH_ALL);
+
+		if (!(CDCDataInterface))
+		  return CDC_ENUMERROR_NoCompatibleInterfaceFound;
+
+		DataINEndpoint  = USB_FindIndexedEndpoint(ConfigIndex, CDCDataInterface, ENDPOINT_DIR_IN,  EP_TYPE_BULK);
+		DataOUTEndpoint = USB_FindIndexedEndpoint(ConfigIndex, CDCDataInterface, ENDPOINT_DIR_OUT, EP_TYPE_BULK);
+
+		if ((DataINEndpoint  && Pipe_IsEndpointBound(DataINEndpoint->EndpointAddress)) ||
+		    (DataOUTEndpoint && Pipe_IsEndpointBound(DataOUTEndpoint->EndpointAddress)))
+		{
+			DataINEndpoint = NULL;
+		}
+	}
+
+	CDCInterfaceInfo->Config.DataINPipe.Size  = DataINEndpoint->EndpointSize;
+	CDCInterfaceInfo->Config.DataINPipe.EndpointAddress = DataINEndpoint->EndpointAddress;
+	CDCInterfaceInfo->Config.DataINPipe.Type  = EP_TYPE_BULK;
+
+	CDCInterfaceInfo->Config.DataOUTPipe.Size = DataOUTEndpoint->EndpointSize;
+	CDCInterfaceInfo->Config.DataOUTPipe.EndpointAddress = DataOUTEndpoint->EndpointAddress;
+	CDCInterfaceInfo->Config.DataOUTPipe.Type = EP_TYPE_BULK;
+
+	CDCInterfaceInfo->Config.NotificationPipe.Size = NotificationEndpoint->EndpointSize;
+	CDCInterfaceInfo->Config.NotificationPipe.EndpointAddress = NotificationEndpoint->EndpointAddress;
+	CDCInterfaceInfo->Config.NotificationPipe.Type = EP_TYPE_INTERRUPT;
+
+	return CDC_Host_ConfigureInterfacePipes(CDCInterfaceInfo, CDCControlInterface->InterfaceNumber,
+	                                        NotificationEndpoint->PollingIntervalMS);
+}
+
+static uint8_t CDC_Host_ConfigureInterfacePipes(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo,
+                                                const uint8_t ControlInterfaceNumber,
+                                                const uint8_t NotificationIntervalMS)
+{
 	if (!(Pipe_ConfigurePipeTable(&CDCInterfaceInfo->Config.DataINPipe, 1)))
 	  return CDC_ENUMERROR_PipeConfigurationFailed;
 
@@ -120,7 +190,16 @@ uint8_t CDC_Host_ConfigurePipes(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo
 	if (!(Pipe_ConfigurePipeTable(&CDCInterfaceInfo->Config.NotificationPipe, 1)))
 	  return CDC_ENUMERROR_PipeConfigurationFailed;
 
-	CDCInterfaceInfo->State.ControlInterfaceNumber = CDCControlInterface->InterfaceNumber;
+	if (CDCInterfaceInfo->Config.NotificationQueue != NULL)
+	{
+		CDCInterfaceInfo->Config.NotificationQueue->Config.PipeAddress = CDCInterfaceInfo->Config.NotificationPipe.Address;
+		CDCInterfaceInfo->Config.NotificationQueue->Config.IntervalMS  = NotificationIntervalMS;
+
+		if (!(USB_Host_AddPeriodicPipe(CDCInterfaceInfo->Config.NotificationQueue)))
+		  return CDC_ENUMERROR_PipeConfigurationFailed;
+	}
+
+	CDCInterfaceInfo->State.ControlInterfaceNumber = ControlInterfaceNumber;
 	CDCInterfaceInfo->State.ControlLineStates.HostToDevice = (CDC_CONTROL_LINE_OUT_RTS | CDC_CONTROL_LINE_OUT_DTR);
 	CDCInterfaceInfo->State.ControlLineStates.DeviceToHost = (CDC_CONTROL_LINE_IN_DCD  | CDC_CONTROL_LINE_IN_DSR);
 	CDCInterfaceInfo->State.IsActive = true;
@@ -195,6 +274,41 @@ void CDC_Host_USBTask(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo)
 	if ((USB_HostState != HOST_STATE_Configured) || !(CDCInterfaceInfo->State.IsActive))
 	  return;
 
+	if (CDCInterfaceInfo->Config.NotificationQueue != NULL)
+	{
+		struct
+		{
+			USB_Request_Header_t Header;
+			uint16_t             LineStates;
+		} ATTR_PACKED Notification;
+
+		while (USB_Host_PeriodicPipeReportsQueued(CDCInterfaceInfo->Config.NotificationQueue))
+		{
+			uint8_t NotificationLength = USB_Host_ReadPeriodicPipe(CDCInterfaceInfo->Config.NotificationQueue,
+			                                                       &Notification, sizeof(Notification));
+
+			if ((NotificationLength == sizeof(Notification)) &&
+			    (Notification.Header.bRequest      == CDC_NOTIF_SerialState) &&
+			    (Notification.Header.bmRequestType == (REQDIR_DEVICETOHOST | REQTYPE_CLASS | REQREC_INTERFACE)))
+			{
+				CDCInterfaceInfo->State.ControlLineStates.DeviceToHost = le16_to_cpu(Notification.LineStates);
+
+				EVENT_CDC_Host_ControLineStateChanged(CDCInterfaceInfo);
+			}
+		}
+	}
+	else
+	{
+		CDC_Host_ProcessNotificationPipe(CDCInterfaceInfo);
+	}
+
+	#if !defined(NO_CLASS_DRIVER_AUTOFLUSH)
+	CDC_Host_Flush(CDCInterfaceInfo);
+	#endif
+}
+
+static void CDC_Host_ProcessNotificationPipe(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo)
+{
 	Pipe_SelectPipe(CDCInterfaceInfo->Config.NotificationPipe.Address);
 	Pipe_Unfreeze();
 
@@ -221,10 +335,6 @@ void CDC_Host_USBTask(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo)
 	}
 
 	Pipe_Freeze();
-
-	#if !defined(NO_CLASS_DRIVER_AUTOFLUSH)
-	CDC_Host_Flush(CDCInterfaceInfo);
-	#endif
 }
 
 uint8_t CDC_Host_SetLineEncoding(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo)
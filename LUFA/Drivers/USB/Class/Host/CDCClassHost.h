@@ -84,6 +84,14 @@
 					USB_Pipe_Table_t DataINPipe; /**< Data IN Pipe configuration table. */
 					USB_Pipe_Table_t DataOUTPipe; /**< Data OUT Pipe configuration table. */
 					USB_Pipe_Table_t NotificationPipe; /**< Notification IN Pipe configuration table. */
+
+					USB_Host_PeriodicPipe_t* NotificationQueue; /**< Optional periodic pipe used to poll the Notification IN pipe at
+					                                             *   the endpoint's polling interval via the host periodic scheduler, or
+					                                             *   \c NULL to poll the pipe from \ref CDC_Host_USBTask(). When set, the
+					                                             *   queue's report size must be at least 10 bytes to hold a complete
+					                                             *   Serial State notification; longer notifications are truncated
+					                                             *   to the Serial State notification's size when read.
+					                                             */
 				} Config; /**< Config data for the USB class interface within the device. All elements in this section
 				           *   <b>must</b> be set or the interface will fail to enumerate and operate correctly.
 				           */
@@ -152,6 +160,21 @@
 			                                uint16_t ConfigDescriptorSize,
 			                                void* ConfigDescriptorData) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
 
+			/** Host interface configuration routine, to configure a given CDC host interface instance using a configuration
+			 *  descriptor index built by \ref USB_BuildConfigIndex() from the attached device's Configuration Descriptor. This
+			 *  behaves identically to \ref CDC_Host_ConfigurePipes(), but searches the compact index rather than the raw
+			 *  descriptor data, so that several class drivers may be configured from a single pass over the descriptor of a
+			 *  composite device.
+			 *
+			 *  \param[in,out] CDCInterfaceInfo  Pointer to a structure containing an CDC Class host configuration and state.
+			 *  \param[in]     ConfigIndex       Pointer to the attached device's configuration descriptor index.
+			 *
+			 *  \return A value from the \ref CDC_Host_EnumerationFailure_ErrorCodes_t enum.
+			 */
+			uint8_t CDC_Host_ConfigurePipesFromIndex(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo,
+			                                         const USB_ConfigIndex_t* const ConfigIndex) ATTR_NON_NULL_PTR_ARG(1)
+			                                         ATTR_NON_NULL_PTR_ARG(2);
+
 			/** Sets the line encoding for the attached device's virtual serial port. This should be called when the \c LineEncoding
 			 *  values of the interface have been changed to push the new settings to the USB device.
 			 *
@@ -365,6 +388,11 @@
 				void EVENT_CDC_Host_ControLineStateChanged(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo)
 				                                           ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1) ATTR_ALIAS(CDC_Host_Event_Stub);
 
+				static uint8_t CDC_Host_ConfigureInterfacePipes(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo,
+				                                                const uint8_t ControlInterfaceNumber,
+				                                                const uint8_t NotificationIntervalMS) ATTR_NON_NULL_PTR_ARG(1);
+				static void CDC_Host_ProcessNotificationPipe(USB_ClassInfo_CDC_Host_t* const CDCInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+
 				static uint8_t DCOMP_CDC_Host_NextCDCControlInterface(void* const CurrentDescriptor)
 				                                                      ATTR_WARN_UNUSED_RESULT ATTR_NON_NULL_PTR_ARG(1);
 				static uint8_t DCOMP_CDC_Host_NextCDCDataInterface(void* const CurrentDescriptor)
@@ -101,6 +101,15 @@ uint8_t HID_Host_ConfigurePipes(USB_ClassInfo_HID_Host_t* const HIDInterfaceInfo
 	if (!(Pipe_ConfigurePipeTable(&HIDInterfaceInfo->Config.DataINPipe, 1)))
 	  return HID_ENUMERROR_PipeConfigurationFailed;
 
+	if (HIDInterfaceInfo->Config.ReportINQueue != NULL)
+	{
+		HIDInterfaceInfo->Config.ReportINQueue->Config.PipeAddress = HIDInterfaceInfo->Config.DataINPipe.Address;
+		HIDInterfaceInfo->Config.ReportINQueue->Config.IntervalMS  = DataINEndpoint->PollingIntervalMS;
+
+		if (!(USB_Host_AddPeriodicPipe(HIDInterfaceInfo->Config.ReportINQueue)))
+		  return HID_ENUMERROR_PipeConfigurationFailed;
+	}
+
 	if (DataOUTEndpoint)
 	{
 		HIDInterfaceInfo->Config.DataOUTPipe.Size = le16_to_cpu(DataOUTEndpoint->EndpointSize);
@@ -192,6 +201,15 @@ uint8_t HID_Host_ReceiveReport(USB_ClassInfo_HID_Host_t* const HIDInterfaceInfo,
 	if ((USB_HostState != HOST_STATE_Configured) || !(HIDInterfaceInfo->State.IsActive))
 	  return PIPE_READYWAIT_DeviceDisconnected;
 
+	if (HIDInterfaceInfo->Config.ReportINQueue != NULL)
+	{
+		if (!(USB_Host_ReadPeriodicPipe(HIDInterfaceInfo->Config.ReportINQueue, Buffer,
+		                                HIDInterfaceInfo->Config.ReportINQueue->Config.ReportSize)))
+		  return PIPE_RWSTREAM_Timeout;
+
+		return PIPE_RWSTREAM_NoError;
+	}
+
 	uint8_t ErrorCode;
 
 	Pipe_SelectPipe(HIDInterfaceInfo->Config.DataINPipe.Address);
@@ -285,6 +303,9 @@ bool HID_Host_IsReportReceived(USB_ClassInfo_HID_Host_t* const HIDInterfaceInfo)
 	if ((USB_HostState != HOST_STATE_Configured) || !(HIDInterfaceInfo->State.IsActive))
 	  return false;
 
+	if (HIDInterfaceInfo->Config.ReportINQueue != NULL)
+	  return (USB_Host_PeriodicPipeReportsQueued(HIDInterfaceInfo->Config.ReportINQueue) != 0);
+
 	bool ReportReceived;
 
 	Pipe_SelectPipe(HIDInterfaceInfo->Config.DataINPipe.Address);
@@ -98,6 +98,13 @@
 					                                  *        this field is unavailable.
 					                                  */
 					#endif
+
+					USB_Host_PeriodicPipe_t* ReportINQueue; /**< Optional periodic pipe used to poll the Data IN pipe at the
+					                                         *   endpoint's polling interval via the host periodic scheduler, or
+					                                         *   \c NULL to poll the pipe on demand. When set, only the queue
+					                                         *   buffer fields of the periodic pipe's configuration need to be
+					                                         *   set, and received reports are read from the queue.
+					                                         */
 				} Config; /**< Config data for the USB class interface within the device. All elements in this section
 				           *   <b>must</b> be set or the interface will fail to enumerate and operate correctly.
 				           */
@@ -0,0 +1,460 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+#define  __INCLUDE_FROM_USB_DRIVER
+#include "../../Core/USBMode.h"
+
+#if defined(USB_CAN_BE_HOST) && defined(HOST_MAX_DEVICES)
+
+#define  __INCLUDE_FROM_HUB_DRIVER
+#define  __INCLUDE_FROM_HUB_HOST_C
+#include "HubClassHost.h"
+
+uint8_t HUB_Host_ConfigurePipes(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                uint16_t ConfigDescriptorSize,
+                                void* ConfigDescriptorData)
+{
+	USB_Descriptor_Endpoint_t*  StatusChangeEndpoint = NULL;
+	USB_Descriptor_Interface_t* HubInterface         = NULL;
+
+	memset(&HUBInterfaceInfo->State, 0x00, sizeof(HUBInterfaceInfo->State));
+
+	if (DESCRIPTOR_TYPE(ConfigDescriptorData) != DTYPE_Configuration)
+	  return HUB_ENUMERROR_InvalidConfigDescriptor;
+
+	while (!(StatusChangeEndpoint))
+	{
+		if (!(HubInterface) ||
+		    USB_GetNextDescriptorComp(&ConfigDescriptorSize, &ConfigDescriptorData,
+		                              DCOMP_HUB_Host_NextHUBInterfaceEndpoint) != DESCRIPTOR_SEARCH_COMP_Found)
+		{
+			if (USB_GetNextDescriptorComp(&ConfigDescriptorSize, &ConfigDescriptorData,
+			                              DCOMP_HUB_Host_NextHUBInterface) != DESCRIPTOR_SEARCH_COMP_Found)
+			{
+				return HUB_ENUMERROR_NoCompatibleInterfaceFound;
+			}
+
+			HubInterface = DESCRIPTOR_PCAST(ConfigDescriptorData, USB_Descriptor_Interface_t);
+
+			continue;
+		}
+
+		StatusChangeEndpoint = DESCRIPTOR_PCAST(ConfigDescriptorData, USB_Descriptor_Endpoint_t);
+	}
+
+	HUBInterfaceInfo->Config.StatusChangePipe.Size  = le16_to_cpu(StatusChangeEndpoint->EndpointSize);
+	HUBInterfaceInfo->Config.StatusChangePipe.EndpointAddress = StatusChangeEndpoint->EndpointAddress;
+	HUBInterfaceInfo->Config.StatusChangePipe.Type  = EP_TYPE_INTERRUPT;
+
+	if (!(Pipe_ConfigurePipeTable(&HUBInterfaceInfo->Config.StatusChangePipe, 1)))
+	  return HUB_ENUMERROR_PipeConfigurationFailed;
+
+	HUBInterfaceInfo->State.HubAddress = USB_Host_DeviceAddress;
+	HUBInterfaceInfo->State.IsActive   = true;
+
+	return HUB_ENUMERROR_NoError;
+}
+
+static uint8_t DCOMP_HUB_Host_NextHUBInterface(void* const CurrentDescriptor)
+{
+	USB_Descriptor_Header_t* Header = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Header_t);
+
+	if (Header->Type == DTYPE_Interface)
+	{
+		USB_Descriptor_Interface_t* Interface = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Interface_t);
+
+		if ((Interface->Class    == HUB_CSCP_HubClass) &&
+		    (Interface->SubClass == HUB_CSCP_NoSpecificSubclass))
+		{
+			return DESCRIPTOR_SEARCH_Found;
+		}
+	}
+
+	return DESCRIPTOR_SEARCH_NotFound;
+}
+
+static uint8_t DCOMP_HUB_Host_NextHUBInterfaceEndpoint(void* const CurrentDescriptor)
+{
+	USB_Descriptor_Header_t* Header = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Header_t);
+
+	if (Header->Type == DTYPE_Endpoint)
+	{
+		USB_Descriptor_Endpoint_t* Endpoint = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Endpoint_t);
+
+		uint8_t EndpointType = (Endpoint->Attributes & EP_TYPE_MASK);
+
+		if ((EndpointType == EP_TYPE_INTERRUPT) && (Endpoint->EndpointAddress & ENDPOINT_DIR_IN) &&
+		    !(Pipe_IsEndpointBound(Endpoint->EndpointAddress)))
+		{
+			return DESCRIPTOR_SEARCH_Found;
+		}
+	}
+	else if (Header->Type == DTYPE_Interface)
+	{
+		return DESCRIPTOR_SEARCH_Fail;
+	}
+
+	return DESCRIPTOR_SEARCH_NotFound;
+}
+
+void HUB_Host_USBTask(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo)
+{
+	if ((USB_HostState != HOST_STATE_Configured) || !(HUBInterfaceInfo->State.IsActive))
+	  return;
+
+	uint8_t  PrevDeviceAddress = USB_Host_DeviceAddress;
+	uint16_t ChangeMask        = 0;
+
+	Pipe_SelectPipe(HUBInterfaceInfo->Config.StatusChangePipe.Address);
+	Pipe_Unfreeze();
+
+	if (Pipe_IsINReceived())
+	{
+		for (uint8_t ByteIndex = 0; Pipe_BytesInPipe(); ByteIndex++)
+		{
+			uint8_t ChangeByte = Pipe_Read_8();
+
+			if (ByteIndex < sizeof(ChangeMask))
+			  ChangeMask |= ((uint16_t)ChangeByte << (ByteIndex * 8));
+		}
+
+		Pipe_ClearIN();
+	}
+
+	Pipe_Freeze();
+
+	if (ChangeMask & (1 << 0))
+	  HUB_Host_ClearHubChanges(HUBInterfaceInfo);
+
+	for (uint8_t Port = 1; Port <= HUBInterfaceInfo->State.TotalPorts; Port++)
+	{
+		if (ChangeMask & (1 << Port))
+		  HUB_Host_ProcessPortChange(HUBInterfaceInfo, Port);
+	}
+
+	HUB_Host_ServicePorts(HUBInterfaceInfo);
+
+	USB_Host_SelectDevice((USB_Host_GetDevice(PrevDeviceAddress) != NULL) ? PrevDeviceAddress : 0);
+}
+
+static void HUB_Host_ClearHubChanges(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo)
+{
+	HUB_PortStatus_t HubStatus;
+
+	USB_ControlRequest = (USB_Request_Header_t)
+		{
+			.bmRequestType = (REQDIR_DEVICETOHOST | REQTYPE_CLASS | REQREC_DEVICE),
+			.bRequest      = REQ_GetStatus,
+			.wValue        = 0,
+			.wIndex        = 0,
+			.wLength       = sizeof(HUB_PortStatus_t),
+		};
+
+	USB_Host_SelectDevice(HUBInterfaceInfo->State.HubAddress);
+	Pipe_SelectPipe(PIPE_CONTROLPIPE);
+
+	if (USB_Host_SendControlRequest(&HubStatus) != HOST_SENDCONTROL_Successful)
+	  return;
+
+	uint16_t HubChange = le16_to_cpu(HubStatus.Change);
+
+	for (uint8_t Feature = HUB_FEATURE_CHubLocalPower; Feature <= HUB_FEATURE_CHubOverCurrent; Feature++)
+	{
+		if (!(HubChange & (1 << Feature)))
+		  continue;
+
+		USB_ControlRequest = (USB_Request_Header_t)
+			{
+				.bmRequestType = (REQDIR_HOSTTODEVICE | REQTYPE_CLASS | REQREC_DEVICE),
+				.bRequest      = REQ_ClearFeature,
+				.wValue        = Feature,
+				.wIndex        = 0,
+				.wLength       = 0,
+			};
+
+		USB_Host_SendControlRequest(NULL);
+	}
+}
+
+static void HUB_Host_ProcessPortChange(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                       const uint8_t Port)
+{
+	HUB_PortStatus_t PortStatus;
+
+	if (HUB_Host_GetPortStatus(HUBInterfaceInfo, Port, &PortStatus) != HOST_SENDCONTROL_Successful)
+	  return;
+
+	for (uint8_t ChangeBit = 0; ChangeBit <= (HUB_FEATURE_CPortReset - HUB_FEATURE_CPortConnection); ChangeBit++)
+	{
+		if (PortStatus.Change & (1 << ChangeBit))
+		  HUB_Host_ClearPortFeature(HUBInterfaceInfo, Port, (HUB_FEATURE_CPortConnection + ChangeBit));
+	}
+
+	uint8_t DeviceAddress = HUBInterfaceInfo->State.PortDevices[Port - 1];
+
+	if (DeviceAddress && (!(PortStatus.Status & HUB_PORTSTATUS_CONNECTION) || (PortStatus.Change & HUB_PORTCHANGE_CONNECTION)))
+	{
+		HUBInterfaceInfo->State.PortDevices[Port - 1] = 0;
+		USB_Host_FreeDevice(DeviceAddress);
+
+		EVENT_HUB_Host_DeviceDetached(HUBInterfaceInfo, Port, DeviceAddress);
+		DeviceAddress = 0;
+	}
+
+	if (!(PortStatus.Status & HUB_PORTSTATUS_CONNECTION))
+	{
+		HUB_Host_SetPortState(HUBInterfaceInfo, Port, HUB_PORTSTATE_Idle);
+		return;
+	}
+
+	if (DeviceAddress)
+	  return;
+
+	uint8_t PortState = HUBInterfaceInfo->State.PortStates[Port - 1];
+
+	/* A new or bouncing connection (re)starts the attach sequence with the connection debounce interval */
+	if ((PortState == HUB_PORTSTATE_Idle) || (PortStatus.Change & HUB_PORTCHANGE_CONNECTION))
+	{
+		HUB_Host_SetPortState(HUBInterfaceInfo, Port, HUB_PORTSTATE_Debounce);
+	}
+	else if ((PortState == HUB_PORTSTATE_Resetting) && (PortStatus.Change & HUB_PORTCHANGE_RESET))
+	{
+		if (!(PortStatus.Status & HUB_PORTSTATUS_ENABLE))
+		  HUB_Host_FailPortAttach(HUBInterfaceInfo, Port, HUB_ATTACHERROR_PortResetFailed, 0);
+		else if (PortStatus.Status & HUB_PORTSTATUS_LOWSPEED)
+		  HUB_Host_FailPortAttach(HUBInterfaceInfo, Port, HUB_ATTACHERROR_LowSpeedDevice, 0);
+		else
+		  HUB_Host_SetPortState(HUBInterfaceInfo, Port, HUB_PORTSTATE_ResetRecovery);
+	}
+}
+
+static void HUB_Host_ServicePorts(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo)
+{
+	uint16_t CurrentFrame = USB_Host_GetFrameNumber();
+
+	for (uint8_t Port = 1; Port <= HUBInterfaceInfo->State.TotalPorts; Port++)
+	{
+		uint8_t  PortState     = HUBInterfaceInfo->State.PortStates[Port - 1];
+		uint16_t ElapsedFrames = ((CurrentFrame - HUBInterfaceInfo->State.PortTimers[Port - 1]) & HOST_FRAME_NUMBER_MASK);
+		uint8_t  SubErrorCode  = 0;
+		uint8_t  ErrorCode;
+
+		switch (PortState)
+		{
+			case HUB_PORTSTATE_Debounce:
+				if (ElapsedFrames < HOST_CONNECT_DEBOUNCE_MS)
+				  break;
+
+				if ((SubErrorCode = HUB_Host_SetPortFeature(HUBInterfaceInfo, Port, HUB_FEATURE_PortReset)) != HOST_SENDCONTROL_Successful)
+				{
+					HUB_Host_FailPortAttach(HUBInterfaceInfo, Port, HUB_ATTACHERROR_ControlError, SubErrorCode);
+					break;
+				}
+
+				HUB_Host_SetPortState(HUBInterfaceInfo, Port, HUB_PORTSTATE_Resetting);
+				break;
+			case HUB_PORTSTATE_Resetting:
+				/* Reset completion is reported by the hub through its status change pipe */
+				if (ElapsedFrames >= HUB_PORT_RESET_TIMEOUT_MS)
+				  HUB_Host_FailPortAttach(HUBInterfaceInfo, Port, HUB_ATTACHERROR_PortResetFailed, 0);
+
+				break;
+			case HUB_PORTSTATE_ResetRecovery:
+				if (ElapsedFrames < HOST_RESET_RECOVERY_MS)
+				  break;
+
+				if ((ErrorCode = HUB_Host_AttachPortDevice(HUBInterfaceInfo, Port, &SubErrorCode)) != HUB_ATTACHERROR_NoError)
+				{
+					HUB_Host_FailPortAttach(HUBInterfaceInfo, Port, ErrorCode, SubErrorCode);
+					break;
+				}
+
+				HUB_Host_SetPortState(HUBInterfaceInfo, Port, HUB_PORTSTATE_Idle);
+
+				EVENT_HUB_Host_DeviceAttached(HUBInterfaceInfo, Port, HUBInterfaceInfo->State.PortDevices[Port - 1]);
+				break;
+		}
+	}
+}
+
+static void HUB_Host_SetPortState(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                  const uint8_t Port,
+                                  const uint8_t PortState)
+{
+	HUBInterfaceInfo->State.PortStates[Port - 1] = PortState;
+	HUBInterfaceInfo->State.PortTimers[Port - 1] = USB_Host_GetFrameNumber();
+}
+
+static void HUB_Host_FailPortAttach(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                    const uint8_t Port,
+                                    const uint8_t ErrorCode,
+                                    const uint8_t SubErrorCode)
+{
+	HUB_Host_SetPortState(HUBInterfaceInfo, Port, HUB_PORTSTATE_Idle);
+	HUB_Host_ClearPortFeature(HUBInterfaceInfo, Port, HUB_FEATURE_PortEnable);
+
+	EVENT_HUB_Host_DeviceAttachFailed(HUBInterfaceInfo, Port, ErrorCode, SubErrorCode);
+}
+
+static uint8_t HUB_Host_AttachPortDevice(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                         const uint8_t Port,
+                                         uint8_t* const SubErrorCode)
+{
+	USB_Host_Device_t* Device;
+
+	if ((Device = USB_Host_AllocateDevice(HUBInterfaceInfo->State.HubAddress, Port, true)) == NULL)
+	  return HUB_ATTACHERROR_DeviceTableFull;
+
+	if ((*SubErrorCode = USB_Host_AddressDevice(Device)) != HOST_SENDCONTROL_Successful)
+	{
+		USB_Host_FreeDevice(Device->Address);
+		return HUB_ATTACHERROR_AddressingFailed;
+	}
+
+	HUBInterfaceInfo->State.PortDevices[Port - 1] = Device->Address;
+
+	return HUB_ATTACHERROR_NoError;
+}
+
+uint8_t HUB_Host_PowerOnPorts(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo)
+{
+	HUB_Descriptor_Hub_t HubDescriptor;
+	uint8_t              ErrorCode;
+
+	if ((ErrorCode = HUB_Host_GetHubDescriptor(HUBInterfaceInfo, &HubDescriptor)) != HOST_SENDCONTROL_Successful)
+	  return ErrorCode;
+
+	HUBInterfaceInfo->State.TotalPorts = MIN(HubDescriptor.TotalPorts, HUB_MAX_PORTS);
+
+	for (uint8_t Port = 1; Port <= HUBInterfaceInfo->State.TotalPorts; Port++)
+	{
+		if ((ErrorCode = HUB_Host_SetPortFeature(HUBInterfaceInfo, Port, HUB_FEATURE_PortPower)) != HOST_SENDCONTROL_Successful)
+		  return ErrorCode;
+	}
+
+	for (uint16_t PowerGoodMSRem = ((uint16_t)HubDescriptor.PowerOnToPowerGood * 2); PowerGoodMSRem; PowerGoodMSRem--)
+	{
+		if ((ErrorCode = USB_Host_WaitMS(1)) != HOST_WAITERROR_Successful)
+		  return ErrorCode;
+	}
+
+	return HOST_SENDCONTROL_Successful;
+}
+
+uint8_t HUB_Host_GetHubDescriptor(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                  HUB_Descriptor_Hub_t* const HubDescriptor)
+{
+	USB_ControlRequest = (USB_Request_Header_t)
+		{
+			.bmRequestType = (REQDIR_DEVICETOHOST | REQTYPE_CLASS | REQREC_DEVICE),
+			.bRequest      = REQ_GetDescriptor,
+			.wValue        = (HUB_DTYPE_Hub << 8),
+			.wIndex        = 0,
+			.wLength       = sizeof(HUB_Descriptor_Hub_t),
+		};
+
+	USB_Host_SelectDevice(HUBInterfaceInfo->State.HubAddress);
+	Pipe_SelectPipe(PIPE_CONTROLPIPE);
+
+	return USB_Host_SendControlRequest(HubDescriptor);
+}
+
+uint8_t HUB_Host_GetPortStatus(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                               const uint8_t Port,
+                               HUB_PortStatus_t* const PortStatus)
+{
+	uint8_t ErrorCode;
+
+	USB_ControlRequest = (USB_Request_Header_t)
+		{
+			.bmRequestType = (REQDIR_DEVICETOHOST | REQTYPE_CLASS | REQREC_OTHER),
+			.bRequest      = REQ_GetStatus,
+			.wValue        = 0,
+			.wIndex        = Port,
+			.wLength       = sizeof(HUB_PortStatus_t),
+		};
+
+	USB_Host_SelectDevice(HUBInterfaceInfo->State.HubAddress);
+	Pipe_SelectPipe(PIPE_CONTROLPIPE);
+
+	if ((ErrorCode = USB_Host_SendControlRequest(PortStatus)) != HOST_SENDCONTROL_Successful)
+	  return ErrorCode;
+
+	PortStatus->Status = le16_to_cpu(PortStatus->Status);
+	PortStatus->Change = le16_to_cpu(PortStatus->Change);
+
+	return HOST_SENDCONTROL_Successful;
+}
+
+uint8_t HUB_Host_SetPortFeature(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                const uint8_t Port,
+                                const uint8_t Feature)
+{
+	USB_ControlRequest = (USB_Request_Header_t)
+		{
+			.bmRequestType = (REQDIR_HOSTTODEVICE | REQTYPE_CLASS | REQREC_OTHER),
+			.bRequest      = REQ_SetFeature,
+			.wValue        = Feature,
+			.wIndex        = Port,
+			.wLength       = 0,
+		};
+
+	USB_Host_SelectDevice(HUBInterfaceInfo->State.HubAddress);
+	Pipe_SelectPipe(PIPE_CONTROLPIPE);
+
+	return USB_Host_SendControlRequest(NULL);
+}
+
+uint8_t HUB_Host_ClearPortFeature(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+                                  const uint8_t Port,
+                                  const uint8_t Feature)
+{
+	USB_ControlRequest = (USB_Request_Header_t)
+		{
+			.bmRequestType = (REQDIR_HOSTTODEVICE | REQTYPE_CLASS | REQREC_OTHER),
+			.bRequest      = REQ_ClearFeature,
+			.wValue        = Feature,
+			.wIndex        = Port,
+			.wLength       = 0,
+		};
+
+	USB_Host_SelectDevice(HUBInterfaceInfo->State.HubAddress);
+	Pipe_SelectPipe(PIPE_CONTROLPIPE);
+
+	return USB_Host_SendControlRequest(NULL);
+}
+
+void HUB_Host_Event_Stub(void)
+{
+
+}
+
+#endif
+
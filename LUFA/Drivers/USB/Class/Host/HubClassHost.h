@@ -0,0 +1,361 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *  \brief Host mode driver for the library USB Hub Class driver.
+ *
+ *  Host mode driver for the library USB Hub Class driver.
+ *
+ *  \note This file should not be included directly. It is automatically included as needed by the USB module driver
+ *        dispatch header located in LUFA/Drivers/USB.h.
+ */
+
+/** \ingroup Group_USBClassHub
+ *  \defgroup Group_USBClassHubHost Hub Class Host Mode Driver
+ *
+ *  \section Sec_USBClassHubHost_Dependencies Module Source Dependencies
+ *  The following files must be built with any user project that uses this module:
+ *    - LUFA/Drivers/USB/Class/Host/HubClassHost.c <i>(Makefile source module name: LUFA_SRC_USBCLASS)</i>
+ *
+ *  \section Sec_USBClassHubHost_ModDescription Module Description
+ *  Host Mode USB Class driver framework interface, for the Hub USB Class driver.
+ *
+ *  Each hub interface instance polls its hub's status change pipe from \ref HUB_Host_USBTask(), and services any port
+ *  changes reported by the hub. Newly connected devices are reset, assigned a free bus address from the host device table
+ *  and reported to the user application via \ref EVENT_HUB_Host_DeviceAttached(); the application should then select the
+ *  new device with \ref USB_Host_SelectDevice() before reading its Configuration Descriptor, configuring the pipes of the
+ *  class driver instances which will communicate with it and setting its configuration. Disconnected devices are released
+ *  from the host device table along with their pipes and reported via \ref EVENT_HUB_Host_DeviceDetached().
+ *
+ *  The connection debounce, port reset and reset recovery intervals of each port are timed from the bus frame number
+ *  rather than waited out, so that \ref HUB_Host_USBTask() never blocks the main program loop while a device is being
+ *  attached and several ports may attach their devices at once.
+ *
+ *  Each attached device's pipes remain bound to that device, so that the class driver instances of several devices can be
+ *  serviced in turn from the main program loop without further device selection. Control requests are always sent to the
+ *  currently selected device, which is preserved by \ref HUB_Host_USBTask().
+ *
+ *  @{
+ */
+
+#ifndef __HUB_CLASS_HOST_H__
+#define __HUB_CLASS_HOST_H__
+
+	/* Includes: */
+		#include "../../USB.h"
+		#include "../Common/HubClassCommon.h"
+
+	/* Enable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			extern "C" {
+		#endif
+
+	/* Preprocessor Checks: */
+		#if !defined(__INCLUDE_FROM_HUB_DRIVER)
+			#error Do not include this file directly. Include LUFA/Drivers/USB.h instead.
+		#endif
+
+		#if defined(HUB_MAX_PORTS) && ((HUB_MAX_PORTS < 1) || (HUB_MAX_PORTS > 15))
+			#error HUB_MAX_PORTS must be between 1 and 15.
+		#endif
+
+	/* Public Interface - May be used in end-application: */
+		/* Macros: */
+			#if !defined(HUB_MAX_PORTS) || defined(__DOXYGEN__)
+				/** Maximum number of downstream ports of each hub which will be serviced by the class driver. Ports
+				 *  beyond this number on hubs with more ports are left unpowered.
+				 *
+				 *  The default value may be overridden in the user project makefile by defining the \c HUB_MAX_PORTS
+				 *  token to the required number of ports, and passed to the compiler using the -D switch.
+				 */
+				#define HUB_MAX_PORTS                  7
+			#endif
+
+		/* Type Defines: */
+			/** \brief Hub Class Host Mode Configuration and State Structure.
+			 *
+			 *  Class state structure. An instance of this structure should be made within the user application,
+			 *  and passed to each of the Hub class driver functions as the \c HUBInterfaceInfo parameter. This
+			 *  stores each Hub interface's configuration and state information.
+			 */
+			typedef struct
+			{
+				struct
+				{
+					USB_Pipe_Table_t StatusChangePipe; /**< Status change IN Pipe configuration table. */
+				} Config; /**< Config data for the USB class interface within the device. All elements in this section
+				           *   <b>must</b> be set or the interface will fail to enumerate and operate correctly.
+				           */
+				struct
+				{
+					bool IsActive; /**< Indicates if the current interface instance is connected to an attached device, valid
+					                *   after \ref HUB_Host_ConfigurePipes() is called and the Host state machine is in the
+					                *   Configured state.
+					                */
+					uint8_t HubAddress; /**< Bus address of the hub within the host device table. */
+					uint8_t TotalPorts; /**< Number of downstream ports of the hub serviced by the class driver, valid
+					                     *   after \ref HUB_Host_PowerOnPorts() has been called.
+					                     */
+					uint8_t PortDevices[HUB_MAX_PORTS]; /**< Bus address of the device attached to each downstream port
+					                                     *   of the hub, or zero if no device is attached.
+					                                     */
+					uint8_t PortStates[HUB_MAX_PORTS]; /**< Current step of the attach sequence of each downstream port
+					                                    *   of the hub, for internal use by the class driver.
+					                                    */
+					uint16_t PortTimers[HUB_MAX_PORTS]; /**< Bus frame number at which each downstream port of the hub
+					                                     *   entered its current attach step, for internal use by the class
+					                                     *   driver.
+					                                     */
+				} State; /**< State data for the USB class interface within the device. All elements in this section
+						  *   <b>may</b> be set to initial values, but may also be ignored to default to sane values when
+						  *   the interface is enumerated.
+						  */
+			} USB_ClassInfo_HUB_Host_t;
+
+		/* Enums: */
+			/** Enum for the possible error codes returned by the \ref HUB_Host_ConfigurePipes() function. */
+			enum HUB_Host_EnumerationFailure_ErrorCodes_t
+			{
+				HUB_ENUMERROR_NoError                    = 0, /**< Configuration Descriptor was processed successfully. */
+				HUB_ENUMERROR_InvalidConfigDescriptor    = 1, /**< The device returned an invalid Configuration Descriptor. */
+				HUB_ENUMERROR_NoCompatibleInterfaceFound = 2, /**< A compatible Hub interface was not found in the device's Configuration Descriptor. */
+				HUB_ENUMERROR_PipeConfigurationFailed    = 3, /**< One or more pipes for the specified interface could not be configured correctly. */
+			};
+
+			/** Enum for the possible error codes passed to the \ref EVENT_HUB_Host_DeviceAttachFailed() event. */
+			enum HUB_Host_AttachFailure_ErrorCodes_t
+			{
+				HUB_ATTACHERROR_NoError                  = 0, /**< The attached device was addressed successfully. */
+				HUB_ATTACHERROR_ControlError             = 1, /**< A control request to the hub failed, the sub error code is a value
+				                                               *   from the \ref USB_Host_SendControlErrorCodes_t enum.
+				                                               */
+				HUB_ATTACHERROR_PortResetFailed          = 2, /**< The hub port did not become enabled after being reset. */
+				HUB_ATTACHERROR_LowSpeedDevice           = 3, /**< The attached device is a Low Speed device, which cannot be
+				                                               *   communicated with through a hub.
+				                                               */
+				HUB_ATTACHERROR_DeviceTableFull          = 4, /**< The host device table has no free entries for the new device. */
+				HUB_ATTACHERROR_AddressingFailed         = 5, /**< The new device could not be moved to its assigned address, the sub
+				                                               *   error code is a value from the \ref USB_Host_SendControlErrorCodes_t enum.
+				                                               */
+			};
+
+		/* Function Prototypes: */
+			/** Host interface configuration routine, to configure a given Hub host interface instance using the
+			 *  Configuration Descriptor read from an attached USB device. This function automatically updates the given Hub
+			 *  instance's state values and configures the pipes required to communicate with the interface if it is found within
+			 *  the device. This should be called once after the stack has enumerated the hub, while the hub is the currently
+			 *  selected device.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo      Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[in]     ConfigDescriptorSize  Length of the attached device's Configuration Descriptor.
+			 *  \param[in]     ConfigDescriptorData  Pointer to a buffer containing the attached device's Configuration Descriptor.
+			 *
+			 *  \return A value from the \ref HUB_Host_EnumerationFailure_ErrorCodes_t enum.
+			 */
+			uint8_t HUB_Host_ConfigurePipes(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                                uint16_t ConfigDescriptorSize,
+			                                void* ConfigDescriptorData) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
+
+			/** General management task for a given Hub host class interface, required for the correct operation of
+			 *  the interface. This should be called frequently in the main program loop, before the master USB management task
+			 *  \ref USB_USBTask(). Port changes reported by the hub are serviced here, firing the \ref EVENT_HUB_Host_DeviceAttached(),
+			 *  \ref EVENT_HUB_Host_DeviceAttachFailed() and \ref EVENT_HUB_Host_DeviceDetached() events as devices come and go.
+			 *
+			 *  Each call advances the attach sequence of any port whose current debounce, reset or recovery interval has elapsed
+			 *  and returns immediately otherwise, so the attach timing is only as accurate as the rate at which this is called.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 */
+			void HUB_Host_USBTask(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Reads the hub's class descriptor to determine its number of downstream ports, then powers on each port and waits
+			 *  for the port power to become good. This should be called once the hub's configuration has been set, before the
+			 *  interface's management task is run.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *
+			 *  \return A value from the \ref USB_Host_SendControlErrorCodes_t enum.
+			 */
+			uint8_t HUB_Host_PowerOnPorts(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Retrieves the fixed portion of the hub's class descriptor.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[out]    HubDescriptor     Pointer to a location where the retrieved hub descriptor should be stored.
+			 *
+			 *  \return A value from the \ref USB_Host_SendControlErrorCodes_t enum.
+			 */
+			uint8_t HUB_Host_GetHubDescriptor(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                                  HUB_Descriptor_Hub_t* const HubDescriptor)
+			                                  ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+
+			/** Retrieves the current status of the given hub port. The retrieved status and change masks are converted to the
+			 *  native CPU endianness.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[in]     Port              Hub port number to retrieve the status of, starting from 1.
+			 *  \param[out]    PortStatus        Pointer to a location where the retrieved port status should be stored.
+			 *
+			 *  \return A value from the \ref USB_Host_SendControlErrorCodes_t enum.
+			 */
+			uint8_t HUB_Host_GetPortStatus(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                               const uint8_t Port,
+			                               HUB_PortStatus_t* const PortStatus)
+			                               ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
+
+			/** Sets the given feature of a hub port, such as the port power or reset state.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[in]     Port              Hub port number to set the feature of, starting from 1.
+			 *  \param[in]     Feature           Feature selector to set, a value from the \ref HUB_Features_t enum.
+			 *
+			 *  \return A value from the \ref USB_Host_SendControlErrorCodes_t enum.
+			 */
+			uint8_t HUB_Host_SetPortFeature(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                                const uint8_t Port,
+			                                const uint8_t Feature) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Clears the given feature of a hub port, such as the port enable state or one of the port change indicators.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[in]     Port              Hub port number to clear the feature of, starting from 1.
+			 *  \param[in]     Feature           Feature selector to clear, a value from the \ref HUB_Features_t enum.
+			 *
+			 *  \return A value from the \ref USB_Host_SendControlErrorCodes_t enum.
+			 */
+			uint8_t HUB_Host_ClearPortFeature(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                                  const uint8_t Port,
+			                                  const uint8_t Feature) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Hub class driver event for a device attached to a downstream hub port. This event fires once the new device
+			 *  has been reset and moved to its assigned bus address, and may be hooked in the user program by declaring a
+			 *  handler function with the same name and parameters listed here. The new device is left selected, ready for
+			 *  its Configuration Descriptor to be read.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[in]     Port              Hub port number the device is attached to.
+			 *  \param[in]     DeviceAddress     Bus address assigned to the new device.
+			 */
+			void EVENT_HUB_Host_DeviceAttached(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                                   const uint8_t Port,
+			                                   const uint8_t DeviceAddress) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Hub class driver event for a device attached to a downstream hub port which could not be addressed. The hub port
+			 *  is disabled, and will be retried the next time the hub reports a change on the port. This event may be hooked in
+			 *  the user program by declaring a handler function with the same name and parameters listed here.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[in]     Port              Hub port number the device is attached to.
+			 *  \param[in]     ErrorCode         Error code indicating the failure reason, a value in \ref HUB_Host_AttachFailure_ErrorCodes_t.
+			 *  \param[in]     SubErrorCode      Sub error code indicating the reason for failure - for example, if the
+			 *                                   ErrorCode parameter indicates a control error, this will give the error
+			 *                                   code returned by the \ref USB_Host_SendControlRequest() function.
+			 */
+			void EVENT_HUB_Host_DeviceAttachFailed(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                                       const uint8_t Port,
+			                                       const uint8_t ErrorCode,
+			                                       const uint8_t SubErrorCode) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Hub class driver event for a device detached from a downstream hub port. This event fires after the device and
+			 *  any devices attached downstream of it have been released from the host device table, and may be hooked in the
+			 *  user program by declaring a handler function with the same name and parameters listed here. The user application
+			 *  should mark any class driver instances communicating with the device as inactive.
+			 *
+			 *  \param[in,out] HUBInterfaceInfo  Pointer to a structure containing a Hub Class host configuration and state.
+			 *  \param[in]     Port              Hub port number the device was attached to.
+			 *  \param[in]     DeviceAddress     Bus address the detached device was assigned.
+			 */
+			void EVENT_HUB_Host_DeviceDetached(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+			                                   const uint8_t Port,
+			                                   const uint8_t DeviceAddress) ATTR_NON_NULL_PTR_ARG(1);
+
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Macros: */
+			#define HUB_PORT_RESET_TIMEOUT_MS          500
+
+		/* Enums: */
+			enum HUB_Host_PortStates_t
+			{
+				HUB_PORTSTATE_Idle                   = 0,
+				HUB_PORTSTATE_Debounce               = 1,
+				HUB_PORTSTATE_Resetting              = 2,
+				HUB_PORTSTATE_ResetRecovery          = 3,
+			};
+
+		/* Function Prototypes: */
+			#if defined(__INCLUDE_FROM_HUB_HOST_C)
+				static void HUB_Host_ClearHubChanges(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+				static void HUB_Host_ProcessPortChange(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+				                                       const uint8_t Port) ATTR_NON_NULL_PTR_ARG(1);
+				static void HUB_Host_ServicePorts(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
+				static void HUB_Host_SetPortState(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+				                                  const uint8_t Port,
+				                                  const uint8_t PortState) ATTR_NON_NULL_PTR_ARG(1);
+				static void HUB_Host_FailPortAttach(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+				                                    const uint8_t Port,
+				                                    const uint8_t ErrorCode,
+				                                    const uint8_t SubErrorCode) ATTR_NON_NULL_PTR_ARG(1);
+				static uint8_t HUB_Host_AttachPortDevice(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+				                                         const uint8_t Port,
+				                                         uint8_t* const SubErrorCode) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
+
+				void HUB_Host_Event_Stub(void) ATTR_CONST;
+
+				void EVENT_HUB_Host_DeviceAttached(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+				                                   const uint8_t Port,
+				                                   const uint8_t DeviceAddress)
+				                                   ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1) ATTR_ALIAS(HUB_Host_Event_Stub);
+				void EVENT_HUB_Host_DeviceAttachFailed(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+				                                       const uint8_t Port,
+				                                       const uint8_t ErrorCode,
+				                                       const uint8_t SubErrorCode)
+				                                       ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1) ATTR_ALIAS(HUB_Host_Event_Stub);
+				void EVENT_HUB_Host_DeviceDetached(USB_ClassInfo_HUB_Host_t* const HUBInterfaceInfo,
+				                                   const uint8_t Port,
+				                                   const uint8_t DeviceAddress)
+				                                   ATTR_WEAK ATTR_NON_NULL_PTR_ARG(1) ATTR_ALIAS(HUB_Host_Event_Stub);
+
+				static uint8_t DCOMP_HUB_Host_NextHUBInterface(void* const CurrentDescriptor)
+				                                               ATTR_WARN_UNUSED_RESULT ATTR_NON_NULL_PTR_ARG(1);
+				static uint8_t DCOMP_HUB_Host_NextHUBInterfaceEndpoint(void* const CurrentDescriptor)
+				                                                       ATTR_WARN_UNUSED_RESULT ATTR_NON_NULL_PTR_ARG(1);
+			#endif
+	#endif
+
+	/* Disable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			}
+		#endif
+
+#endif
+
+/** @} */
+
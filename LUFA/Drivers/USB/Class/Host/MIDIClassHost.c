@@ -98,6 +98,54 @@ uint8_t MIDI_Host_ConfigurePipes(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceI
 	return MIDI_ENUMERROR_NoError;
 }
 
+uint8_t MIDI_Host_ConfigurePipesFromIndex(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
+                                          const USB_ConfigIndex_t* const ConfigIndex)
+{
+	const USB_ConfigIndex_Endpoint_t*  DataINEndpoint  = NULL;
+	const USB_ConfigIndex_Endpoint_t*  DataOUTEndpoint = NULL;
+	const USB_ConfigIndex_Interface_t* MIDIInterface   = NULL;
+
+	memset(&MIDIInterfaceInfo->State, 0x00, sizeof(MIDIInterfaceInfo->State));
+
+	while (!(DataINEndpoint) || !(DataOUTEndpoint))
+	{
+		MIDIInterface = USB_FindIndexedInterface(ConfigIndex, MIDIInterface, AUDIO_CSCP_AudioClass,
+		                                         AUDIO_CSCP_MIDIStreamingSubclass, AUDIO_CSCP_StreamingProtocol,
+		                                         CONFIG_INDEX_MATCH_ALL);
+
+		if (!(MIDIInterface))
+		  return MIDI_ENUMERROR_NoCompatibleInterfaceFound;
+
+		DataINEndpoint  = USB_FindIndexedEndpoint(ConfigIndex, MIDIInterface, ENDPOINT_DIR_IN,  EP_TYPE_BULK);
+		DataOUTEndpoint = USB_FindIndexedEndpoint(ConfigIndex, MIDIInterface, ENDPOINT_DIR_OUT, EP_TYPE_BULK);
+
+		if ((DataINEndpoint  && Pipe_IsEndpointBound(DataINEndpoint->EndpointAddress)) ||
+		    (DataOUTEndpoint && Pipe_IsEndpointBound(DataOUTEndpoint->EndpointAddress)))
+		{
+			DataINEndpoint = NULL;
+		}
+	}
+
+	MIDIInterfaceInfo->Config.DataINPipe.Size  = DataINEndpoint->EndpointSize;
+	MIDIInterfaceInfo->Config.DataINPipe.EndpointAddress = DataINEndpoint->EndpointAddress;
+	MIDIInterfaceInfo->Config.DataINPipe.Type  = EP_TYPE_BULK;
+
+	MIDIInterfaceInfo->Config.DataOUTPipe.Size = DataOUTEndpoint->EndpointSize;
+	MIDIInterfaceInfo->Config.DataOUTPipe.EndpointAddress = DataOUTEndpoint->EndpointAddress;
+	MIDIInterfaceInfo->Config.DataOUTPipe.Type = EP_TYPE_BULK;
+
+	if (!(Pipe_ConfigurePipeTable(&MIDIInterfaceInfo->Config.DataINPipe, 1)))
+	  return MIDI_ENUMERROR_PipeConfigurationFailed;
+
+	if (!(Pipe_ConfigurePipeTable(&MIDIInterfaceInfo->Config.DataOUTPipe, 1)))
+	  return MIDI_ENUMERROR_PipeConfigurationFailed;
+
+	MIDIInterfaceInfo->State.InterfaceNumber = MIDIInterface->InterfaceNumber;
+	MIDIInterfaceInfo->State.IsActive = true;
+
+	return MIDI_ENUMERROR_NoError;
+}
+
 static uint8_t DCOMP_MIDI_Host_NextMIDIStreamingInterface(void* const CurrentDescriptor)
 {
 	USB_Descriptor_Header_t* Header = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Header_t);
@@ -144,6 +192,17 @@ void MIDI_Host_USBTask(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo)
 	  return;
 
 	#if !defined(NO_CLASS_DRIVER_AUTOFLUSH)
+	if (MIDIInterfaceInfo->Config.FlushIntervalFrames)
+	{
+		uint16_t CurrentFrame = USB_Host_GetFrameNumber();
+		uint16_t ElapsedFrames = ((CurrentFrame - MIDIInterfaceInfo->State.LastFlushFrame) & MIDI_FRAME_NUMBER_MASK);
+
+		if (ElapsedFrames < MIDIInterfaceInfo->Config.FlushIntervalFrames)
+		  return;
+
+		MIDIInterfaceInfo->State.LastFlushFrame = CurrentFrame;
+	}
+
 	MIDI_Host_Flush(MIDIInterfaceInfo);
 	#endif
 }
@@ -176,6 +235,13 @@ uint8_t MIDI_Host_Flush(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo)
 
 uint8_t MIDI_Host_SendEventPacket(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
                                   MIDI_EventPacket_t* const Event)
+{
+	return MIDI_Host_SendEventPackets(MIDIInterfaceInfo, Event, 1);
+}
+
+uint8_t MIDI_Host_SendEventPackets(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
+                                   const MIDI_EventPacket_t* const Events,
+                                   const uint8_t TotalEvents)
 {
 	if ((USB_HostState != HOST_STATE_Configured) || !(MIDIInterfaceInfo->State.IsActive))
 	  return HOST_SENDCONTROL_DeviceDisconnected;
@@ -185,7 +251,7 @@ uint8_t MIDI_Host_SendEventPacket(USB_ClassInfo_MIDI_Host_t* const MIDIInterface
 	Pipe_SelectPipe(MIDIInterfaceInfo->Config.DataOUTPipe.Address);
 	Pipe_Unfreeze();
 
-	if ((ErrorCode = Pipe_Write_Stream_LE(Event, sizeof(MIDI_EventPacket_t), NULL)) != PIPE_RWSTREAM_NoError)
+	if ((ErrorCode = Pipe_Write_Stream_LE(Events, (TotalEvents * sizeof(MIDI_EventPacket_t)), NULL)) != PIPE_RWSTREAM_NoError)
 	{
 		Pipe_Freeze();
 		return ErrorCode;
@@ -201,30 +267,40 @@ uint8_t MIDI_Host_SendEventPacket(USB_ClassInfo_MIDI_Host_t* const MIDIInterface
 
 bool MIDI_Host_ReceiveEventPacket(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
                                   MIDI_EventPacket_t* const Event)
+{
+	return (MIDI_Host_ReceiveEventPackets(MIDIInterfaceInfo, Event, 1) != 0);
+}
+
+uint8_t MIDI_Host_ReceiveEventPackets(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
+                                      MIDI_EventPacket_t* const Events,
+                                      const uint8_t MaxEvents)
 {
 	if ((USB_HostState != HOST_STATE_Configured) || !(MIDIInterfaceInfo->State.IsActive))
-	  return HOST_SENDCONTROL_DeviceDisconnected;
+	  return 0;
 
-	bool DataReady = false;
+	uint16_t TotalEvents = 0;
 
 	Pipe_SelectPipe(MIDIInterfaceInfo->Config.DataINPipe.Address);
 	Pipe_Unfreeze();
 
 	if (Pipe_IsINReceived())
 	{
-		if (Pipe_BytesInPipe())
-		{
-			Pipe_Read_Stream_LE(Event, sizeof(MIDI_EventPacket_t), NULL);
-			DataReady = true;
-		}
+		TotalEvents = (Pipe_BytesInPipe() / sizeof(MIDI_EventPacket_t));
+
+		if (TotalEvents > MaxEvents)
+		  TotalEvents = MaxEvents;
+
+		if (TotalEvents)
+		  Pipe_Read_Stream_LE(Events, (TotalEvents * sizeof(MIDI_EventPacket_t)), NULL);
 
-		if (!(Pipe_BytesInPipe()))
+		/* Release the bank once all complete events have been read, discarding any incomplete trailing event */
+		if (Pipe_BytesInPipe() < sizeof(MIDI_EventPacket_t))
 		  Pipe_ClearIN();
 	}
 
 	Pipe_Freeze();
 
-	return DataReady;
+	return TotalEvents;
 }
 
 #endif
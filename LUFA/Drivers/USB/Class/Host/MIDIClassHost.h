@@ -81,6 +81,12 @@
 				{
 					USB_Pipe_Table_t DataINPipe; /**< Data IN Pipe configuration table. */
 					USB_Pipe_Table_t DataOUTPipe; /**< Data OUT Pipe configuration table. */
+
+					uint8_t  FlushIntervalFrames; /**< Minimum number of USB frames between automatic flushes of partially filled
+					                               *   OUT pipe banks by \ref MIDI_Host_USBTask(), so that dense event streams are
+					                               *   coalesced into full packets. Full banks are always sent immediately. If zero,
+					                               *   queued events are flushed on every call to \ref MIDI_Host_USBTask().
+					                               */
 				} Config; /**< Config data for the USB class interface within the device. All elements in this section
 				           *   <b>must</b> be set or the interface will fail to enumerate and operate correctly.
 				           */
@@ -91,6 +97,7 @@
 					                    *   Configured state.
 					                    */
 					uint8_t  InterfaceNumber; /**< Interface index of the MIDI interface within the attached device. */
+					uint16_t LastFlushFrame; /**< USB frame number of the last automatic flush of the OUT pipe. */
 				} State; /**< State data for the USB class interface within the device. All elements in this section
 						  *   <b>may</b> be set to initial values, but may also be ignored to default to sane values when
 						  *   the interface is enumerated.
@@ -124,6 +131,21 @@
 			                                 uint16_t ConfigDescriptorSize,
 			                                 void* ConfigDescriptorData) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
 
+			/** Host interface configuration routine, to configure a given MIDI host interface instance using a configuration
+			 *  descriptor index built by \ref USB_BuildConfigIndex() from the attached device's Configuration Descriptor. This
+			 *  behaves identically to \ref MIDI_Host_ConfigurePipes(), but searches the compact index rather than the raw
+			 *  descriptor data, so that several class drivers may be configured from a single pass over the descriptor of a
+			 *  composite device.
+			 *
+			 *  \param[in,out] MIDIInterfaceInfo  Pointer to a structure containing an MIDI Class host configuration and state.
+			 *  \param[in]     ConfigIndex        Pointer to the attached device's configuration descriptor index.
+			 *
+			 *  \return A value from the \ref MIDI_Host_EnumerationFailure_ErrorCodes_t enum.
+			 */
+			uint8_t MIDI_Host_ConfigurePipesFromIndex(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
+			                                          const USB_ConfigIndex_t* const ConfigIndex) ATTR_NON_NULL_PTR_ARG(1)
+			                                          ATTR_NON_NULL_PTR_ARG(2);
+
 			/** General management task for a given MIDI host class interface, required for the correct operation of the interface. This should
 			 *  be called frequently in the main program loop, before the master USB management task \ref USB_USBTask().
 			 *
@@ -144,6 +166,24 @@
 			uint8_t MIDI_Host_SendEventPacket(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
 			                                  MIDI_EventPacket_t* const Event) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 
+			/** Sends an array of MIDI event packets to the device. If no device is connected, the event packets are discarded. The
+			 *  pipe is selected and unfrozen once for the entire array and the events are written as a single stream, so that up to
+			 *  \ref MIDI_EVENTS_PER_PACKET() events are packed into each pipe packet. Each pipe bank is sent as soon as it is full;
+			 *  any remaining events are queued until the bank is full or \ref MIDI_Host_Flush() is called.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] MIDIInterfaceInfo  Pointer to a structure containing a MIDI Class configuration and state.
+			 *  \param[in]     Events             Pointer to an array of populated \ref MIDI_EventPacket_t structures to send.
+			 *  \param[in]     TotalEvents        Number of MIDI event packets in the array to send.
+			 *
+			 *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum.
+			 */
+			uint8_t MIDI_Host_SendEventPackets(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
+			                                   const MIDI_EventPacket_t* const Events,
+			                                   const uint8_t TotalEvents) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+
 			/** Flushes the MIDI send buffer, sending any queued MIDI events to the device. This should be called to override the
 			 *  \ref MIDI_Host_SendEventPacket() function's packing behavior, to flush queued events. Events are queued into the
 			 *  pipe bank until either the pipe bank is full, or \ref MIDI_Host_Flush() is called. This allows for multiple MIDI
@@ -168,6 +208,24 @@
 			bool MIDI_Host_ReceiveEventPacket(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
 			                                  MIDI_EventPacket_t* const Event) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 
+			/** Receives up to the given number of MIDI event packets from the device in a single call. The events still waiting in
+			 *  the current IN pipe bank are read as a single stream, and the bank is released once it has been emptied. An array of
+			 *  \ref MIDI_EVENTS_PER_PACKET() events is sufficient to empty a full pipe bank in one call.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] MIDIInterfaceInfo  Pointer to a structure containing a MIDI Class configuration and state.
+			 *  \param[out]    Events             Pointer to an array of \ref MIDI_EventPacket_t structures where the received events
+			 *                                    are to be placed.
+			 *  \param[in]     MaxEvents          Maximum number of MIDI event packets to store into the array.
+			 *
+			 *  \return Number of MIDI event packets received, zero if no events were received.
+			 */
+			uint8_t MIDI_Host_ReceiveEventPackets(USB_ClassInfo_MIDI_Host_t* const MIDIInterfaceInfo,
+			                                      MIDI_EventPacket_t* const Events,
+			                                      const uint8_t MaxEvents) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+
 	/* Private Interface - For use in library only: */
 	#if !defined(__DOXYGEN__)
 		/* Function Prototypes: */
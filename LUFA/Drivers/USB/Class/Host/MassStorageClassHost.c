@@ -98,6 +98,54 @@ uint8_t MS_Host_ConfigurePipes(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
 	return MS_ENUMERROR_NoError;
 }
 
+uint8_t MS_Host_ConfigurePipesFromIndex(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+                                        const USB_ConfigIndex_t* const ConfigIndex)
+{
+	const USB_ConfigIndex_Endpoint_t*  DataINEndpoint       = NULL;
+	const USB_ConfigIndex_Endpoint_t*  DataOUTEndpoint      = NULL;
+	const USB_ConfigIndex_Interface_t* MassStorageInterface = NULL;
+
+	memset(&MSInterfaceInfo->State, 0x00, sizeof(MSInterfaceInfo->State));
+
+	while (!(DataINEndpoint) || !(DataOUTEndpoint))
+	{
+		MassStorageInterface = USB_FindIndexedInterface(ConfigIndex, MassStorageInterface, MS_CSCP_MassStorageClass,
+		                                                MS_CSCP_SCSITransparentSubclass, MS_CSCP_BulkOnlyTransportProtocol,
+		                                                CONFIG_INDEX_MATCH_ALL);
+
+		if (!(MassStorageInterface))
+		  return MS_ENUMERROR_NoCompatibleInterfaceFound;
+
+		DataINEndpoint  = USB_FindIndexedEndpoint(ConfigIndex, MassStorageInterface, ENDPOINT_DIR_IN,  EP_TYPE_BULK);
+		DataOUTEndpoint = USB_FindIndexedEndpoint(ConfigIndex, MassStorageInterface, ENDPOINT_DIR_OUT, EP_TYPE_BULK);
+
+		if ((DataINEndpoint  && Pipe_IsEndpointBound(DataINEndpoint->EndpointAddress)) ||
+		    (DataOUTEndpoint && Pipe_IsEndpointBound(DataOUTEndpoint->EndpointAddress)))
+		{
+			DataINEndpoint = NULL;
+		}
+	}
+
+	MSInterfaceInfo->Config.DataINPipe.Size  = DataINEndpoint->EndpointSize;
+	MSInterfaceInfo->Config.DataINPipe.EndpointAddress = DataINEndpoint->EndpointAddress;
+	MSInterfaceInfo->Config.DataINPipe.Type  = EP_TYPE_BULK;
+
+	MSInterfaceInfo->Config.DataOUTPipe.Size = DataOUTEndpoint->EndpointSize;
+	MSInterfaceInfo->Config.DataOUTPipe.EndpointAddress = DataOUTEndpoint->EndpointAddress;
+	MSInterfaceInfo->Config.DataOUTPipe.Type = EP_TYPE_BULK;
+
+	if (!(Pipe_ConfigurePipeTable(&MSInterfaceInfo->Config.DataINPipe, 1)))
+	  return MS_ENUMERROR_PipeConfigurationFailed;
+
+	if (!(Pipe_ConfigurePipeTable(&MSInterfaceInfo->Config.DataOUTPipe, 1)))
+	  return MS_ENUMERROR_PipeConfigurationFailed;
+
+	MSInterfaceInfo->State.InterfaceNumber = MassStorageInterface->InterfaceNumber;
+	MSInterfaceInfo->State.IsActive = true;
+
+	return MS_ENUMERROR_NoError;
+}
+
 static uint8_t DCOMP_MS_Host_NextMSInterface(void* const CurrentDescriptor)
 {
 	USB_Descriptor_Header_t* Header = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Header_t);
@@ -146,6 +194,29 @@ static uint8_t MS_Host_SendCommand(USB_ClassInfo_MS_Host_t* const MSInterfaceInf
 {
 	uint8_t ErrorCode = PIPE_RWSTREAM_NoError;
 
+	if ((ErrorCode = MS_Host_SendCommandBlock(MSInterfaceInfo, SCSICommandBlock)) != PIPE_RWSTREAM_NoError)
+	  return ErrorCode;
+
+	if (BufferPtr != NULL)
+	{
+		ErrorCode = MS_Host_SendReceiveData(MSInterfaceInfo, SCSICommandBlock, (void*)BufferPtr);
+
+		if ((ErrorCode != PIPE_RWSTREAM_NoError) && (ErrorCode != PIPE_RWSTREAM_PipeStalled))
+		{
+			Pipe_Freeze();
+			return ErrorCode;
+		}
+	}
+
+	MS_CommandStatusWrapper_t SCSIStatusBlock;
+	return MS_Host_GetReturnedStatus(MSInterfaceInfo, &SCSIStatusBlock);
+}
+
+static uint8_t MS_Host_SendCommandBlock(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+                                        MS_CommandBlockWrapper_t* const SCSICommandBlock)
+{
+	uint8_t ErrorCode = PIPE_RWSTREAM_NoError;
+
 	if (++MSInterfaceInfo->State.TransactionTag == 0xFFFFFFFF)
 	  MSInterfaceInfo->State.TransactionTag = 1;
 
@@ -166,19 +237,11 @@ static uint8_t MS_Host_SendCommand(USB_ClassInfo_MS_Host_t* const MSInterfaceInf
 
 	Pipe_Freeze();
 
-	if (BufferPtr != NULL)
-	{
-		ErrorCode = MS_Host_SendReceiveData(MSInterfaceInfo, SCSICommandBlock, (void*)BufferPtr);
+	/* A device rejecting the command block stalls the OUT pipe, which must be cleared before the status is read */
+	if (Pipe_IsStalled())
+	  USB_Host_ClearEndpointStall(Pipe_GetBoundEndpointAddress());
 
-		if ((ErrorCode != PIPE_RWSTREAM_NoError) && (ErrorCode != PIPE_RWSTREAM_PipeStalled))
-		{
-			Pipe_Freeze();
-			return ErrorCode;
-		}
-	}
-
-	MS_CommandStatusWrapper_t SCSIStatusBlock;
-	return MS_Host_GetReturnedStatus(MSInterfaceInfo, &SCSIStatusBlock);
+	return PIPE_RWSTREAM_NoError;
 }
 
 static uint8_t MS_Host_WaitForDataReceived(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo)
@@ -186,6 +249,7 @@ static uint8_t MS_Host_WaitForDataReceived(USB_ClassInfo_MS_Host_t* const MSInte
 	uint16_t TimeoutMSRem        = MS_COMMAND_DATA_TIMEOUT_MS;
 	uint16_t PreviousFrameNumber = USB_Host_GetFrameNumber();
 
+	/* The OUT pipe is idle while waiting for IN data, so only the IN pipe is left unfrozen and checked for stalls */
 	Pipe_SelectPipe(MSInterfaceInfo->Config.DataINPipe.Address);
 	Pipe_Unfreeze();
 
@@ -198,25 +262,15 @@ static uint8_t MS_Host_WaitForDataReceived(USB_ClassInfo_MS_Host_t* const MSInte
 			PreviousFrameNumber = CurrentFrameNumber;
 
 			if (!(TimeoutMSRem--))
-			  return PIPE_RWSTREAM_Timeout;
-		}
-
-		Pipe_Freeze();
-		Pipe_SelectPipe(MSInterfaceInfo->Config.DataOUTPipe.Address);
-		Pipe_Unfreeze();
-
-		if (Pipe_IsStalled())
-		{
-			USB_Host_ClearEndpointStall(Pipe_GetBoundEndpointAddress());
-			return PIPE_RWSTREAM_PipeStalled;
+			{
+				Pipe_Freeze();
+				return PIPE_RWSTREAM_Timeout;
+			}
 		}
 
-		Pipe_Freeze();
-		Pipe_SelectPipe(MSInterfaceInfo->Config.DataINPipe.Address);
-		Pipe_Unfreeze();
-
 		if (Pipe_IsStalled())
 		{
+			Pipe_Freeze();
 			USB_Host_ClearEndpointStall(Pipe_GetBoundEndpointAddress());
 			return PIPE_RWSTREAM_PipeStalled;
 		}
@@ -225,10 +279,6 @@ static uint8_t MS_Host_WaitForDataReceived(USB_ClassInfo_MS_Host_t* const MSInte
 		  return PIPE_RWSTREAM_DeviceDisconnected;
 	};
 
-	Pipe_SelectPipe(MSInterfaceInfo->Config.DataINPipe.Address);
-	Pipe_Freeze();
-
-	Pipe_SelectPipe(MSInterfaceInfo->Config.DataOUTPipe.Address);
 	Pipe_Freeze();
 
 	return PIPE_RWSTREAM_NoError;
@@ -263,7 +313,12 @@ static uint8_t MS_Host_SendReceiveData(USB_ClassInfo_MS_Host_t* const MSInterfac
 		Pipe_Unfreeze();
 
 		if ((ErrorCode = Pipe_Write_Stream_LE(BufferPtr, BytesRem, NULL)) != PIPE_RWSTREAM_NoError)
-		  return ErrorCode;
+		{
+			if (ErrorCode == PIPE_RWSTREAM_PipeStalled)
+			  USB_Host_ClearEndpointStall(Pipe_GetBoundEndpointAddress());
+
+			return ErrorCode;
+		}
 
 		Pipe_ClearOUT();
 
@@ -279,6 +334,32 @@ static uint8_t MS_Host_SendReceiveData(USB_ClassInfo_MS_Host_t* const MSInterfac
 	return ErrorCode;
 }
 
+static uint8_t MS_Host_ReceiveDataSegments(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+                                           void* const Segments[],
+                                           const uint8_t TotalSegments,
+                                           const uint16_t SegmentSize)
+{
+	uint8_t ErrorCode = PIPE_RWSTREAM_NoError;
+
+	if ((ErrorCode = MS_Host_WaitForDataReceived(MSInterfaceInfo)) != PIPE_RWSTREAM_NoError)
+	  return ErrorCode;
+
+	Pipe_SelectPipe(MSInterfaceInfo->Config.DataINPipe.Address);
+	Pipe_Unfreeze();
+
+	/* Each segment continues reading from the bank the previous segment left off in, so the transfer is not interrupted */
+	for (uint8_t Segment = 0; Segment < TotalSegments; Segment++)
+	{
+		if ((ErrorCode = Pipe_Read_Stream_LE(Segments[Segment], SegmentSize, NULL)) != PIPE_RWSTREAM_NoError)
+		  return ErrorCode;
+	}
+
+	Pipe_ClearIN();
+	Pipe_Freeze();
+
+	return ErrorCode;
+}
+
 static uint8_t MS_Host_GetReturnedStatus(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
                                          MS_CommandStatusWrapper_t* const SCSICommandStatus)
 {
@@ -541,6 +622,54 @@ uint8_t MS_Host_ReadDeviceBlocks(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
 	return MS_Host_SendCommand(MSInterfaceInfo, &SCSICommandBlock, BlockBuffer);
 }
 
+uint8_t MS_Host_ReadDeviceBlocksScattered(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+                                          const uint8_t LUNIndex,
+                                          const uint32_t BlockAddress,
+                                          const uint8_t Blocks,
+                                          const uint16_t BlockSize,
+                                          void* const BlockBuffers[])
+{
+	uint8_t ErrorCode;
+
+	if ((USB_HostState != HOST_STATE_Configured) || !(MSInterfaceInfo->State.IsActive))
+	  return HOST_SENDCONTROL_DeviceDisconnected;
+
+	MS_CommandBlockWrapper_t SCSICommandBlock = (MS_CommandBlockWrapper_t)
+		{
+			.DataTransferLength = cpu_to_le32((uint32_t)Blocks * BlockSize),
+			.Flags              = MS_COMMAND_DIR_DATA_IN,
+			.LUN                = LUNIndex,
+			.SCSICommandLength  = 10,
+			.SCSICommandData    =
+				{
+					SCSI_CMD_READ_10,
+					0x00,                   // Unused (control bits, all off)
+					(BlockAddress >> 24),   // MSB of Block Address
+					(BlockAddress >> 16),
+					(BlockAddress >> 8),
+					(BlockAddress & 0xFF),  // LSB of Block Address
+					0x00,                   // Reserved
+					0x00,                   // MSB of Total Blocks to Read
+					Blocks,                 // LSB of Total Blocks to Read
+					0x00                    // Unused (control)
+				}
+		};
+
+	if ((ErrorCode = MS_Host_SendCommandBlock(MSInterfaceInfo, &SCSICommandBlock)) != PIPE_RWSTREAM_NoError)
+	  return ErrorCode;
+
+	ErrorCode = MS_Host_ReceiveDataSegments(MSInterfaceInfo, BlockBuffers, Blocks, BlockSize);
+
+	if ((ErrorCode != PIPE_RWSTREAM_NoError) && (ErrorCode != PIPE_RWSTREAM_PipeStalled))
+	{
+		Pipe_Freeze();
+		return ErrorCode;
+	}
+
+	MS_CommandStatusWrapper_t SCSIStatusBlock;
+	return MS_Host_GetReturnedStatus(MSInterfaceInfo, &SCSIStatusBlock);
+}
+
 uint8_t MS_Host_WriteDeviceBlocks(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
                                   const uint8_t LUNIndex,
                                   const uint32_t BlockAddress,
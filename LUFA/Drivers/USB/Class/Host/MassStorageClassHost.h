@@ -142,6 +142,21 @@
 			                               uint16_t ConfigDescriptorSize,
 			                               void* DeviceConfigDescriptor) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
 
+			/** Host interface configuration routine, to configure a given Mass Storage host interface instance using a
+			 *  configuration descriptor index built by \ref USB_BuildConfigIndex() from the attached device's Configuration
+			 *  Descriptor. This behaves identically to \ref MS_Host_ConfigurePipes(), but searches the compact index rather
+			 *  than the raw descriptor data, so that several class drivers may be configured from a single pass over the
+			 *  descriptor of a composite device.
+			 *
+			 *  \param[in,out] MSInterfaceInfo  Pointer to a structure containing an MS Class host configuration and state.
+			 *  \param[in]     ConfigIndex      Pointer to the attached device's configuration descriptor index.
+			 *
+			 *  \return A value from the \ref MS_Host_EnumerationFailure_ErrorCodes_t enum.
+			 */
+			uint8_t MS_Host_ConfigurePipesFromIndex(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+			                                        const USB_ConfigIndex_t* const ConfigIndex) ATTR_NON_NULL_PTR_ARG(1)
+			                                        ATTR_NON_NULL_PTR_ARG(2);
+
 			/** Sends a MASS STORAGE RESET control request to the attached device, resetting the Mass Storage Interface
 			 *  and readying it for the next Mass Storage command. This should be called after a failed SCSI request to
 			 *  ensure the attached Mass Storage device is ready to receive the next command.
@@ -265,6 +280,29 @@
 			                                 const uint16_t BlockSize,
 			                                 void* BlockBuffer) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(6);
 
+			/** Reads blocks of data from the attached Mass Storage device's medium in a single transfer, storing each block
+			 *  into its own buffer as it is received. This allows a large contiguous read to be streamed directly into
+			 *  non-contiguous destinations, such as the slots of a block cache, without an intermediate copy.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] MSInterfaceInfo  Pointer to a structure containing a MS Class host configuration and state.
+			 *  \param[in]     LUNIndex         LUN index within the device the command is being issued to.
+			 *  \param[in]     BlockAddress     Starting block address within the device to read from.
+			 *  \param[in]     Blocks           Total number of blocks to read.
+			 *  \param[in]     BlockSize        Size in bytes of each block within the device.
+			 *  \param[out]    BlockBuffers     Array of pointers to where each of the read blocks should be stored, one per block.
+			 *
+			 *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum or \ref MS_ERROR_LOGICAL_CMD_FAILED if not ready.
+			 */
+			uint8_t MS_Host_ReadDeviceBlocksScattered(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+			                                          const uint8_t LUNIndex,
+			                                          const uint32_t BlockAddress,
+			                                          const uint8_t Blocks,
+			                                          const uint16_t BlockSize,
+			                                          void* const BlockBuffers[]) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(6);
+
 			/** Writes blocks of data to the attached Mass Storage device's medium.
 			 *
 			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
@@ -309,10 +347,17 @@
 				static uint8_t MS_Host_SendCommand(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
 				                                   MS_CommandBlockWrapper_t* const SCSICommandBlock,
 				                                   const void* const BufferPtr) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+				static uint8_t MS_Host_SendCommandBlock(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+				                                        MS_CommandBlockWrapper_t* const SCSICommandBlock)
+				                                        ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 				static uint8_t MS_Host_WaitForDataReceived(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo) ATTR_NON_NULL_PTR_ARG(1);
 				static uint8_t MS_Host_SendReceiveData(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
 				                                       MS_CommandBlockWrapper_t* const SCSICommandBlock,
 				                                       void* BufferPtr) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+				static uint8_t MS_Host_ReceiveDataSegments(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
+				                                           void* const Segments[],
+				                                           const uint8_t TotalSegments,
+				                                           const uint16_t SegmentSize) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 				static uint8_t MS_Host_GetReturnedStatus(USB_ClassInfo_MS_Host_t* const MSInterfaceInfo,
 				                                         MS_CommandStatusWrapper_t* const SCSICommandStatus)
 				                                         ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
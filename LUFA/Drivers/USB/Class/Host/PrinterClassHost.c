@@ -99,6 +99,55 @@ uint8_t PRNT_Host_ConfigurePipes(USB_ClassInfo_PRNT_Host_t* const PRNTInterfaceI
 	return PRNT_ENUMERROR_NoError;
 }
 
+uint8_t PRNT_Host_ConfigurePipesFromIndex(USB_ClassInfo_PRNT_Host_t* const PRNTInterfaceInfo,
+                                          const USB_ConfigIndex_t* const ConfigIndex)
+{
+	const USB_ConfigIndex_Endpoint_t*  DataINEndpoint   = NULL;
+	const USB_ConfigIndex_Endpoint_t*  DataOUTEndpoint  = NULL;
+	const USB_ConfigIndex_Interface_t* PrinterInterface = NULL;
+
+	memset(&PRNTInterfaceInfo->State, 0x00, sizeof(PRNTInterfaceInfo->State));
+
+	while (!(DataINEndpoint) || !(DataOUTEndpoint))
+	{
+		PrinterInterface = USB_FindIndexedInterface(ConfigIndex, PrinterInterface, PRNT_CSCP_PrinterClass,
+		                                            PRNT_CSCP_PrinterSubclass, PRNT_CSCP_BidirectionalProtocol,
+		                                            CONFIG_INDEX_MATCH_ALL);
+
+		if (!(PrinterInterface))
+		  return PRNT_ENUMERROR_NoCompatibleInterfaceFound;
+
+		DataINEndpoint  = USB_FindIndexedEndpoint(ConfigIndex, PrinterInterface, ENDPOINT_DIR_IN,  EP_TYPE_BULK);
+		DataOUTEndpoint = USB_FindIndexedEndpoint(ConfigIndex, PrinterInterface, ENDPOINT_DIR_OUT, EP_TYPE_BULK);
+
+		if ((DataINEndpoint  && Pipe_IsEndpointBound(DataINEndpoint->EndpointAddress)) ||
+		    (DataOUTEndpoint && Pipe_IsEndpointBound(DataOUTEndpoint->EndpointAddress)))
+		{
+			DataINEndpoint = NULL;
+		}
+	}
+
+	PRNTInterfaceInfo->Config.DataINPipe.Size  = DataINEndpoint->EndpointSize;
+	PRNTInterfaceInfo->Config.DataINPipe.EndpointAddress = DataINEndpoint->EndpointAddress;
+	PRNTInterfaceInfo->Config.DataINPipe.Type  = EP_TYPE_BULK;
+
+	PRNTInterfaceInfo->Config.DataOUTPipe.Size = DataOUTEndpoint->EndpointSize;
+	PRNTInterfaceInfo->Config.DataOUTPipe.EndpointAddress = DataOUTEndpoint->EndpointAddress;
+	PRNTInterfaceInfo->Config.DataOUTPipe.Type = EP_TYPE_BULK;
+
+	if (!(Pipe_ConfigurePipeTable(&PRNTInterfaceInfo->Config.DataINPipe, 1)))
+	  return PRNT_ENUMERROR_PipeConfigurationFailed;
+
+	if (!(Pipe_ConfigurePipeTable(&PRNTInterfaceInfo->Config.DataOUTPipe, 1)))
+	  return PRNT_ENUMERROR_PipeConfigurationFailed;
+
+	PRNTInterfaceInfo->State.InterfaceNumber  = PrinterInterface->InterfaceNumber;
+	PRNTInterfaceInfo->State.AlternateSetting = PrinterInterface->AlternateSetting;
+	PRNTInterfaceInfo->State.IsActive = true;
+
+	return PRNT_ENUMERROR_NoError;
+}
+
 static uint8_t DCOMP_PRNT_Host_NextPRNTInterface(void* CurrentDescriptor)
 {
 	USB_Descriptor_Header_t* Header = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Header_t);
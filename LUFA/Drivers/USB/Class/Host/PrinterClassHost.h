@@ -125,6 +125,21 @@
 			                                 uint16_t ConfigDescriptorSize,
 			                                 void* ConfigDescriptorData) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
 
+			/** Host interface configuration routine, to configure a given Printer host interface instance using a configuration
+			 *  descriptor index built by \ref USB_BuildConfigIndex() from the attached device's Configuration Descriptor. This
+			 *  behaves identically to \ref PRNT_Host_ConfigurePipes(), but searches the compact index rather than the raw
+			 *  descriptor data, so that several class drivers may be configured from a single pass over the descriptor of a
+			 *  composite device.
+			 *
+			 *  \param[in,out] PRNTInterfaceInfo  Pointer to a structure containing a Printer Class host configuration and state.
+			 *  \param[in]     ConfigIndex        Pointer to the attached device's configuration descriptor index.
+			 *
+			 *  \return A value from the \ref PRNT_Host_EnumerationFailure_ErrorCodes_t enum.
+			 */
+			uint8_t PRNT_Host_ConfigurePipesFromIndex(USB_ClassInfo_PRNT_Host_t* const PRNTInterfaceInfo,
+			                                          const USB_ConfigIndex_t* const ConfigIndex) ATTR_NON_NULL_PTR_ARG(1)
+			                                          ATTR_NON_NULL_PTR_ARG(2);
+
 			/** General management task for a given Printer host class interface, required for the correct operation of
 			 *  the interface. This should be called frequently in the main program loop, before the master USB management task
 			 *  \ref USB_USBTask().
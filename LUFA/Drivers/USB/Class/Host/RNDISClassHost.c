@@ -128,6 +128,79 @@ uint8_t RNDIS_Host_ConfigurePipes(USB_ClassInfo_RNDIS_Host_t* const RNDISInterfa
 	return RNDIS_ENUMERROR_NoError;
 }
 
+uint8_t RNDIS_Host_ConfigurePipesFromIndex(USB_ClassInfo_RNDIS_Host_t* const RNDISInterfaceInfo,
+                                           const USB_ConfigIndex_t* const ConfigIndex)
+{
+	const USB_ConfigIndex_Endpoint_t*  DataINEndpoint        = NULL;
+	const USB_ConfigIndex_Endpoint_t*  DataOUTEndpoint       = NULL;
+	const USB_ConfigIndex_Endpoint_t*  NotificationEndpoint  = NULL;
+	const USB_ConfigIndex_Interface_t* RNDISControlInterface = NULL;
+
+	memset(&RNDISInterfaceInfo->State, 0x00, sizeof(RNDISInterfaceInfo->State));
+
+	while (!(DataINEndpoint) || !(DataOUTEndpoint) || !(NotificationEndpoint))
+	{
+		RNDISControlInterface = USB_FindIndexedInterface(ConfigIndex, RNDISControlInterface, CDC_CSCP_CDCClass,
+		                                                 CDC_CSCP_ACMSubclass, CDC_CSCP_VendorSpecificProtocol,
+		                                                 CONFIG_INDEX_MATCH_ALL);
+
+		if (!(RNDISControlInterface))
+		  return RNDIS_ENUMERROR_NoCompatibleInterfaceFound;
+
+		NotificationEndpoint = USB_FindIndexedEndpoint(ConfigIndex, RNDISControlInterface, ENDPOINT_DIR_IN, EP_TYPE_INTERRUPT);
+
+		if (!(NotificationEndpoint) || Pipe_IsEndpointBound(NotificationEndpoint->EndpointAddress))
+		{
+			NotificationEndpoint = NULL;
+			continue;
+		}
+
+		const USB_ConfigIndex_Interface_t* RNDISDataInterface = USB_FindIndexedInterface(ConfigIndex, RNDISControlInterface,
+		                                                                                 CDC_CSCP_CDCDataClass,
+		                                                                                 CDC_CSCP_NoDataSubclass,
+		                                                                                 CDC_CSCP_NoDataProtocol,
+		                                                                                 CONFIG_INDEX_MATCH_ALL);
+
+		if (!(RNDISDataInterface))
+		  return RNDIS_ENUMERROR_NoCompatibleInterfaceFound;
+
+		DataINEndpoint  = USB_FindIndexedEndpoint(ConfigIndex, RNDISDataInterface, ENDPOINT_DIR_IN,  EP_TYPE_BULK);
+		DataOUTEndpoint = USB_FindIndexedEndpoint(ConfigIndex, RNDISDataInterface, ENDPOINT_DIR_OUT, EP_TYPE_BULK);
+
+		if ((DataINEndpoint  && Pipe_IsEndpointBound(DataINEndpoint->EndpointAddress)) ||
+		    (DataOUTEndpoint && Pipe_IsEndpointBound(DataOUTEndpoint->EndpointAddress)))
+		{
+			DataINEndpoint = NULL;
+		}
+	}
+
+	RNDISInterfaceInfo->Config.DataINPipe.Size  = DataINEndpoint->EndpointSize;
+	RNDISInterfaceInfo->Config.DataINPipe.EndpointAddress = DataINEndpoint->EndpointAddress;
+	RNDISInterfaceInfo->Config.DataINPipe.Type  = EP_TYPE_BULK;
+
+	RNDISInterfaceInfo->Config.DataOUTPipe.Size = DataOUTEndpoint->EndpointSize;
+	RNDISInterfaceInfo->Config.DataOUTPipe.EndpointAddress = DataOUTEndpoint->EndpointAddress;
+	RNDISInterfaceInfo->Config.DataOUTPipe.Type = EP_TYPE_BULK;
+
+	RNDISInterfaceInfo->Config.NotificationPipe.Size = NotificationEndpoint->EndpointSize;
+	RNDISInterfaceInfo->Config.NotificationPipe.EndpointAddress = NotificationEndpoint->EndpointAddress;
+	RNDISInterfaceInfo->Config.NotificationPipe.Type = EP_TYPE_INTERRUPT;
+
+	if (!(Pipe_ConfigurePipeTable(&RNDISInterfaceInfo->Config.DataINPipe, 1)))
+	  return RNDIS_ENUMERROR_PipeConfigurationFailed;
+
+	if (!(Pipe_ConfigurePipeTable(&RNDISInterfaceInfo->Config.DataOUTPipe, 1)))
+	  return RNDIS_ENUMERROR_PipeConfigurationFailed;
+
+	if (!(Pipe_ConfigurePipeTable(&RNDISInterfaceInfo->Config.NotificationPipe, 1)))
+	  return RNDIS_ENUMERROR_PipeConfigurationFailed;
+
+	RNDISInterfaceInfo->State.ControlInterfaceNumber = RNDISControlInterface->InterfaceNumber;
+	RNDISInterfaceInfo->State.IsActive = true;
+
+	return RNDIS_ENUMERROR_NoError;
+}
+
 static uint8_t DCOMP_RNDIS_Host_NextRNDISControlInterface(void* const CurrentDescriptor)
 {
 	USB_Descriptor_Header_t* Header = DESCRIPTOR_PCAST(CurrentDescriptor, USB_Descriptor_Header_t);
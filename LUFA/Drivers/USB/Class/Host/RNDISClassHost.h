@@ -132,6 +132,21 @@
 			                                  uint16_t ConfigDescriptorSize,
 			                                  void* ConfigDescriptorData) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
 
+			/** Host interface configuration routine, to configure a given RNDIS host interface instance using a configuration
+			 *  descriptor index built by \ref USB_BuildConfigIndex() from the attached device's Configuration Descriptor. This
+			 *  behaves identically to \ref RNDIS_Host_ConfigurePipes(), but searches the compact index rather than the raw
+			 *  descriptor data, so that several class drivers may be configured from a single pass over the descriptor of a
+			 *  composite device.
+			 *
+			 *  \param[in,out] RNDISInterfaceInfo  Pointer to a structure containing an RNDIS Class host configuration and state.
+			 *  \param[in]     ConfigIndex         Pointer to the attached device's configuration descriptor index.
+			 *
+			 *  \return A value from the \ref RNDIS_Host_EnumerationFailure_ErrorCodes_t enum.
+			 */
+			uint8_t RNDIS_Host_ConfigurePipesFromIndex(USB_ClassInfo_RNDIS_Host_t* const RNDISInterfaceInfo,
+			                                           const USB_ConfigIndex_t* const ConfigIndex) ATTR_NON_NULL_PTR_ARG(1)
+			                                           ATTR_NON_NULL_PTR_ARG(2);
+
 			/** Sends a RNDIS KEEPALIVE command to the device, to ensure that it does not enter standby mode after periods
 			 *  of long inactivity.
 			 *
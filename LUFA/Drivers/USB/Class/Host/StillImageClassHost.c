@@ -343,7 +343,7 @@ uint8_t SI_Host_OpenSession(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo)
 		{
 			.DataLength    = CPU_TO_LE32(PIMA_COMMAND_SIZE(1)),
 			.Type          = CPU_TO_LE16(PIMA_CONTAINER_CommandBlock),
-			.Code          = CPU_TO_LE16(0x1002),
+			.Code          = CPU_TO_LE16(PIMA_OPERATION_OpenSession),
 			.Params        = {CPU_TO_LE32(1)},
 		};
 
@@ -372,7 +372,7 @@ uint8_t SI_Host_CloseSession(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo)
 		{
 			.DataLength    = CPU_TO_LE32(PIMA_COMMAND_SIZE(1)),
 			.Type          = CPU_TO_LE16(PIMA_CONTAINER_CommandBlock),
-			.Code          = CPU_TO_LE16(0x1003),
+			.Code          = CPU_TO_LE16(PIMA_OPERATION_CloseSession),
 			.Params        = {CPU_TO_LE32(1)},
 		};
 
@@ -432,5 +432,279 @@ uint8_t SI_Host_ReceiveResponse(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo)
 	return PIPE_RWSTREAM_NoError;
 }
 
+static uint8_t SI_Host_StreamDataBlock(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+                                       uint32_t DataBytes,
+                                       SI_Host_DataSink_t Sink,
+                                       void* Context)
+{
+	uint8_t ChunkBuffer[SI_STREAM_CHUNK_SIZE];
+	uint8_t ErrorCode;
+	bool    SinkAborted = false;
+
+	Pipe_SelectPipe(SIInterfaceInfo->Config.DataINPipe.Address);
+	Pipe_Unfreeze();
+
+	while (DataBytes)
+	{
+		/* Release each bank as soon as it is drained, so the pipe can fill it again while the sink is busy */
+		if (!(Pipe_BytesInPipe()))
+		{
+			Pipe_ClearIN();
+
+			if ((ErrorCode = Pipe_WaitUntilReady()) != PIPE_READYWAIT_NoError)
+			{
+				Pipe_Freeze();
+				return ErrorCode;
+			}
+
+			continue;
+		}
+
+		uint16_t ChunkBytes = MIN(Pipe_BytesInPipe(), sizeof(ChunkBuffer));
+
+		if (ChunkBytes > DataBytes)
+		  ChunkBytes = DataBytes;
+
+		for (uint16_t i = 0; i < ChunkBytes; i++)
+		  ChunkBuffer[i] = Pipe_Read_8();
+
+		DataBytes -= ChunkBytes;
+
+		if (Sink && !(SinkAborted))
+		  SinkAborted = !(Sink(Context, ChunkBuffer, ChunkBytes));
+	}
+
+	Pipe_ClearIN();
+
+	/* Discard the zero length packet terminating the data phase, if the device sent one */
+	if ((Pipe_WaitUntilReady() == PIPE_READYWAIT_NoError) && !(Pipe_BytesInPipe()))
+	  Pipe_ClearIN();
+
+	Pipe_Freeze();
+
+	return (SinkAborted) ? SI_ERROR_DATA_SINK_ABORTED : PIPE_RWSTREAM_NoError;
+}
+
+uint8_t SI_Host_ReceiveTransaction(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+                                   const uint16_t Operation,
+                                   const uint8_t TotalParams,
+                                   uint32_t* const Params,
+                                   SI_Host_DataSink_t Sink,
+                                   void* Context)
+{
+	uint8_t ErrorCode;
+	uint8_t StreamErrorCode = PIPE_RWSTREAM_NoError;
+	PIMA_Container_t PIMABlock;
+
+	if ((USB_HostState != HOST_STATE_Configured) || !(SIInterfaceInfo->State.IsActive))
+	  return PIPE_RWSTREAM_DeviceDisconnected;
+
+	memset(&PIMABlock, 0x00, sizeof(PIMABlock));
+
+	if ((ErrorCode = SI_Host_SendCommand(SIInterfaceInfo, Operation, TotalParams, Params)) != PIPE_RWSTREAM_NoError)
+	  return ErrorCode;
+
+	if ((ErrorCode = SI_Host_ReceiveBlockHeader(SIInterfaceInfo, &PIMABlock)) != PIPE_RWSTREAM_NoError)
+	  return ErrorCode;
+
+	if (PIMABlock.Type == CPU_TO_LE16(PIMA_CONTAINER_DataBlock))
+	{
+		uint32_t DataBytes = le32_to_cpu(PIMABlock.DataLength);
+
+		DataBytes = (DataBytes > PIMA_DATA_SIZE(0)) ? (DataBytes - PIMA_DATA_SIZE(0)) : 0;
+
+		StreamErrorCode = SI_Host_StreamDataBlock(SIInterfaceInfo, DataBytes, Sink, Context);
+
+		if ((StreamErrorCode != PIPE_RWSTREAM_NoError) && (StreamErrorCode != SI_ERROR_DATA_SINK_ABORTED))
+		  return StreamErrorCode;
+
+		if ((ErrorCode = SI_Host_ReceiveBlockHeader(SIInterfaceInfo, &PIMABlock)) != PIPE_RWSTREAM_NoError)
+		  return ErrorCode;
+	}
+
+	if ((PIMABlock.Type != CPU_TO_LE16(PIMA_CONTAINER_ResponseBlock)) || (PIMABlock.Code != CPU_TO_LE16(0x2001)))
+	  return SI_ERROR_LOGICAL_CMD_FAILED;
+
+	if (TotalParams)
+	  memcpy(Params, &PIMABlock.Params, sizeof(uint32_t) * TotalParams);
+
+	return StreamErrorCode;
+}
+
+static bool SI_Host_HandleSink(void* Context,
+                               const uint8_t* Data,
+                               const uint16_t Length)
+{
+	SI_Host_HandleSinkContext_t* HandleContext = (SI_Host_HandleSinkContext_t*)Context;
+
+	for (uint16_t i = 0; i < Length; i++)
+	{
+		uint32_t Offset = HandleContext->Offset++;
+
+		if (Offset < sizeof(uint32_t))
+		  ((uint8_t*)HandleContext->TotalHandles)[Offset] = Data[i];
+		else if ((Offset - sizeof(uint32_t)) < ((uint32_t)HandleContext->MaxHandles * sizeof(uint32_t)))
+		  ((uint8_t*)HandleContext->Handles)[Offset - sizeof(uint32_t)] = Data[i];
+	}
+
+	return true;
+}
+
+uint8_t SI_Host_GetObjectHandles(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+                                 const uint32_t StorageID,
+                                 uint32_t* const Handles,
+                                 const uint16_t MaxHandles,
+                                 uint32_t* const TotalHandles)
+{
+	uint8_t  ErrorCode;
+	uint32_t Params[3] = {cpu_to_le32(StorageID), 0, 0};
+
+	SI_Host_HandleSinkContext_t HandleContext =
+		{
+			.Offset       = 0,
+			.Handles      = Handles,
+			.MaxHandles   = MaxHandles,
+			.TotalHandles = TotalHandles,
+		};
+
+	*TotalHandles = 0;
+
+	if ((ErrorCode = SI_Host_ReceiveTransaction(SIInterfaceInfo, PIMA_OPERATION_GetObjectHandles, 3, Params,
+	                                            SI_Host_HandleSink, &HandleContext)) != PIPE_RWSTREAM_NoError)
+	{
+		return ErrorCode;
+	}
+
+	*TotalHandles = le32_to_cpu(*TotalHandles);
+
+	for (uint16_t i = 0; i < MIN(*TotalHandles, MaxHandles); i++)
+	  Handles[i] = le32_to_cpu(Handles[i]);
+
+	return PIPE_RWSTREAM_NoError;
+}
+
+static bool SI_Host_ObjectInfoSink(void* Context,
+                                   const uint8_t* Data,
+                                   const uint16_t Length)
+{
+	SI_Host_ObjectInfoSinkContext_t* InfoContext = (SI_Host_ObjectInfoSinkContext_t*)Context;
+
+	for (uint16_t i = 0; i < Length; i++)
+	{
+		uint32_t Offset = InfoContext->Offset++;
+
+		if (Offset < sizeof(PIMA_ObjectInfo_t))
+		{
+			((uint8_t*)InfoContext->ObjectInfo)[Offset] = Data[i];
+		}
+		else if (Offset == sizeof(PIMA_ObjectInfo_t))
+		{
+			InfoContext->FilenameChars = Data[i];
+		}
+		else if (InfoContext->Filename)
+		{
+			/* Filename is a PIMA string of UTF-16 characters, keep only the ASCII subset */
+			uint32_t CharOffset = (Offset - sizeof(PIMA_ObjectInfo_t) - 1);
+			uint32_t CharIndex  = (CharOffset >> 1);
+
+			if ((CharIndex >= InfoContext->FilenameChars) || ((CharIndex + 1) >= InfoContext->FilenameSize))
+			  continue;
+
+			if (!(CharOffset & 0x01))
+			  InfoContext->Filename[CharIndex] = (Data[i] < 0x80) ? Data[i] : '_';
+			else if (Data[i])
+			  InfoContext->Filename[CharIndex] = '_';
+		}
+	}
+
+	return true;
+}
+
+uint8_t SI_Host_GetObjectInfo(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+                              const uint32_t Handle,
+                              PIMA_ObjectInfo_t* const ObjectInfo,
+                              char* const Filename,
+                              const uint8_t FilenameSize)
+{
+	uint32_t Params[1] = {cpu_to_le32(Handle)};
+
+	SI_Host_ObjectInfoSinkContext_t InfoContext =
+		{
+			.Offset        = 0,
+			.ObjectInfo    = ObjectInfo,
+			.Filename      = (FilenameSize) ? Filename : NULL,
+			.FilenameSize  = FilenameSize,
+			.FilenameChars = 0,
+		};
+
+	memset(ObjectInfo, 0x00, sizeof(PIMA_ObjectInfo_t));
+
+	if (InfoContext.Filename)
+	  memset(Filename, 0x00, FilenameSize);
+
+	return SI_Host_ReceiveTransaction(SIInterfaceInfo, PIMA_OPERATION_GetObjectInfo, 1, Params,
+	                                  SI_Host_ObjectInfoSink, &InfoContext);
+}
+
+uint8_t SI_Host_GetPartialObject(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+                                 const uint32_t Handle,
+                                 const uint32_t Offset,
+                                 const uint32_t MaxBytes,
+                                 SI_Host_DataSink_t Sink,
+                                 void* Context,
+                                 uint32_t* const BytesSent)
+{
+	uint8_t  ErrorCode;
+	uint32_t Params[3] = {cpu_to_le32(Handle), cpu_to_le32(Offset), cpu_to_le32(MaxBytes)};
+
+	*BytesSent = 0;
+
+	if ((ErrorCode = SI_Host_ReceiveTransaction(SIInterfaceInfo, PIMA_OPERATION_GetPartialObject, 3, Params,
+	                                            Sink, Context)) != PIPE_RWSTREAM_NoError)
+	{
+		return ErrorCode;
+	}
+
+	*BytesSent = le32_to_cpu(Params[0]);
+
+	return PIPE_RWSTREAM_NoError;
+}
+
+uint8_t SI_Host_ReceiveObject(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+                              const uint32_t Handle,
+                              const uint32_t ObjectSize,
+                              const uint32_t ChunkSize,
+                              SI_Host_DataSink_t Sink,
+                              void* Context)
+{
+	uint8_t  ErrorCode;
+	uint32_t Offset = 0;
+
+	if (!(ChunkSize))
+	{
+		uint32_t Params[1] = {cpu_to_le32(Handle)};
+
+		return SI_Host_ReceiveTransaction(SIInterfaceInfo, PIMA_OPERATION_GetObject, 1, Params, Sink, Context);
+	}
+
+	while (Offset < ObjectSize)
+	{
+		uint32_t BytesSent;
+
+		if ((ErrorCode = SI_Host_GetPartialObject(SIInterfaceInfo, Handle, Offset, MIN(ChunkSize, ObjectSize - Offset),
+		                                          Sink, Context, &BytesSent)) != PIPE_RWSTREAM_NoError)
+		{
+			return ErrorCode;
+		}
+
+		if (!(BytesSent))
+		  return PIPE_RWSTREAM_IncompleteTransfer;
+
+		Offset += BytesSent;
+	}
+
+	return PIPE_RWSTREAM_NoError;
+}
+
 #endif
 
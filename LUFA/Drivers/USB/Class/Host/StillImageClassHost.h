@@ -72,7 +72,26 @@
 			/** Error code for some Still Image Host functions, indicating a logical (and not hardware) error. */
 			#define SI_ERROR_LOGICAL_CMD_FAILED              0x80
 
+			/** Error code for some Still Image Host functions, indicating that the data sink callback of a transaction refused
+			 *  further data. The remainder of the data phase is discarded so that the transaction still completes normally.
+			 */
+			#define SI_ERROR_DATA_SINK_ABORTED               0x81
+
 		/* Type Defines: */
+			/** Type define for a data sink callback, used to consume the data phase of a PIMA transaction as it is received
+			 *  from the attached device by \ref SI_Host_ReceiveTransaction() and the functions built upon it. The callback is
+			 *  called once for each chunk of received data, in order, with chunks no larger than a single pipe bank.
+			 *
+			 *  \param[in] Context  User context pointer passed to the transaction function.
+			 *  \param[in] Data     Pointer to the received chunk of data.
+			 *  \param[in] Length   Length of the received chunk, in bytes.
+			 *
+			 *  \return Boolean \c true to continue the transfer, \c false to discard the remainder of the data phase.
+			 */
+			typedef bool (*SI_Host_DataSink_t)(void* Context,
+			                                   const uint8_t* Data,
+			                                   const uint16_t Length);
+
 			/** \brief Still Image Class Host Mode Configuration and State Structure.
 			 *
 			 *  Class state structure. An instance of this structure should be made within the user application,
@@ -279,6 +298,127 @@
 			                         void* Buffer,
 			                         const uint16_t Bytes) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 
+			/** Performs a complete PIMA transaction with a device-to-host data phase. The given operation is issued to the
+			 *  device, and any data block returned is streamed from the data IN pipe straight into the given sink callback one
+			 *  pipe bank at a time, so that the data phase may be arbitrarily large. The transaction's response block is then
+			 *  received and checked.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] SIInterfaceInfo  Pointer to a structure containing a Still Image Class host configuration and state.
+			 *  \param[in]     Operation        PIMA operation code to issue to the device.
+			 *  \param[in]     TotalParams      Total number of 32-bit parameters to send to the device in the issued command block.
+			 *  \param[in,out] Params           Pointer to an array of 32-bit values containing the parameters to send in the command
+			 *                                  block, overwritten with the parameters of the response block on success.
+			 *  \param[in]     Sink             Data sink callback for the data phase, or \c NULL to discard the data phase.
+			 *  \param[in]     Context          User context pointer passed to each call of the sink callback.
+			 *
+			 *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum, \ref SI_ERROR_LOGICAL_CMD_FAILED if the device
+			 *          returned a logical command failure, or \ref SI_ERROR_DATA_SINK_ABORTED if the sink refused the data.
+			 */
+			uint8_t SI_Host_ReceiveTransaction(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+			                                   const uint16_t Operation,
+			                                   const uint8_t TotalParams,
+			                                   uint32_t* const Params,
+			                                   SI_Host_DataSink_t Sink,
+			                                   void* Context) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Retrieves the list of object handles stored on the attached device. If the device holds more objects than will
+			 *  fit into the given handle array, the excess handles are discarded but still counted in the returned total.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] SIInterfaceInfo  Pointer to a structure containing a Still Image Class host configuration and state.
+			 *  \param[in]     StorageID        Storage to list the objects of, or \c 0xFFFFFFFF for all storages.
+			 *  \param[out]    Handles          Pointer to an array where the retrieved object handles are to be stored.
+			 *  \param[in]     MaxHandles       Maximum number of handles that can be stored in the handle array.
+			 *  \param[out]    TotalHandles     Pointer to where the total number of objects on the device is to be stored.
+			 *
+			 *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum, or \ref SI_ERROR_LOGICAL_CMD_FAILED if the device
+			 *          returned a logical command failure.
+			 */
+			uint8_t SI_Host_GetObjectHandles(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+			                                 const uint32_t StorageID,
+			                                 uint32_t* const Handles,
+			                                 const uint16_t MaxHandles,
+			                                 uint32_t* const TotalHandles) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(5);
+
+			/** Retrieves the ObjectInfo dataset of a single object on the attached device, along with its filename. Filename
+			 *  characters outside the ASCII range are replaced with underscores, and the filename is truncated if needed to
+			 *  fit into the given buffer.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] SIInterfaceInfo  Pointer to a structure containing a Still Image Class host configuration and state.
+			 *  \param[in]     Handle           Handle of the object to retrieve the information of.
+			 *  \param[out]    ObjectInfo       Pointer to where the fixed length portion of the dataset is to be stored.
+			 *  \param[out]    Filename         Pointer to a buffer where the null terminated filename is to be stored, or \c NULL.
+			 *  \param[in]     FilenameSize     Size of the filename buffer in bytes, including the null terminator.
+			 *
+			 *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum, or \ref SI_ERROR_LOGICAL_CMD_FAILED if the device
+			 *          returned a logical command failure.
+			 */
+			uint8_t SI_Host_GetObjectInfo(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+			                              const uint32_t Handle,
+			                              PIMA_ObjectInfo_t* const ObjectInfo,
+			                              char* const Filename,
+			                              const uint8_t FilenameSize) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
+
+			/** Retrieves a byte range of the data of a single object on the attached device, streaming it into the given data
+			 *  sink callback.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] SIInterfaceInfo  Pointer to a structure containing a Still Image Class host configuration and state.
+			 *  \param[in]     Handle           Handle of the object to retrieve the data of.
+			 *  \param[in]     Offset           Offset in bytes of the start of the range within the object.
+			 *  \param[in]     MaxBytes         Maximum number of bytes to retrieve.
+			 *  \param[in]     Sink             Data sink callback for the retrieved data.
+			 *  \param[in]     Context          User context pointer passed to each call of the sink callback.
+			 *  \param[out]    BytesSent        Pointer to where the number of bytes actually sent by the device is to be stored.
+			 *
+			 *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum, \ref SI_ERROR_LOGICAL_CMD_FAILED if the device
+			 *          returned a logical command failure, or \ref SI_ERROR_DATA_SINK_ABORTED if the sink refused the data.
+			 */
+			uint8_t SI_Host_GetPartialObject(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+			                                 const uint32_t Handle,
+			                                 const uint32_t Offset,
+			                                 const uint32_t MaxBytes,
+			                                 SI_Host_DataSink_t Sink,
+			                                 void* Context,
+			                                 uint32_t* const BytesSent) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(7);
+
+			/** Retrieves the complete data of a single object on the attached device, streaming it into the given data sink
+			 *  callback. The object is fetched as a back-to-back sequence of \ref PIMA_OPERATION_GetPartialObject transactions
+			 *  of the given size, each issued as soon as the previous transaction's response has been received, so that objects
+			 *  of several megabytes can be offloaded without any single transaction outliving a device timeout. If a chunk size
+			 *  of zero is given, the object is instead retrieved in one \ref PIMA_OPERATION_GetObject transaction for devices
+			 *  which do not support partial retrieval.
+			 *
+			 *  \pre This function must only be called when the Host state machine is in the \ref HOST_STATE_Configured state or the
+			 *       call will fail.
+			 *
+			 *  \param[in,out] SIInterfaceInfo  Pointer to a structure containing a Still Image Class host configuration and state.
+			 *  \param[in]     Handle           Handle of the object to retrieve the data of.
+			 *  \param[in]     ObjectSize       Total size of the object in bytes, as reported in its ObjectInfo dataset.
+			 *  \param[in]     ChunkSize        Number of bytes to request in each partial transaction, or zero for a single transaction.
+			 *  \param[in]     Sink             Data sink callback for the retrieved data.
+			 *  \param[in]     Context          User context pointer passed to each call of the sink callback.
+			 *
+			 *  \return A value from the \ref Pipe_Stream_RW_ErrorCodes_t enum, \ref SI_ERROR_LOGICAL_CMD_FAILED if the device
+			 *          returned a logical command failure, or \ref SI_ERROR_DATA_SINK_ABORTED if the sink refused the data.
+			 */
+			uint8_t SI_Host_ReceiveObject(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+			                              const uint32_t Handle,
+			                              const uint32_t ObjectSize,
+			                              const uint32_t ChunkSize,
+			                              SI_Host_DataSink_t Sink,
+			                              void* Context) ATTR_NON_NULL_PTR_ARG(1);
+
 		/* Inline Functions: */
 			/** General management task for a given Still Image host class interface, required for the correct operation of the
 			 *  interface. This should be called frequently in the main program loop, before the master USB management task
@@ -296,9 +436,38 @@
 	#if !defined(__DOXYGEN__)
 		/* Macros: */
 			#define SI_COMMAND_DATA_TIMEOUT_MS        10000
+			#define SI_STREAM_CHUNK_SIZE              64
+
+		/* Type Defines: */
+			typedef struct
+			{
+				uint32_t  Offset;
+				uint32_t* Handles;
+				uint16_t  MaxHandles;
+				uint32_t* TotalHandles;
+			} SI_Host_HandleSinkContext_t;
+
+			typedef struct
+			{
+				uint32_t           Offset;
+				PIMA_ObjectInfo_t* ObjectInfo;
+				char*              Filename;
+				uint8_t            FilenameSize;
+				uint8_t            FilenameChars;
+			} SI_Host_ObjectInfoSinkContext_t;
 
 		/* Function Prototypes: */
 			#if defined(__INCLUDE_FROM_STILLIMAGE_HOST_C)
+				static uint8_t SI_Host_StreamDataBlock(USB_ClassInfo_SI_Host_t* const SIInterfaceInfo,
+				                                       uint32_t DataBytes,
+				                                       SI_Host_DataSink_t Sink,
+				                                       void* Context) ATTR_NON_NULL_PTR_ARG(1);
+				static bool SI_Host_HandleSink(void* Context,
+				                               const uint8_t* Data,
+				                               const uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+				static bool SI_Host_ObjectInfoSink(void* Context,
+				                                   const uint8_t* Data,
+				                                   const uint16_t Length) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
 				static uint8_t DCOMP_SI_Host_NextSIInterface(void* const CurrentDescriptor)
 				                                             ATTR_WARN_UNUSED_RESULT ATTR_NON_NULL_PTR_ARG(1);
 				static uint8_t DCOMP_SI_Host_NextSIInterfaceEndpoint(void* const CurrentDescriptor)
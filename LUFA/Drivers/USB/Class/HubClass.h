@@ -0,0 +1,79 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *  \brief Master include file for the library USB Hub Class driver.
+ *
+ *  Master include file for the library USB Hub Class driver, for both host and device modes, where available.
+ *
+ *  This file should be included in all user projects making use of this optional class driver, instead of
+ *  including any headers in the USB/ClassDriver/Device, USB/ClassDriver/Host or USB/ClassDriver/Common subdirectories.
+ */
+
+/** \ingroup Group_USBClassDrivers
+ *  \defgroup Group_USBClassHub Hub Class Driver
+ *  \brief USB class driver for the USB-IF Hub class standard.
+ *
+ *  \section Sec_USBClassHub_Dependencies Module Source Dependencies
+ *  The following files must be built with any user project that uses this module:
+ *    - LUFA/Drivers/USB/Class/Host/HubClassHost.c <i>(Makefile source module name: LUFA_SRC_USBCLASS)</i>
+ *
+ *  \section Sec_USBClassHub_ModDescription Module Description
+ *  Hub Class Driver module. This module contains an internal implementation of the USB Hub Class, for Host USB mode only.
+ *  User applications can use this class driver to attach multiple USB devices to the host through one or more downstream
+ *  hubs, each of which is assigned its own bus address in the host device table.
+ *
+ *  This module requires the \c HOST_MAX_DEVICES compile time token to be defined to the total number of devices (including
+ *  hubs) which may be attached to the host at any one time.
+ *
+ *  \note As the supported USB controllers cannot issue the preamble packets required to communicate with Low Speed devices
+ *        through a Full Speed hub, only Full Speed devices may be attached to a hub's downstream ports.
+ *
+ *  @{
+ */
+
+#ifndef _HUB_CLASS_H_
+#define _HUB_CLASS_H_
+
+	/* Macros: */
+		#define __INCLUDE_FROM_USB_DRIVER
+		#define __INCLUDE_FROM_HUB_DRIVER
+
+	/* Includes: */
+		#include "../Core/USBMode.h"
+
+		#if defined(USB_CAN_BE_HOST)
+			#include "Host/HubClassHost.h"
+		#endif
+
+#endif
+
+/** @} */
+
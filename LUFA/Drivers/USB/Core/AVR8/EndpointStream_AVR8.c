@@ -37,6 +37,7 @@
 #if defined(USB_CAN_BE_DEVICE)
 
 #include "EndpointStream_AVR8.h"
+#include "../USBTrace.h"
 
 #if !defined(CONTROL_ONLY_DEVICE)
 uint8_t Endpoint_Discard_Stream(uint16_t Length,
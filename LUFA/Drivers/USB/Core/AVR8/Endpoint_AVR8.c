@@ -37,11 +37,16 @@
 #if defined(USB_CAN_BE_DEVICE)
 
 #include "../Endpoint.h"
+#include "../USBTrace.h"
 
 #if !defined(FIXED_CONTROL_ENDPOINT_SIZE)
 uint8_t USB_Device_ControlEndpointSize = ENDPOINT_CONTROLEP_DEFAULT_SIZE;
 #endif
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+static Endpoint_CompletionEntry_t USB_Endpoint_CompletionHandlers[ENDPOINT_TOTAL_ENDPOINTS];
+#endif
+
 bool Endpoint_ConfigureEndpointTable(const USB_Endpoint_Table_t* const Table,
                                      const uint8_t Entries)
 {
@@ -124,7 +129,91 @@ void Endpoint_ClearEndpoints(void)
 		UECFG1X = 0;
 		Endpoint_DisableEndpoint();
 	}
+
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	memset(USB_Endpoint_CompletionHandlers, 0x00, sizeof(USB_Endpoint_CompletionHandlers));
+	#endif
+}
+
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+bool Endpoint_SetCompletionHandler(const uint8_t Address,
+                                   const Endpoint_CompletionHandler_t Handler,
+                                   void* const Context)
+{
+	uint8_t EPNum = (Address & ENDPOINT_EPNUM_MASK);
+
+	if ((EPNum == ENDPOINT_CONTROLEP) || (EPNum >= ENDPOINT_TOTAL_ENDPOINTS))
+	  return false;
+
+	Endpoint_DisableCompletionInterrupt(Address);
+
+	USB_Endpoint_CompletionHandlers[EPNum].Address = Address;
+	USB_Endpoint_CompletionHandlers[EPNum].Handler = Handler;
+	USB_Endpoint_CompletionHandlers[EPNum].Context = Context;
+
+	if (Handler != NULL)
+	  Endpoint_EnableCompletionInterrupt(Address);
+
+	return true;
+}
+
+void Endpoint_EnableCompletionInterrupt(const uint8_t Address)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	Endpoint_SelectEndpoint(Address);
+	UEIENX |= (Address & ENDPOINT_DIR_IN) ? (1 << TXINE) : (1 << RXOUTE);
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+void Endpoint_DisableCompletionInterrupt(const uint8_t Address)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	Endpoint_SelectEndpoint(Address);
+	UEIENX &= ~((1 << TXINE) | (1 << RXOUTE));
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+void Endpoint_ProcessCompletionInterrupts(void)
+{
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	for (uint8_t EPNum = (ENDPOINT_CONTROLEP + 1); EPNum < ENDPOINT_TOTAL_ENDPOINTS; EPNum++)
+	{
+		Endpoint_CompletionEntry_t* Entry = &USB_Endpoint_CompletionHandlers[EPNum];
+
+		if ((Entry->Handler == NULL) || !(Endpoint_HasEndpointInterrupted(EPNum)))
+		  continue;
+
+		Endpoint_SelectEndpoint(EPNum);
+
+		if (!(UEIENX & ((1 << TXINE) | (1 << RXOUTE))))
+		  continue;
+
+		USB_TRACE(USB_TRACE_EVENT_EndpointInterrupt, Entry->Address, Endpoint_BytesInEndpoint());
+
+		bool KeepEnabled = Entry->Handler(Entry->Address, Entry->Context);
+
+		Endpoint_SelectEndpoint(EPNum);
+
+		if (!(KeepEnabled))
+		  UEIENX &= ~((1 << TXINE) | (1 << RXOUTE));
+	}
+
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
 }
+#endif
 
 void Endpoint_ClearStatusStage(void)
 {
@@ -38,6 +38,18 @@
 
 #define  __INCLUDE_FROM_HOST_C
 #include "../Host.h"
+#include "../HostPeriodic.h"
+
+#if defined(HOST_ENUMERATION_TIMING)
+USB_Host_EnumerationTiming_t USB_Host_EnumerationTiming;
+
+static uint16_t* EnumerationPhase;
+static uint16_t  EnumerationPhaseStartMS;
+static uint16_t  EnumerationClockMS;
+static uint16_t  EnumerationLastFrame;
+#endif
+
+static uint8_t EnumerationRetries;
 
 void USB_Host_ProcessNextHostState(void)
 {
@@ -103,15 +115,25 @@ void USB_Host_ProcessNextHostState(void)
 
 				USB_Host_ResumeBus();
 				Pipe_ClearPipes();
+				USB_Host_ClearPeriodicPipes();
+
+				#if defined(HOST_MAX_DEVICES)
+				USB_Host_ClearDevices();
+				#endif
 
-				HOST_TASK_NONBLOCK_WAIT(100, HOST_STATE_Powered_DoReset);
+				EnumerationRetries = 0;
+				HOST_ENUMERATION_TIMING_START();
+
+				HOST_TASK_NONBLOCK_WAIT(HOST_CONNECT_DEBOUNCE_MS, HOST_STATE_Powered_DoReset);
 			}
 
 			break;
 		case HOST_STATE_Powered_DoReset:
+			HOST_ENUMERATION_TIMING_PHASE(ResetMS);
+
 			USB_Host_ResetDevice();
 
-			HOST_TASK_NONBLOCK_WAIT(200, HOST_STATE_Powered_ConfigPipe);
+			HOST_TASK_NONBLOCK_WAIT((HOST_RESET_RECOVERY_MS << EnumerationRetries), HOST_STATE_Powered_ConfigPipe);
 			break;
 		case HOST_STATE_Powered_ConfigPipe:
 			if (!(Pipe_ConfigurePipe(PIPE_CONTROLPIPE, EP_TYPE_CONTROL, ENDPOINT_CONTROLEP, PIPE_CONTROLPIPE_DEFAULT_SIZE, 1)))
@@ -124,6 +146,8 @@ void USB_Host_ProcessNextHostState(void)
 			USB_HostState = HOST_STATE_Default;
 			break;
 		case HOST_STATE_Default:
+			HOST_ENUMERATION_TIMING_PHASE(DescriptorMS);
+
 			USB_ControlRequest = (USB_Request_Header_t)
 				{
 					.bmRequestType = (REQDIR_DEVICETOHOST | REQTYPE_STANDARD | REQREC_DEVICE),
@@ -138,6 +162,9 @@ void USB_Host_ProcessNextHostState(void)
 			Pipe_SelectPipe(PIPE_CONTROLPIPE);
 			if ((SubErrorCode = USB_Host_SendControlRequest(DataBuffer)) != HOST_SENDCONTROL_Successful)
 			{
+				if (USB_Host_RetryEnumeration(SubErrorCode))
+				  break;
+
 				ErrorCode = HOST_ENUMERROR_ControlError;
 				break;
 			}
@@ -146,10 +173,12 @@ void USB_Host_ProcessNextHostState(void)
 
 			USB_Host_ResetDevice();
 
-			HOST_TASK_NONBLOCK_WAIT(200, HOST_STATE_Default_PostReset);
+			HOST_TASK_NONBLOCK_WAIT((HOST_RESET_RECOVERY_MS << EnumerationRetries), HOST_STATE_Default_PostReset);
 			break;
 		case HOST_STATE_Default_PostReset:
-			if (!(Pipe_ConfigurePipe(PIPE_CONTROLPIPE, EP_TYPE_CONTROL, ENDPOINT_CONTROLEP, USB_Host_ControlPipeSize, 1)))
+			HOST_ENUMERATION_TIMING_PHASE(AddressMS);
+
+			if (!(Pipe_ConfigurePipe(PIPE_CONTROLPIPE, EP_TYPE_CONTROL, ENDPOINT_CONTROLEP, HOST_CONTROLPIPE_BANK_SIZE, 1)))
 			{
 				ErrorCode    = HOST_ENUMERROR_PipeConfigError;
 				SubErrorCode = 0;
@@ -167,17 +196,26 @@ void USB_Host_ProcessNextHostState(void)
 
 			if ((SubErrorCode = USB_Host_SendControlRequest(NULL)) != HOST_SENDCONTROL_Successful)
 			{
+				if (USB_Host_RetryEnumeration(SubErrorCode))
+				  break;
+
 				ErrorCode = HOST_ENUMERROR_ControlError;
 				break;
 			}
 
-			HOST_TASK_NONBLOCK_WAIT(100, HOST_STATE_Default_PostAddressSet);
+			HOST_TASK_NONBLOCK_WAIT((HOST_SET_ADDRESS_RECOVERY_MS << EnumerationRetries), HOST_STATE_Default_PostAddressSet);
 			break;
 		case HOST_STATE_Default_PostAddressSet:
+			#if defined(HOST_MAX_DEVICES)
+			USB_Host_AttachRootDevice();
+			#else
 			USB_Host_SetDeviceAddress(USB_HOST_DEVICEADDRESS);
+			#endif
 
 			USB_HostState = HOST_STATE_Addressed;
 
+			HOST_ENUMERATION_TIMING_END();
+
 			EVENT_USB_Host_DeviceEnumerationComplete();
 			break;
 
@@ -187,6 +225,8 @@ void USB_Host_ProcessNextHostState(void)
 
 	if ((ErrorCode != HOST_ENUMERROR_NoError) && (USB_HostState != HOST_STATE_Unattached))
 	{
+		HOST_ENUMERATION_TIMING_END();
+
 		EVENT_USB_Host_DeviceEnumerationFailed(ErrorCode, SubErrorCode);
 
 		USB_Host_VBUS_Auto_Off();
@@ -253,6 +293,8 @@ static void USB_Host_ResetDevice(void)
 {
 	bool BusSuspended = USB_Host_IsBusSuspended();
 
+	HOST_ENUMERATION_TIMING_PAUSE();
+
 	USB_INT_Disable(USB_INT_DDISCI);
 
 	USB_Host_ResetBus();
@@ -289,9 +331,68 @@ static void USB_Host_ResetDevice(void)
 	if (BusSuspended)
 	  USB_Host_SuspendBus();
 
+	HOST_ENUMERATION_TIMING_RESUME();
+
 	USB_INT_Enable(USB_INT_DDISCI);
 }
 
+static bool USB_Host_RetryEnumeration(const uint8_t SubErrorCode)
+{
+	if ((SubErrorCode == HOST_SENDCONTROL_DeviceDisconnected) || (EnumerationRetries == HOST_ENUMERATION_RETRIES))
+	  return false;
+
+	EnumerationRetries++;
+
+	#if defined(HOST_ENUMERATION_TIMING)
+	USB_Host_EnumerationTiming.Retries = EnumerationRetries;
+	#endif
+
+	/* Discard any pipe error or stall left by the failed request, then reset the device again with longer recovery delays */
+	Pipe_ClearPipes();
+	USB_HostState = HOST_STATE_Powered_DoReset;
+
+	return true;
+}
+
+#if defined(HOST_ENUMERATION_TIMING)
+static void USB_Host_StartEnumerationTiming(void)
+{
+	memset(&USB_Host_EnumerationTiming, 0x00, sizeof(USB_Host_EnumerationTiming));
+
+	EnumerationPhase        = &USB_Host_EnumerationTiming.DebounceMS;
+	EnumerationPhaseStartMS = 0;
+	EnumerationClockMS      = 0;
+	EnumerationLastFrame    = USB_Host_GetFrameNumber();
+}
+
+static void USB_Host_UpdateEnumerationClock(void)
+{
+	uint16_t CurrentFrame = USB_Host_GetFrameNumber();
+
+	EnumerationClockMS  += ((CurrentFrame - EnumerationLastFrame) & HOST_FRAME_NUMBER_MASK);
+	EnumerationLastFrame = CurrentFrame;
+}
+
+static void USB_Host_ResyncEnumerationClock(void)
+{
+	EnumerationLastFrame = USB_Host_GetFrameNumber();
+}
+
+static void USB_Host_EndEnumerationPhase(uint16_t* const NextPhaseTimeMS)
+{
+	if (!(EnumerationPhase))
+	  return;
+
+	USB_Host_UpdateEnumerationClock();
+
+	*EnumerationPhase += (EnumerationClockMS - EnumerationPhaseStartMS);
+	USB_Host_EnumerationTiming.TotalMS = EnumerationClockMS;
+
+	EnumerationPhase        = NextPhaseTimeMS;
+	EnumerationPhaseStartMS = EnumerationClockMS;
+}
+#endif
+
 #endif
 
 #endif
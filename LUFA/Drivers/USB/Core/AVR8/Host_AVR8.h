@@ -85,9 +85,14 @@
 				 *
 				 *  The default delay value may be overridden in the user project makefile by defining the
 				 *  \c HOST_DEVICE_SETTLE_DELAY_MS token to the required delay in milliseconds, and passed to the
-				 *  compiler using the -D switch.
+				 *  compiler using the -D switch. When the \c HOST_FAST_ENUMERATION token is defined, the default
+				 *  delay is reduced to a brief VBUS power cycle.
 				 */
-				#define HOST_DEVICE_SETTLE_DELAY_MS        1000
+				#if defined(HOST_FAST_ENUMERATION)
+					#define HOST_DEVICE_SETTLE_DELAY_MS    10
+				#else
+					#define HOST_DEVICE_SETTLE_DELAY_MS    1000
+				#endif
 			#endif
 
 			/** Enum for the error codes for the \ref EVENT_USB_Host_HostError() event.
@@ -343,6 +348,12 @@
 				UHADDR  =  (Address & 0x7F);
 			}
 
+			static inline uint8_t USB_Host_GetDeviceAddress(void) ATTR_WARN_UNUSED_RESULT ATTR_ALWAYS_INLINE;
+			static inline uint8_t USB_Host_GetDeviceAddress(void)
+			{
+				return (UHADDR & 0x7F);
+			}
+
 		/* Enums: */
 			enum USB_Host_WaitMSErrorCodes_t
 			{
@@ -358,6 +369,14 @@
 
 			#if defined(__INCLUDE_FROM_HOST_C)
 				static void USB_Host_ResetDevice(void);
+				static bool USB_Host_RetryEnumeration(const uint8_t SubErrorCode);
+
+				#if defined(HOST_ENUMERATION_TIMING)
+					static void USB_Host_StartEnumerationTiming(void);
+					static void USB_Host_UpdateEnumerationClock(void);
+					static void USB_Host_ResyncEnumerationClock(void);
+					static void USB_Host_EndEnumerationPhase(uint16_t* const NextPhaseTimeMS);
+				#endif
 			#endif
 	#endif
 
@@ -37,6 +37,7 @@
 #if defined(USB_CAN_BE_HOST)
 
 #include "PipeStream_AVR8.h"
+#include "../USBTrace.h"
 
 uint8_t Pipe_Discard_Stream(uint16_t Length,
                             uint16_t* const BytesProcessed)
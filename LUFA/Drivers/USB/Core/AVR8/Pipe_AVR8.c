@@ -40,6 +40,10 @@
 
 uint8_t USB_Host_ControlPipeSize = PIPE_CONTROLPIPE_DEFAULT_SIZE;
 
+#if defined(HOST_MAX_DEVICES)
+uint8_t USB_Pipe_DeviceAddress[PIPE_TOTAL_PIPES];
+#endif
+
 bool Pipe_ConfigurePipeTable(const USB_Pipe_Table_t* const Table,
                              const uint8_t Entries)
 {
@@ -72,6 +76,10 @@ bool Pipe_ConfigurePipe(const uint8_t Address,
 	if (Type == EP_TYPE_CONTROL)
 	  Token = PIPE_TOKEN_SETUP;
 
+#if defined(HOST_MAX_DEVICES)
+	Pipe_BindToDevice(Number, USB_Host_DeviceAddress);
+#endif
+
 #if defined(ORDERED_EP_CONFIG)
 	Pipe_SelectPipe(Number);
 	Pipe_EnablePipe();
@@ -157,6 +165,11 @@ bool Pipe_IsEndpointBound(const uint8_t EndpointAddress)
 		if (!(Pipe_IsConfigured()))
 		  continue;
 
+		#if defined(HOST_MAX_DEVICES)
+		if (USB_Pipe_DeviceAddress[PNum] != USB_Host_DeviceAddress)
+		  continue;
+		#endif
+
 		if (Pipe_GetBoundEndpointAddress() == EndpointAddress)
 		  return true;
 	}
@@ -165,6 +178,27 @@ bool Pipe_IsEndpointBound(const uint8_t EndpointAddress)
 	return false;
 }
 
+#if defined(HOST_MAX_DEVICES)
+void Pipe_ReleaseDevicePipes(const uint8_t DeviceAddress)
+{
+	uint8_t PrevPipeNumber = Pipe_GetCurrentPipe();
+
+	for (uint8_t PNum = (PIPE_CONTROLPIPE + 1); PNum < PIPE_TOTAL_PIPES; PNum++)
+	{
+		if (USB_Pipe_DeviceAddress[PNum] != DeviceAddress)
+		  continue;
+
+		Pipe_SelectPipe(PNum);
+		Pipe_Freeze();
+		Pipe_DisablePipe();
+
+		Pipe_BindToDevice(PNum, 0);
+	}
+
+	Pipe_SelectPipe(PrevPipeNumber);
+}
+#endif
+
 uint8_t Pipe_WaitUntilReady(void)
 {
 	#if (USB_STREAM_TIMEOUT_MS < 0xFF)
@@ -96,6 +96,14 @@
 			#error Do not include this file directly. Include LUFA/Drivers/USB/USB.h instead.
 		#endif
 
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* External Variables: */
+			#if defined(HOST_MAX_DEVICES)
+				extern uint8_t USB_Pipe_DeviceAddress[];
+			#endif
+	#endif
+
 	/* Public Interface - May be used in end-application: */
 		/* Macros: */
 			/** \name Pipe Error Flag Masks */
@@ -211,12 +219,20 @@
 			/** Selects the given pipe address. Any pipe operations which do not require the pipe address to be
 			 *  indicated will operate on the currently selected pipe.
 			 *
+			 *  When the \c HOST_MAX_DEVICES compile time token is defined, the bus address of the device the pipe
+			 *  is bound to is also loaded into the USB controller, as the controller shares a single device address
+			 *  between all pipes.
+			 *
 			 *  \param[in] Address  Address of the pipe to select.
 			 */
 			static inline void Pipe_SelectPipe(const uint8_t Address) ATTR_ALWAYS_INLINE;
 			static inline void Pipe_SelectPipe(const uint8_t Address)
 			{
 				UPNUM = (Address & PIPE_PIPENUM_MASK);
+
+				#if defined(HOST_MAX_DEVICES)
+				UHADDR = USB_Pipe_DeviceAddress[Address & PIPE_PIPENUM_MASK];
+				#endif
 			}
 
 			/** Resets the desired pipe, including the pipe banks and flags.
@@ -907,8 +923,25 @@
 				return (MaskVal << EPSIZE0);
 			}
 
+			#if defined(HOST_MAX_DEVICES)
+				static inline void Pipe_BindToDevice(const uint8_t Number,
+				                                     const uint8_t DeviceAddress) ATTR_ALWAYS_INLINE;
+				static inline void Pipe_BindToDevice(const uint8_t Number,
+				                                     const uint8_t DeviceAddress)
+				{
+					USB_Pipe_DeviceAddress[Number] = DeviceAddress;
+
+					if ((UPNUM & PIPE_PIPENUM_MASK) == Number)
+					  UHADDR = DeviceAddress;
+				}
+			#endif
+
 		/* Function Prototypes: */
 			void Pipe_ClearPipes(void);
+
+			#if defined(HOST_MAX_DEVICES)
+				void Pipe_ReleaseDevicePipes(const uint8_t DeviceAddress);
+			#endif
 	#endif
 
 	/* Disable C linkage for C++ Compilers: */
@@ -38,8 +38,13 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 	uint16_t BytesInTransfer = 0;
 	uint8_t  ErrorCode;
 
+	USB_TRACE(USB_TRACE_EVENT_StreamStart, Endpoint_GetCurrentEndpoint(), Length);
+
 	if ((ErrorCode = Endpoint_WaitUntilReady()))
-	  return ErrorCode;
+	{
+		USB_TRACE(USB_TRACE_EVENT_StreamError, Endpoint_GetCurrentEndpoint(), ErrorCode);
+		return ErrorCode;
+	}
 
 	if (BytesProcessed != NULL)
 	{
@@ -52,6 +57,7 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 		if (!(Endpoint_IsReadWriteAllowed()))
 		{
 			TEMPLATE_CLEAR_ENDPOINT();
+			USB_TRACE(USB_TRACE_EVENT_BankComplete, Endpoint_GetCurrentEndpoint(), BytesInTransfer);
 
 			#if !defined(INTERRUPT_CONTROL_ENDPOINT)
 			USB_USBTask();
@@ -64,7 +70,10 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 			}
 
 			if ((ErrorCode = Endpoint_WaitUntilReady()))
-			  return ErrorCode;
+			{
+				USB_TRACE(USB_TRACE_EVENT_StreamError, Endpoint_GetCurrentEndpoint(), ErrorCode);
+				return ErrorCode;
+			}
 		}
 		else
 		{
@@ -75,6 +84,8 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 		}
 	}
 
+	USB_TRACE(USB_TRACE_EVENT_StreamComplete, Endpoint_GetCurrentEndpoint(), BytesInTransfer);
+
 	return ENDPOINT_RWSTREAM_NoError;
 }
 
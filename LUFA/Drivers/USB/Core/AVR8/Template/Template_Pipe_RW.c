@@ -40,8 +40,13 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 
 	Pipe_SetPipeToken(TEMPLATE_TOKEN);
 
+	USB_TRACE(USB_TRACE_EVENT_StreamStart, Pipe_GetCurrentPipe(), Length);
+
 	if ((ErrorCode = Pipe_WaitUntilReady()))
-	  return ErrorCode;
+	{
+		USB_TRACE(USB_TRACE_EVENT_StreamError, Pipe_GetCurrentPipe(), ErrorCode);
+		return ErrorCode;
+	}
 
 	if (BytesProcessed != NULL)
 	{
@@ -54,6 +59,7 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 		if (!(Pipe_IsReadWriteAllowed()))
 		{
 			TEMPLATE_CLEAR_PIPE();
+			USB_TRACE(USB_TRACE_EVENT_BankComplete, Pipe_GetCurrentPipe(), BytesInTransfer);
 
 			if (BytesProcessed != NULL)
 			{
@@ -62,7 +68,10 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 			}
 
 			if ((ErrorCode = Pipe_WaitUntilReady()))
-			  return ErrorCode;
+			{
+				USB_TRACE(USB_TRACE_EVENT_StreamError, Pipe_GetCurrentPipe(), ErrorCode);
+				return ErrorCode;
+			}
 		}
 		else
 		{
@@ -73,6 +82,8 @@ uint8_t TEMPLATE_FUNC_NAME (TEMPLATE_BUFFER_TYPE const Buffer,
 		}
 	}
 
+	USB_TRACE(USB_TRACE_EVENT_StreamComplete, Pipe_GetCurrentPipe(), BytesInTransfer);
+
 	return PIPE_RWSTREAM_NoError;
 }
 
@@ -33,6 +33,7 @@
 
 #define  __INCLUDE_FROM_USB_DRIVER
 #include "../USBInterrupt.h"
+#include "../USBTrace.h"
 
 void USB_INT_DisableAllInterrupts(void)
 {
@@ -100,6 +101,7 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 			}
 
 			USB_DeviceState = DEVICE_STATE_Powered;
+			USB_TRACE(USB_TRACE_EVENT_Connect, 0, 0);
 			EVENT_USB_Device_Connect();
 		}
 		else
@@ -108,6 +110,7 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 			  USB_PLL_Off();
 
 			USB_DeviceState = DEVICE_STATE_Unattached;
+			USB_TRACE(USB_TRACE_EVENT_Disconnect, 0, 0);
 			EVENT_USB_Device_Disconnect();
 		}
 	}
@@ -118,6 +121,8 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 		USB_INT_Disable(USB_INT_SUSPI);
 		USB_INT_Enable(USB_INT_WAKEUPI);
 
+		USB_TRACE(USB_TRACE_EVENT_Suspend, 0, 0);
+
 		USB_CLK_Freeze();
 
 		if (!(USB_Options & USB_OPT_MANUAL_PLL))
@@ -147,6 +152,8 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 		USB_INT_Disable(USB_INT_WAKEUPI);
 		USB_INT_Enable(USB_INT_SUSPI);
 
+		USB_TRACE(USB_TRACE_EVENT_WakeUp, 0, 0);
+
 		if (USB_Device_ConfigurationNumber)
 		  USB_DeviceState = DEVICE_STATE_Configured;
 		else
@@ -163,6 +170,8 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 	{
 		USB_INT_Clear(USB_INT_EORSTI);
 
+		USB_TRACE(USB_TRACE_EVENT_Reset, 0, 0);
+
 		USB_DeviceState                = DEVICE_STATE_Default;
 		USB_Device_ConfigurationNumber = 0;
 
@@ -197,6 +206,7 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 		USB_INT_Clear(USB_INT_DCONNI);
 		USB_INT_Disable(USB_INT_DDISCI);
 
+		USB_TRACE(USB_TRACE_EVENT_DeviceUnattached, 0, 0);
 		EVENT_USB_Host_DeviceUnattached();
 
 		USB_ResetInterface();
@@ -209,6 +219,7 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 		USB_Host_VBUS_Manual_Off();
 		USB_Host_VBUS_Auto_Off();
 
+		USB_TRACE(USB_TRACE_EVENT_HostError, 0, HOST_ERROR_VBusVoltageDip);
 		EVENT_USB_Host_HostError(HOST_ERROR_VBusVoltageDip);
 		EVENT_USB_Host_DeviceUnattached();
 
@@ -220,6 +231,7 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 		USB_INT_Clear(USB_INT_SRPI);
 		USB_INT_Disable(USB_INT_SRPI);
 
+		USB_TRACE(USB_TRACE_EVENT_DeviceAttached, 0, 0);
 		EVENT_USB_Host_DeviceAttached();
 
 		USB_INT_Enable(USB_INT_DDISCI);
@@ -231,6 +243,7 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 	{
 		USB_INT_Clear(USB_INT_BCERRI);
 
+		USB_TRACE(USB_TRACE_EVENT_HostError, 0, 0);
 		EVENT_USB_Host_DeviceEnumerationFailed(HOST_ENUMERROR_NoDeviceDetected, 0);
 		EVENT_USB_Host_DeviceUnattached();
 
@@ -257,21 +270,32 @@ ISR(USB_GEN_vect, ISR_BLOCK)
 	#endif
 }
 
-#if defined(INTERRUPT_CONTROL_ENDPOINT) && defined(USB_CAN_BE_DEVICE)
+#if (defined(INTERRUPT_CONTROL_ENDPOINT) || defined(INTERRUPT_DATA_ENDPOINTS)) && defined(USB_CAN_BE_DEVICE)
 ISR(USB_COM_vect, ISR_BLOCK)
 {
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	Endpoint_ProcessCompletionInterrupts();
+	#endif
+
+	#if defined(INTERRUPT_CONTROL_ENDPOINT)
 	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
 
 	Endpoint_SelectEndpoint(ENDPOINT_CONTROLEP);
-	USB_INT_Disable(USB_INT_RXSTPI);
 
-	GlobalInterruptEnable();
+	if (USB_INT_IsEnabled(USB_INT_RXSTPI) && USB_INT_HasOccurred(USB_INT_RXSTPI))
+	{
+		USB_INT_Disable(USB_INT_RXSTPI);
+
+		GlobalInterruptEnable();
 
-	USB_Device_ProcessControlRequest();
+		USB_Device_ProcessControlRequest();
+
+		Endpoint_SelectEndpoint(ENDPOINT_CONTROLEP);
+		USB_INT_Enable(USB_INT_RXSTPI);
+	}
 
-	Endpoint_SelectEndpoint(ENDPOINT_CONTROLEP);
-	USB_INT_Enable(USB_INT_RXSTPI);
 	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+	#endif
 }
 #endif
 
@@ -144,3 +144,122 @@ uint8_t USB_GetNextDescriptorComp(uint16_t* const BytesRem,
 	return DESCRIPTOR_SEARCH_COMP_EndOfDescriptor;
 }
 
+uint8_t USB_BuildConfigIndex(USB_ConfigIndex_t* const ConfigIndex,
+                             uint16_t ConfigDescriptorSize,
+                             void* ConfigDescriptorData)
+{
+	USB_ConfigIndex_Interface_t* CurrentInterface      = NULL;
+	uint8_t*                     ConfigDescriptorStart = ConfigDescriptorData;
+	uint8_t                      ErrorCode             = CONFIG_INDEX_Successful;
+
+	ConfigIndex->TotalInterfaces = 0;
+	ConfigIndex->TotalEndpoints  = 0;
+
+	if ((ConfigDescriptorSize < sizeof(USB_Descriptor_Configuration_Header_t)) ||
+	    (DESCRIPTOR_TYPE(ConfigDescriptorData) != DTYPE_Configuration))
+	{
+		return CONFIG_INDEX_InvalidData;
+	}
+
+	while (ConfigDescriptorSize)
+	{
+		USB_GetNextDescriptor(&ConfigDescriptorSize, &ConfigDescriptorData);
+
+		if (!(ConfigDescriptorSize) || (DESCRIPTOR_SIZE(ConfigDescriptorData) < sizeof(USB_Descriptor_Header_t)))
+		  break;
+
+		if (DESCRIPTOR_TYPE(ConfigDescriptorData) == DTYPE_Interface)
+		{
+			if (ConfigIndex->TotalInterfaces == CONFIG_INDEX_MAX_INTERFACES)
+			{
+				CurrentInterface = NULL;
+				ErrorCode        = CONFIG_INDEX_TableFull;
+				continue;
+			}
+
+			USB_Descriptor_Interface_t* Interface = DESCRIPTOR_PCAST(ConfigDescriptorData, USB_Descriptor_Interface_t);
+
+			CurrentInterface = &ConfigIndex->Interfaces[ConfigIndex->TotalInterfaces++];
+			CurrentInterface->DescriptorOffset = ((uint8_t*)ConfigDescriptorData - ConfigDescriptorStart);
+			CurrentInterface->InterfaceNumber  = Interface->InterfaceNumber;
+			CurrentInterface->AlternateSetting = Interface->AlternateSetting;
+			CurrentInterface->Class            = Interface->Class;
+			CurrentInterface->SubClass         = Interface->SubClass;
+			CurrentInterface->Protocol         = Interface->Protocol;
+			CurrentInterface->FirstEndpoint    = ConfigIndex->TotalEndpoints;
+			CurrentInterface->TotalEndpoints   = 0;
+		}
+		else if ((DESCRIPTOR_TYPE(ConfigDescriptorData) == DTYPE_Endpoint) && (CurrentInterface != NULL))
+		{
+			if (ConfigIndex->TotalEndpoints == CONFIG_INDEX_MAX_ENDPOINTS)
+			{
+				ErrorCode = CONFIG_INDEX_TableFull;
+				continue;
+			}
+
+			USB_Descriptor_Endpoint_t*  Endpoint      = DESCRIPTOR_PCAST(ConfigDescriptorData, USB_Descriptor_Endpoint_t);
+			USB_ConfigIndex_Endpoint_t* EndpointEntry = &ConfigIndex->Endpoints[ConfigIndex->TotalEndpoints++];
+
+			EndpointEntry->EndpointAddress   = Endpoint->EndpointAddress;
+			EndpointEntry->Attributes        = Endpoint->Attributes;
+			EndpointEntry->EndpointSize      = le16_to_cpu(Endpoint->EndpointSize);
+			EndpointEntry->PollingIntervalMS = Endpoint->PollingIntervalMS;
+
+			CurrentInterface->TotalEndpoints++;
+		}
+	}
+
+	return ErrorCode;
+}
+
+const USB_ConfigIndex_Interface_t* USB_FindIndexedInterface(const USB_ConfigIndex_t* const ConfigIndex,
+                                                            const USB_ConfigIndex_Interface_t* const PreviousInterface,
+                                                            const uint8_t Class,
+                                                            const uint8_t SubClass,
+                                                            const uint8_t Protocol,
+                                                            const uint8_t MatchMask)
+{
+	uint8_t InterfaceIndex = 0;
+
+	if (PreviousInterface != NULL)
+	  InterfaceIndex = (PreviousInterface - ConfigIndex->Interfaces) + 1;
+
+	while (InterfaceIndex < ConfigIndex->TotalInterfaces)
+	{
+		const USB_ConfigIndex_Interface_t* Interface = &ConfigIndex->Interfaces[InterfaceIndex++];
+
+		if ((MatchMask & CONFIG_INDEX_MATCH_CLASS) && (Interface->Class != Class))
+		  continue;
+
+		if ((MatchMask & CONFIG_INDEX_MATCH_SUBCLASS) && (Interface->SubClass != SubClass))
+		  continue;
+
+		if ((MatchMask & CONFIG_INDEX_MATCH_PROTOCOL) && (Interface->Protocol != Protocol))
+		  continue;
+
+		return Interface;
+	}
+
+	return NULL;
+}
+
+const USB_ConfigIndex_Endpoint_t* USB_FindIndexedEndpoint(const USB_ConfigIndex_t* const ConfigIndex,
+                                                          const USB_ConfigIndex_Interface_t* const Interface,
+                                                          const uint8_t Direction,
+                                                          const uint8_t Type)
+{
+	const USB_ConfigIndex_Endpoint_t* Endpoint = &ConfigIndex->Endpoints[Interface->FirstEndpoint];
+
+	for (uint8_t EndpointsRem = Interface->TotalEndpoints; EndpointsRem; EndpointsRem--)
+	{
+		if (((Endpoint->EndpointAddress & ENDPOINT_DIR_MASK) == Direction) &&
+		    ((Endpoint->Attributes & EP_TYPE_MASK) == Type))
+		{
+			return Endpoint;
+		}
+
+		Endpoint++;
+	}
+
+	return NULL;
+}
@@ -105,6 +105,36 @@
 			/** Returns the descriptor's size, expressed as the 8-bit value indicating the number of bytes. */
 			#define DESCRIPTOR_SIZE(DescriptorPtr)    DESCRIPTOR_PCAST(DescriptorPtr, USB_Descriptor_Header_t)->Size
 
+			#if !defined(CONFIG_INDEX_MAX_INTERFACES) || defined(__DOXYGEN__)
+				/** Maximum number of interface descriptors (including alternate settings) which can be stored in a
+				 *  \ref USB_ConfigIndex_t configuration descriptor index. This value may be overridden in the user
+				 *  project makefile as the value of the \c CONFIG_INDEX_MAX_INTERFACES token.
+				 */
+				#define CONFIG_INDEX_MAX_INTERFACES       8
+			#endif
+
+			#if !defined(CONFIG_INDEX_MAX_ENDPOINTS) || defined(__DOXYGEN__)
+				/** Maximum number of endpoint descriptors which can be stored in a \ref USB_ConfigIndex_t configuration
+				 *  descriptor index. This value may be overridden in the user project makefile as the value of the
+				 *  \c CONFIG_INDEX_MAX_ENDPOINTS token.
+				 */
+				#define CONFIG_INDEX_MAX_ENDPOINTS        16
+			#endif
+
+			/** Mask for \ref USB_FindIndexedInterface(), indicating that the interface class must match. */
+			#define CONFIG_INDEX_MATCH_CLASS          (1 << 0)
+
+			/** Mask for \ref USB_FindIndexedInterface(), indicating that the interface subclass must match. */
+			#define CONFIG_INDEX_MATCH_SUBCLASS       (1 << 1)
+
+			/** Mask for \ref USB_FindIndexedInterface(), indicating that the interface protocol must match. */
+			#define CONFIG_INDEX_MATCH_PROTOCOL       (1 << 2)
+
+			/** Mask for \ref USB_FindIndexedInterface(), indicating that the interface class, subclass and protocol
+			 *  must all match.
+			 */
+			#define CONFIG_INDEX_MATCH_ALL            (CONFIG_INDEX_MATCH_CLASS | CONFIG_INDEX_MATCH_SUBCLASS | CONFIG_INDEX_MATCH_PROTOCOL)
+
 		/* Type Defines: */
 			/** Type define for a Configuration Descriptor comparator function (function taking a pointer to an array
 			 *  of type void, returning a uint8_t value).
@@ -113,6 +143,58 @@
 			 */
 			typedef uint8_t (* ConfigComparatorPtr_t)(void*);
 
+			/** \brief Configuration Descriptor Index Interface Entry.
+			 *
+			 *  Type define for a single interface entry within a \ref USB_ConfigIndex_t configuration descriptor index,
+			 *  summarizing one interface descriptor (or alternate setting) of the indexed configuration.
+			 */
+			typedef struct
+			{
+				uint16_t DescriptorOffset; /**< Offset in bytes of the interface descriptor from the start of the indexed
+				                            *   configuration descriptor, for locating class specific descriptors.
+				                            */
+				uint8_t  InterfaceNumber; /**< Index of the interface in the current configuration. */
+				uint8_t  AlternateSetting; /**< Alternate setting for the interface number. */
+				uint8_t  Class; /**< Interface class ID. */
+				uint8_t  SubClass; /**< Interface subclass ID. */
+				uint8_t  Protocol; /**< Interface protocol ID. */
+				uint8_t  FirstEndpoint; /**< Index of the interface's first endpoint in the index's endpoint table. */
+				uint8_t  TotalEndpoints; /**< Number of endpoints of the interface stored in the index's endpoint table. */
+			} USB_ConfigIndex_Interface_t;
+
+			/** \brief Configuration Descriptor Index Endpoint Entry.
+			 *
+			 *  Type define for a single endpoint entry within a \ref USB_ConfigIndex_t configuration descriptor index,
+			 *  holding the fields of an endpoint descriptor needed to configure a pipe for the endpoint.
+			 */
+			typedef struct
+			{
+				uint8_t  EndpointAddress; /**< Logical address of the endpoint within the device, including direction mask. */
+				uint8_t  Attributes; /**< Endpoint attributes, comprised of a mask of the endpoint type (EP_TYPE_*) and
+				                      *   attributes (ENDPOINT_ATTR_*) masks.
+				                      */
+				uint16_t EndpointSize; /**< Size of the endpoint bank, in bytes, in CPU native endianness. */
+				uint8_t  PollingIntervalMS; /**< Polling interval in milliseconds for the endpoint if it is an INTERRUPT or
+				                             *   ISOCHRONOUS type.
+				                             */
+			} USB_ConfigIndex_Endpoint_t;
+
+			/** \brief Configuration Descriptor Index.
+			 *
+			 *  Type define for a compact index of the interfaces and endpoints of a configuration descriptor, built in a
+			 *  single pass by \ref USB_BuildConfigIndex(). Once built, the index can be searched via
+			 *  \ref USB_FindIndexedInterface() and \ref USB_FindIndexedEndpoint() in place of walking the raw descriptor
+			 *  data, so that the configuration descriptor buffer need not be retained by class drivers which do not
+			 *  require class specific descriptors.
+			 */
+			typedef struct
+			{
+				uint8_t                     TotalInterfaces; /**< Number of valid entries in the interface table. */
+				uint8_t                     TotalEndpoints; /**< Number of valid entries in the endpoint table. */
+				USB_ConfigIndex_Interface_t Interfaces[CONFIG_INDEX_MAX_INTERFACES]; /**< Interface table, in descriptor order. */
+				USB_ConfigIndex_Endpoint_t  Endpoints[CONFIG_INDEX_MAX_ENDPOINTS]; /**< Endpoint table, in descriptor order. */
+			} USB_ConfigIndex_t;
+
 		/* Enums: */
 			/** Enum for the possible return codes of the \ref USB_Host_GetDeviceConfigDescriptor() function. */
 			enum USB_Host_GetConfigDescriptor_ErrorCodes_t
@@ -149,6 +231,17 @@
 				DESCRIPTOR_SEARCH_COMP_EndOfDescriptor = 2, /**< End of configuration descriptor reached before match found. */
 			};
 
+			/** Enum for return values of \ref USB_BuildConfigIndex(). */
+			enum USB_ConfigIndex_ErrorCodes_t
+			{
+				CONFIG_INDEX_Successful                = 0, /**< The configuration descriptor was indexed successfully. */
+				CONFIG_INDEX_InvalidData               = 1, /**< The given data is not a valid configuration descriptor. */
+				CONFIG_INDEX_TableFull                 = 2, /**< The configuration descriptor contains more interfaces or endpoints
+				                                             *   than can be stored in the index; the index holds only the entries
+				                                             *   which fitted.
+				                                             */
+			};
+
 		/* Function Prototypes: */
 			/** Retrieves the configuration descriptor data from an attached device via a standard request into a buffer,
 			 *  including validity and size checking to prevent a buffer overflow.
@@ -255,6 +348,70 @@
 			                                  ConfigComparatorPtr_t const ComparatorRoutine) ATTR_NON_NULL_PTR_ARG(1)
 			                                  ATTR_NON_NULL_PTR_ARG(2) ATTR_NON_NULL_PTR_ARG(3);
 
+			/** Builds a compact index of the interfaces and endpoints of a configuration descriptor, in a single pass
+			 *  over the descriptor data. Endpoints are recorded against the most recent interface descriptor which
+			 *  precedes them; class specific descriptors are not indexed, but may be located from the stored interface
+			 *  descriptor offsets while the configuration descriptor data is retained.
+			 *
+			 *  \param[out] ConfigIndex           Pointer to the index to build.
+			 *  \param[in]  ConfigDescriptorSize  Length of the attached device's Configuration Descriptor.
+			 *  \param[in]  ConfigDescriptorData  Pointer to a buffer containing the attached device's Configuration Descriptor.
+			 *
+			 *  \return A value from the \ref USB_ConfigIndex_ErrorCodes_t enum.
+			 */
+			uint8_t USB_BuildConfigIndex(USB_ConfigIndex_t* const ConfigIndex,
+			                             uint16_t ConfigDescriptorSize,
+			                             void* ConfigDescriptorData) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(3);
+
+			/** Searches a configuration descriptor index for the next interface entry with the given class, subclass
+			 *  and protocol values, as selected by the given match mask.
+			 *
+			 *  \param[in] ConfigIndex        Pointer to an index built by \ref USB_BuildConfigIndex().
+			 *  \param[in] PreviousInterface  Interface entry to continue searching after, or \c NULL to search from the
+			 *                                first interface entry.
+			 *  \param[in] Class              Interface class ID to match.
+			 *  \param[in] SubClass           Interface subclass ID to match.
+			 *  \param[in] Protocol           Interface protocol ID to match.
+			 *  \param[in] MatchMask          Mask of \c CONFIG_INDEX_MATCH_* masks, indicating which values must match.
+			 *
+			 *  \return Pointer to the matching interface entry, or \c NULL if no further interface entry matches.
+			 *
+			 *  Usage Example:
+			 *  \code
+			 *  const USB_ConfigIndex_Interface_t* Interface = NULL;
+			 *
+			 *  while ((Interface = USB_FindIndexedInterface(&ConfigIndex, Interface, HID_CSCP_HIDClass, 0, 0,
+			 *                                               CONFIG_INDEX_MATCH_CLASS)) != NULL)
+			 *  {
+			 *      const USB_ConfigIndex_Endpoint_t* Endpoint = USB_FindIndexedEndpoint(&ConfigIndex, Interface,
+			 *                                                                           ENDPOINT_DIR_IN, EP_TYPE_INTERRUPT);
+			 *
+			 *      // Do something with the interface and its endpoint
+			 *  }
+			 *  \endcode
+			 */
+			const USB_ConfigIndex_Interface_t* USB_FindIndexedInterface(const USB_ConfigIndex_t* const ConfigIndex,
+			                                                            const USB_ConfigIndex_Interface_t* const PreviousInterface,
+			                                                            const uint8_t Class,
+			                                                            const uint8_t SubClass,
+			                                                            const uint8_t Protocol,
+			                                                            const uint8_t MatchMask) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Searches the endpoints of an indexed interface for the first endpoint with the given direction and type.
+			 *
+			 *  \param[in] ConfigIndex  Pointer to an index built by \ref USB_BuildConfigIndex().
+			 *  \param[in] Interface    Pointer to the interface entry within the index whose endpoints are to be searched.
+			 *  \param[in] Direction    Endpoint direction to match, either \ref ENDPOINT_DIR_IN or \ref ENDPOINT_DIR_OUT.
+			 *  \param[in] Type         Endpoint type to match, a \c EP_TYPE_* mask.
+			 *
+			 *  \return Pointer to the matching endpoint entry, or \c NULL if the interface has no such endpoint.
+			 */
+			const USB_ConfigIndex_Endpoint_t* USB_FindIndexedEndpoint(const USB_ConfigIndex_t* const ConfigIndex,
+			                                                          const USB_ConfigIndex_Interface_t* const Interface,
+			                                                          const uint8_t Direction,
+			                                                          const uint8_t Type) ATTR_NON_NULL_PTR_ARG(1)
+			                                                          ATTR_NON_NULL_PTR_ARG(2);
+
 		/* Inline Functions: */
 			/** Skips over the current sub-descriptor inside the configuration descriptor, so that the pointer then
 			    points to the next sub-descriptor. The bytes remaining value is automatically decremented.
@@ -66,7 +66,108 @@
 			#error Do not include this file directly. Include LUFA/Drivers/USB/USB.h instead.
 		#endif
 
+		#if defined(FIXED_CONTROL_ENDPOINT_SIZE) && (FIXED_CONTROL_ENDPOINT_SIZE != 8) && (FIXED_CONTROL_ENDPOINT_SIZE != 16) && \
+		    (FIXED_CONTROL_ENDPOINT_SIZE != 32) && (FIXED_CONTROL_ENDPOINT_SIZE != 64)
+			#error FIXED_CONTROL_ENDPOINT_SIZE must be 8, 16, 32 or 64.
+		#endif
+
+		#if defined(USE_DESCRIPTOR_TABLE) && defined(ARCH_HAS_MULTI_ADDRESS_SPACE) && \
+		    !(defined(USE_FLASH_DESCRIPTORS) || defined(USE_EEPROM_DESCRIPTORS) || defined(USE_RAM_DESCRIPTORS))
+			#error USE_DESCRIPTOR_TABLE requires one of the USE_*_DESCRIPTORS tokens to be defined on this architecture.
+		#endif
+
 	/* Public Interface - May be used in end-application: */
+		/* Macros: */
+			/** Determines at compile time if the given endpoint size is permitted for a full speed endpoint of the given
+			 *  type by the USB 2.0 specification, for use with \ref GCC_STATIC_ASSERT() to validate descriptor values.
+			 *
+			 *  \param[in] Type  Type of the endpoint, a \c EP_TYPE_* mask.
+			 *  \param[in] Size  Size of the endpoint in bytes.
+			 *
+			 *  \return Boolean \c true if the size is valid for the endpoint type, \c false otherwise.
+			 */
+			#define USB_ENDPOINT_SIZE_IS_VALID(Type, Size) \
+			             (((Type) == EP_TYPE_ISOCHRONOUS) ? (((Size) >= 1) && ((Size) <= 1023)) : \
+			              ((Type) == EP_TYPE_INTERRUPT)   ? (((Size) >= 1) && ((Size) <= 64))   : \
+			              (((Size) == 8) || ((Size) == 16) || ((Size) == 32) || ((Size) == 64)))
+
+			#if defined(USE_DESCRIPTOR_TABLE) || defined(__DOXYGEN__)
+				/** Creates a \ref USB_Descriptor_TableEntry_t entry for a standard descriptor, such as the device or a
+				 *  configuration descriptor, for use within \ref USB_DESCRIPTOR_TABLE(). The size of the entry is taken
+				 *  from the size of the given descriptor object.
+				 *
+				 *  \param[in] Type        Descriptor type, a value from the \ref USB_DescriptorTypes_t enum.
+				 *  \param[in] Index       Index of the descriptor within descriptors of the same type.
+				 *  \param[in] Descriptor  Descriptor object to return for the entry.
+				 */
+				#define USB_DESCRIPTOR_ENTRY(Type, Index, Descriptor) \
+				             { .wValue = (((Type) << 8) | (Index)), .wIndex = 0, .Address = &(Descriptor), .Size = sizeof(Descriptor) }
+
+				/** Creates a \ref USB_Descriptor_TableEntry_t entry for a string descriptor created via
+				 *  \ref USB_STRING_DESCRIPTOR() or \ref USB_STRING_DESCRIPTOR_ARRAY(), for use within
+				 *  \ref USB_DESCRIPTOR_TABLE(). The size of the entry is read from the string descriptor's header.
+				 *
+				 *  \param[in] Index       Index of the string descriptor.
+				 *  \param[in] Descriptor  String descriptor object to return for the entry.
+				 */
+				#define USB_STRING_DESCRIPTOR_ENTRY(Index, Descriptor) \
+				             { .wValue = ((DTYPE_String << 8) | (Index)), .wIndex = 0, .Address = &(Descriptor), .Size = 0 }
+
+				/** Creates a \ref USB_Descriptor_TableEntry_t entry for a class specific descriptor requested from an
+				 *  interface, such as a HID report descriptor, for use within \ref USB_DESCRIPTOR_TABLE(). The size of
+				 *  the entry is taken from the size of the given descriptor object.
+				 *
+				 *  \param[in] Type             Class specific descriptor type.
+				 *  \param[in] InterfaceNumber  Index of the interface the descriptor is requested from.
+				 *  \param[in] Descriptor       Descriptor object to return for the entry.
+				 */
+				#define USB_INTERFACE_DESCRIPTOR_ENTRY(Type, InterfaceNumber, Descriptor) \
+				             { .wValue = ((Type) << 8), .wIndex = (InterfaceNumber), .Address = &(Descriptor), .Size = sizeof(Descriptor) }
+
+				/** Defines the device's descriptor table from the given list of entries, when the \c USE_DESCRIPTOR_TABLE
+				 *  compile time token is defined. The table is searched by the library's own implementation of
+				 *  \ref CALLBACK_USB_GetDescriptor(), and so replaces the function in the user application. The table
+				 *  must be defined exactly once in the user application.
+				 *
+				 *  \attention As the table is searched by a binary search, entries must be listed in ascending order of
+				 *             descriptor type, then index, then interface number. The order of the table, and the
+				 *             configuration descriptors within it, are checked by \ref USB_Device_IsDescriptorTableValid()
+				 *             each time the USB interface is initialized in device mode, breaking into an attached JTAG
+				 *             debugger via \ref JTAG_ASSERT() if the check fails.
+				 *
+				 *  Usage Example:
+				 *  \code
+				 *  USB_DESCRIPTOR_TABLE(
+				 *      USB_DESCRIPTOR_ENTRY(DTYPE_Device, 0, DeviceDescriptor),
+				 *      USB_DESCRIPTOR_ENTRY(DTYPE_Configuration, 0, ConfigurationDescriptor),
+				 *      USB_STRING_DESCRIPTOR_ENTRY(STRING_ID_Language, LanguageString),
+				 *      USB_STRING_DESCRIPTOR_ENTRY(STRING_ID_Manufacturer, ManufacturerString),
+				 *      USB_STRING_DESCRIPTOR_ENTRY(STRING_ID_Product, ProductString),
+				 *  );
+				 *  \endcode
+				 */
+				#define USB_DESCRIPTOR_TABLE(...) \
+				             const USB_Descriptor_TableEntry_t PROGMEM USB_DescriptorTable[] = { __VA_ARGS__ }; \
+				             const uint8_t USB_DescriptorTableEntries = (sizeof(USB_DescriptorTable) / sizeof(USB_DescriptorTable[0]))
+			#endif
+
+		/* Type Defines: */
+			#if defined(USE_DESCRIPTOR_TABLE) || defined(__DOXYGEN__)
+				/** \brief Descriptor Table Entry.
+				 *
+				 *  Type define for a single entry of the device's descriptor table, mapping a \c GET_DESCRIPTOR request's
+				 *  \c wValue and \c wIndex values to a descriptor. Entries should be created via the \ref USB_DESCRIPTOR_ENTRY(),
+				 *  \ref USB_STRING_DESCRIPTOR_ENTRY() and \ref USB_INTERFACE_DESCRIPTOR_ENTRY() macros.
+				 */
+				typedef struct
+				{
+					uint16_t    wValue; /**< Descriptor type in the upper byte, and descriptor index in the lower byte. */
+					uint16_t    wIndex; /**< Interface number for class specific descriptors, zero for standard descriptors. */
+					const void* Address; /**< Address of the descriptor, in the memory space selected by the \c USE_*_DESCRIPTORS token. */
+					uint16_t    Size; /**< Size of the descriptor in bytes, or zero to read the size from the descriptor's header. */
+				} USB_Descriptor_TableEntry_t;
+			#endif
+
 		/* Enums: */
 			/** Enum for the various states of the USB Device state machine. Only some states are
 			 *  implemented in the LUFA library - other states are left to the user to implement.
@@ -128,6 +229,10 @@
 			 *        \c USE_EEPROM_DESCRIPTORS tokens may be defined in the project makefile and passed to the compiler by the -D
 			 *        switch.
 			 *
+			 *  \note When the \c USE_DESCRIPTOR_TABLE compile time token is defined, this function is instead implemented by
+			 *        the library as a binary search of the table defined via \ref USB_DESCRIPTOR_TABLE(), and must not be
+			 *        defined in the user application.
+			 *
 			 *  \return Size in bytes of the descriptor if it exists, zero or \ref NO_DESCRIPTOR otherwise.
 			 */
 			uint16_t CALLBACK_USB_GetDescriptor(const uint16_t wValue,
@@ -139,6 +244,31 @@
 			#endif
 			                                    ) ATTR_WARN_UNUSED_RESULT ATTR_NON_NULL_PTR_ARG(3);
 
+			#if defined(USE_DESCRIPTOR_TABLE) || defined(__DOXYGEN__)
+				/** Validates the descriptor table defined via \ref USB_DESCRIPTOR_TABLE(). The table's entries must be in
+				 *  strictly ascending order of descriptor type, index and interface number, as otherwise the library's binary
+				 *  search would fail to find some descriptors. Each configuration descriptor in the table must also have a
+				 *  total length equal to the size of its entry, and a total interface count equal to the number of interface
+				 *  descriptors it contains with an alternate setting of zero.
+				 *
+				 *  \note This function is only available when the \c USE_DESCRIPTOR_TABLE compile time token is defined.
+				 *
+				 *  \return Boolean \c true if the descriptor table is valid, \c false otherwise.
+				 */
+				bool USB_Device_IsDescriptorTableValid(void) ATTR_WARN_UNUSED_RESULT;
+			#endif
+
+		/* Global Variables: */
+			#if defined(USE_DESCRIPTOR_TABLE) || defined(__DOXYGEN__)
+				/** Descriptor table of the device, defined in the user application via \ref USB_DESCRIPTOR_TABLE(). This
+				 *  table is always located in FLASH memory on architectures with a separate FLASH address space.
+				 */
+				extern const USB_Descriptor_TableEntry_t USB_DescriptorTable[];
+
+				/** Number of entries in \ref USB_DescriptorTable, defined in the user application via \ref USB_DESCRIPTOR_TABLE(). */
+				extern const uint8_t USB_DescriptorTableEntries;
+			#endif
+
 	/* Architecture Includes: */
 		#if (ARCH == ARCH_AVR8)
 			#include "AVR8/Device_AVR8.h"
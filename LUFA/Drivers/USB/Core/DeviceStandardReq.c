@@ -35,6 +35,7 @@
 
 #define  __INCLUDE_FROM_DEVICESTDREQ_C
 #include "DeviceStandardReq.h"
+#include "USBTrace.h"
 
 uint8_t USB_Device_ConfigurationNumber;
 
@@ -46,6 +47,11 @@ bool    USB_Device_CurrentlySelfPowered;
 bool    USB_Device_RemoteWakeupEnabled;
 #endif
 
+#if defined(DEVICE_MAX_INTERFACES)
+static USB_Device_ControlRequestHandlerEntry_t USB_Device_ControlRequestHandlers[DEVICE_MAX_INTERFACES];
+static uint8_t USB_Device_EndpointInterfaces[ENDPOINT_TOTAL_ENDPOINTS * 2];
+#endif
+
 void USB_Device_ProcessControlRequest(void)
 {
 	#if defined(ARCH_BIG_ENDIAN)
@@ -61,7 +67,16 @@ void USB_Device_ProcessControlRequest(void)
 	  *(RequestHeader++) = Endpoint_Read_8();
 	#endif
 
+	USB_TRACE(USB_TRACE_EVENT_ControlRequest, USB_ControlRequest.bRequest, USB_ControlRequest.wLength);
+
+	#if defined(DEVICE_MAX_INTERFACES)
+	USB_Device_DispatchControlRequest();
+
+	if (Endpoint_IsSETUPReceived())
+	  EVENT_USB_Device_ControlRequest();
+	#else
 	EVENT_USB_Device_ControlRequest();
+	#endif
 
 	if (Endpoint_IsSETUPReceived())
 	{
@@ -122,6 +137,187 @@ void USB_Device_ProcessControlRequest(void)
 	}
 }
 
+#if defined(DEVICE_MAX_INTERFACES)
+bool USB_Device_SetControlRequestHandler(const uint8_t InterfaceNumber,
+                                         USB_Device_ControlRequestHandler_t const Handler,
+                                         void* const InterfaceInfo)
+{
+	if (InterfaceNumber >= DEVICE_MAX_INTERFACES)
+	  return false;
+
+	USB_Device_ControlRequestHandlers[InterfaceNumber].Handler       = Handler;
+	USB_Device_ControlRequestHandlers[InterfaceNumber].InterfaceInfo = InterfaceInfo;
+
+	return true;
+}
+
+bool USB_Device_SetEndpointInterface(const uint8_t EndpointAddress,
+                                     const uint8_t InterfaceNumber)
+{
+	uint8_t EndpointNumber = (EndpointAddress & ENDPOINT_EPNUM_MASK);
+
+	if ((EndpointNumber >= ENDPOINT_TOTAL_ENDPOINTS) || (InterfaceNumber >= DEVICE_MAX_INTERFACES))
+	  return false;
+
+	/* Interface numbers are stored offset by one, so that zero indicates an unmapped endpoint */
+	USB_Device_EndpointInterfaces[(EndpointNumber << 1) | ((EndpointAddress & ENDPOINT_DIR_IN) ? 1 : 0)] = (InterfaceNumber + 1);
+
+	return true;
+}
+
+void USB_Device_ClearControlRequestHandlers(void)
+{
+	memset(USB_Device_ControlRequestHandlers, 0x00, sizeof(USB_Device_ControlRequestHandlers));
+	memset(USB_Device_EndpointInterfaces, 0x00, sizeof(USB_Device_EndpointInterfaces));
+}
+
+static void USB_Device_DispatchControlRequest(void)
+{
+	uint8_t InterfaceNumber;
+
+	switch (USB_ControlRequest.bmRequestType & CONTROL_REQTYPE_RECIPIENT)
+	{
+		case REQREC_INTERFACE:
+			InterfaceNumber = (uint8_t)USB_ControlRequest.wIndex;
+			break;
+		case REQREC_ENDPOINT:
+		{
+			uint8_t EndpointAddress = (uint8_t)USB_ControlRequest.wIndex;
+			uint8_t EndpointNumber  = (EndpointAddress & ENDPOINT_EPNUM_MASK);
+
+			if (EndpointNumber >= ENDPOINT_TOTAL_ENDPOINTS)
+			  return;
+
+			InterfaceNumber = USB_Device_EndpointInterfaces[(EndpointNumber << 1) | ((EndpointAddress & ENDPOINT_DIR_IN) ? 1 : 0)];
+
+			if (!(InterfaceNumber--))
+			  return;
+
+			break;
+		}
+		default:
+			return;
+	}
+
+	if (InterfaceNumber >= DEVICE_MAX_INTERFACES)
+	  return;
+
+	USB_Device_ControlRequestHandlerEntry_t* Entry = &USB_Device_ControlRequestHandlers[InterfaceNumber];
+
+	if (Entry->Handler != NULL)
+	  Entry->Handler(Entry->InterfaceInfo);
+}
+#endif
+
+#if defined(USE_DESCRIPTOR_TABLE)
+uint16_t CALLBACK_USB_GetDescriptor(const uint16_t wValue,
+                                    const uint16_t wIndex,
+                                    const void** const DescriptorAddress)
+{
+	uint8_t Lower = 0;
+	uint8_t Upper = USB_DescriptorTableEntries;
+
+	/* Only class and vendor specific descriptor types (with bits 5 and 6 of the type set) are keyed by wIndex */
+	uint16_t EntryIndex = ((wValue >> 8) & 0x60) ? wIndex : 0;
+
+	while (Lower < Upper)
+	{
+		uint8_t Middle = Lower + ((Upper - Lower) >> 1);
+
+		USB_Descriptor_TableEntry_t Entry;
+		memcpy_P(&Entry, &USB_DescriptorTable[Middle], sizeof(USB_Descriptor_TableEntry_t));
+
+		if ((Entry.wValue < wValue) || ((Entry.wValue == wValue) && (Entry.wIndex < EntryIndex)))
+		{
+			Lower = (Middle + 1);
+		}
+		else if ((Entry.wValue > wValue) || (Entry.wIndex > EntryIndex))
+		{
+			Upper = Middle;
+		}
+		else
+		{
+			*DescriptorAddress = Entry.Address;
+
+			if (Entry.Size)
+			  return Entry.Size;
+
+			return USB_Device_ReadDescriptorByte(&((const USB_Descriptor_Header_t*)Entry.Address)->Size);
+		}
+	}
+
+	return NO_DESCRIPTOR;
+}
+
+bool USB_Device_IsDescriptorTableValid(void)
+{
+	USB_Descriptor_TableEntry_t PreviousEntry;
+
+	for (uint8_t EntryIndex = 0; EntryIndex < USB_DescriptorTableEntries; EntryIndex++)
+	{
+		USB_Descriptor_TableEntry_t Entry;
+		memcpy_P(&Entry, &USB_DescriptorTable[EntryIndex], sizeof(USB_Descriptor_TableEntry_t));
+
+		if (EntryIndex && ((Entry.wValue < PreviousEntry.wValue) ||
+		                   ((Entry.wValue == PreviousEntry.wValue) && (Entry.wIndex <= PreviousEntry.wIndex))))
+		{
+			return false;
+		}
+
+		if (((Entry.wValue >> 8) == DTYPE_Configuration) && !(USB_Device_IsConfigDescriptorValid(Entry.Address, Entry.Size)))
+		  return false;
+
+		PreviousEntry = Entry;
+	}
+
+	return true;
+}
+
+static uint8_t USB_Device_ReadDescriptorByte(const uint8_t* const Address)
+{
+	#if defined(USE_FLASH_DESCRIPTORS)
+	return pgm_read_byte(Address);
+	#elif defined(USE_EEPROM_DESCRIPTORS)
+	return eeprom_read_byte(Address);
+	#else
+	return *Address;
+	#endif
+}
+
+static bool USB_Device_IsConfigDescriptorValid(const uint8_t* const Descriptor,
+                                               const uint16_t Size)
+{
+	uint16_t TotalSize = (USB_Device_ReadDescriptorByte(&Descriptor[offsetof(USB_Descriptor_Configuration_Header_t, TotalConfigurationSize)]) |
+	                      (USB_Device_ReadDescriptorByte(&Descriptor[offsetof(USB_Descriptor_Configuration_Header_t, TotalConfigurationSize) + 1]) << 8));
+	uint8_t  TotalInterfaces = USB_Device_ReadDescriptorByte(&Descriptor[offsetof(USB_Descriptor_Configuration_Header_t, TotalInterfaces)]);
+
+	if (TotalSize != Size)
+	  return false;
+
+	uint16_t CurrentOffset   = 0;
+	uint8_t  InterfacesFound = 0;
+
+	while (CurrentOffset < TotalSize)
+	{
+		const uint8_t* CurrentDescriptor = &Descriptor[CurrentOffset];
+		uint8_t        DescriptorSize    = USB_Device_ReadDescriptorByte(&CurrentDescriptor[offsetof(USB_Descriptor_Header_t, Size)]);
+
+		if (DescriptorSize < sizeof(USB_Descriptor_Header_t))
+		  return false;
+
+		if ((USB_Device_ReadDescriptorByte(&CurrentDescriptor[offsetof(USB_Descriptor_Header_t, Type)]) == DTYPE_Interface) &&
+		    !(USB_Device_ReadDescriptorByte(&CurrentDescriptor[offsetof(USB_Descriptor_Interface_t, AlternateSetting)])))
+		{
+			InterfacesFound++;
+		}
+
+		CurrentOffset += DescriptorSize;
+	}
+
+	return ((CurrentOffset == TotalSize) && (InterfacesFound == TotalInterfaces));
+}
+#endif
+
 static void USB_Device_SetAddress(void)
 {
 	uint8_t DeviceAddress = (USB_ControlRequest.wValue & 0x7F);
@@ -197,6 +393,10 @@ static void USB_Device_SetConfiguration(void)
 
 	Endpoint_ClearStatusStage();
 
+	#if defined(DEVICE_MAX_INTERFACES)
+	USB_Device_ClearControlRequestHandlers();
+	#endif
+
 	if (USB_Device_ConfigurationNumber)
 	  USB_DeviceState = DEVICE_STATE_Configured;
 	else
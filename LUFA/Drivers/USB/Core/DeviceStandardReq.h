@@ -61,6 +61,37 @@
 		#endif
 
 	/* Public Interface - May be used in end-application: */
+		/* Macros: */
+			#if defined(DEVICE_MAX_INTERFACES) || defined(__DOXYGEN__)
+				/** Defines a static control request handler of type \ref USB_Device_ControlRequestHandler_t, which passes
+				 *  each request's registered interface pointer on to a typed request processing function, such as a class
+				 *  driver's \c *_ProcessControlRequest() function. The defined handler can then be registered via
+				 *  \ref USB_Device_SetControlRequestHandler().
+				 *
+				 *  \param[in] HandlerName        Name of the handler function to define.
+				 *  \param[in] InterfaceInfoType  Type of the interface structure registered with the handler.
+				 *  \param[in] ProcessFunction    Function to call for each request, taking a pointer to \c InterfaceInfoType.
+				 *
+				 *  \ingroup Group_Device
+				 */
+				#define USB_DEVICE_CONTROL_REQUEST_HANDLER(HandlerName, InterfaceInfoType, ProcessFunction) \
+					static void HandlerName(void* const InterfaceInfo)                                   \
+					{                                                                                    \
+						ProcessFunction((InterfaceInfoType*)InterfaceInfo);                              \
+					}
+			#endif
+
+		/* Type Defines: */
+			#if defined(DEVICE_MAX_INTERFACES) || defined(__DOXYGEN__)
+				/** Type define for a control request handler registered against an interface via
+				 *  \ref USB_Device_SetControlRequestHandler(). Handlers should be defined with the
+				 *  \ref USB_DEVICE_CONTROL_REQUEST_HANDLER() macro.
+				 *
+				 *  \ingroup Group_Device
+				 */
+				typedef void (* USB_Device_ControlRequestHandler_t)(void* const InterfaceInfo);
+			#endif
+
 		/* Enums: */
 			#if defined(ARCH_HAS_MULTI_ADDRESS_SPACE) || defined(__DOXYGEN__)
 				/** Enum for the possible descriptor memory spaces, for the \c MemoryAddressSpace parameter of the
@@ -120,8 +151,61 @@
 				extern bool USB_Device_CurrentlySelfPowered;
 			#endif
 
+		/* Function Prototypes: */
+			#if defined(DEVICE_MAX_INTERFACES) || defined(__DOXYGEN__)
+				/** Registers a control request handler for the given interface, so that control requests addressed to the
+				 *  interface (or to an endpoint mapped to it via \ref USB_Device_SetEndpointInterface()) are dispatched
+				 *  directly to the handler by the library, before the \ref EVENT_USB_Device_ControlRequest() event is fired.
+				 *  Requests which are not handled by the registered handler remain pending for the event and the library's
+				 *  standard request processing.
+				 *
+				 *  The handler table is cleared each time the host selects a configuration; the device class drivers register
+				 *  their own handlers from their \c *_ConfigureEndpoints() functions when this feature is enabled.
+				 *
+				 *  \note This function is only available when the \c DEVICE_MAX_INTERFACES compile time token is defined.
+				 *
+				 *  \param[in] InterfaceNumber  Index of the interface within the device, less than \c DEVICE_MAX_INTERFACES.
+				 *  \param[in] Handler          Control request handler for the interface, or \c NULL to remove the handler.
+				 *  \param[in] InterfaceInfo    Pointer to pass to the handler when it is called.
+				 *
+				 *  \return Boolean \c true if the handler was registered, \c false if the interface number is out of range.
+				 *
+				 *  \ingroup Group_Device
+				 */
+				bool USB_Device_SetControlRequestHandler(const uint8_t InterfaceNumber,
+				                                         USB_Device_ControlRequestHandler_t const Handler,
+				                                         void* const InterfaceInfo);
+
+				/** Maps an endpoint to the interface which owns it, so that control requests addressed to the endpoint
+				 *  are dispatched to the control request handler registered for that interface.
+				 *
+				 *  \note This function is only available when the \c DEVICE_MAX_INTERFACES compile time token is defined.
+				 *
+				 *  \param[in] EndpointAddress  Address of the endpoint, including the endpoint direction mask.
+				 *  \param[in] InterfaceNumber  Index of the interface which owns the endpoint.
+				 *
+				 *  \return Boolean \c true if the endpoint was mapped, \c false if the endpoint address is out of range.
+				 *
+				 *  \ingroup Group_Device
+				 */
+				bool USB_Device_SetEndpointInterface(const uint8_t EndpointAddress,
+				                                     const uint8_t InterfaceNumber);
+
+				/** Removes all registered control request handlers and endpoint to interface mappings.
+				 *
+				 *  \note This function is only available when the \c DEVICE_MAX_INTERFACES compile time token is defined.
+				 *
+				 *  \ingroup Group_Device
+				 */
+				void USB_Device_ClearControlRequestHandlers(void);
+			#endif
+
 	/* Private Interface - For use in library only: */
 	#if !defined(__DOXYGEN__)
+		#if defined(DEVICE_MAX_INTERFACES) && ((DEVICE_MAX_INTERFACES < 1) || (DEVICE_MAX_INTERFACES > 255))
+			#error DEVICE_MAX_INTERFACES must be between 1 and 255.
+		#endif
+
 		#if defined(USE_RAM_DESCRIPTORS) && defined(USE_EEPROM_DESCRIPTORS)
 			#error USE_RAM_DESCRIPTORS and USE_EEPROM_DESCRIPTORS are mutually exclusive.
 		#elif defined(USE_RAM_DESCRIPTORS) && defined(USE_FLASH_DESCRIPTORS)
@@ -132,6 +216,15 @@
 			#error Only one of the USE_*_DESCRIPTORS modes should be selected.
 		#endif
 
+		/* Type Defines: */
+			#if defined(DEVICE_MAX_INTERFACES)
+				typedef struct
+				{
+					USB_Device_ControlRequestHandler_t Handler;
+					void*                              InterfaceInfo;
+				} USB_Device_ControlRequestHandlerEntry_t;
+			#endif
+
 		/* Function Prototypes: */
 			void USB_Device_ProcessControlRequest(void);
 
@@ -146,6 +239,16 @@
 				#if !defined(NO_INTERNAL_SERIAL) && (USE_INTERNAL_SERIAL != NO_DESCRIPTOR)
 					static void USB_Device_GetInternalSerialDescriptor(void);
 				#endif
+
+				#if defined(DEVICE_MAX_INTERFACES)
+					static void USB_Device_DispatchControlRequest(void);
+				#endif
+
+				#if defined(USE_DESCRIPTOR_TABLE)
+					static uint8_t USB_Device_ReadDescriptorByte(const uint8_t* const Address);
+					static bool USB_Device_IsConfigDescriptorValid(const uint8_t* const Descriptor,
+					                                               const uint16_t Size) ATTR_NON_NULL_PTR_ARG(1);
+				#endif
 			#endif
 	#endif
 
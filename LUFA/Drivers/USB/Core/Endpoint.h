@@ -99,6 +99,24 @@
 				uint8_t  Banks; /**< Number of hardware banks to use for the endpoint. */
 			} USB_Endpoint_Table_t;
 
+			#if defined(INTERRUPT_DATA_ENDPOINTS) || defined(__DOXYGEN__)
+				/** Type define for an endpoint completion handler, registered against a data endpoint via
+				 *  \ref Endpoint_SetCompletionHandler(). Handlers are run from the USB controller interrupt each time
+				 *  the endpoint's bank becomes ready - i.e. when an OUT packet has been received, or when an IN bank
+				 *  is free to be filled.
+				 *
+				 *  \note Only available when the \c INTERRUPT_DATA_ENDPOINTS token is defined.
+				 *
+				 *  \param[in] Address  Address of the endpoint whose bank is ready.
+				 *  \param[in] Context  Context pointer given when the handler was registered.
+				 *
+				 *  \return Boolean \c true if the endpoint's interrupt should remain enabled, \c false if it should be
+				 *          disabled until re-enabled via \ref Endpoint_EnableCompletionInterrupt().
+				 */
+				typedef bool (*Endpoint_CompletionHandler_t)(const uint8_t Address,
+				                                             void* const Context);
+			#endif
+
 		/* Macros: */
 			/** Endpoint number mask, for masking against endpoint addresses to retrieve the endpoint's
 			 *  numerical address in the device.
@@ -110,6 +128,24 @@
 			 */
 			#define ENDPOINT_CONTROLEP                      0
 
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Preprocessor Checks: */
+			#if defined(INTERRUPT_DATA_ENDPOINTS) && defined(CONTROL_ONLY_DEVICE)
+				#error The INTERRUPT_DATA_ENDPOINTS token cannot be used with CONTROL_ONLY_DEVICE.
+			#endif
+
+		/* Type Defines: */
+			#if defined(INTERRUPT_DATA_ENDPOINTS)
+				typedef struct
+				{
+					uint8_t                      Address;
+					Endpoint_CompletionHandler_t Handler;
+					void*                        Context;
+				} Endpoint_CompletionEntry_t;
+			#endif
+	#endif
+
 	/* Architecture Includes: */
 		#if (ARCH == ARCH_AVR8)
 			#include "AVR8/Endpoint_AVR8.h"
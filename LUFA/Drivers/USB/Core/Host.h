@@ -63,6 +63,10 @@
 			#error Do not include this file directly. Include LUFA/Drivers/USB/USB.h instead.
 		#endif
 
+		#if defined(HOST_MAX_DEVICES) && ((HOST_MAX_DEVICES < 1) || (HOST_MAX_DEVICES > 127))
+			#error HOST_MAX_DEVICES must be between 1 and 127.
+		#endif
+
 	/* Public Interface - May be used in end-application: */
 		/* Enums: */
 			/** Enum for the various states of the USB Host state machine.
@@ -121,6 +125,161 @@
 				                                               */
 			};
 
+		/* Type Defines: */
+			/** \brief Host Enumeration Timing Record.
+			 *
+			 *  Type define for the per-phase timing record of the most recent device enumeration, filled in by the host
+			 *  state machine when the \c HOST_ENUMERATION_TIMING compile time token is defined. Phase times are measured
+			 *  in USB frames (milliseconds) from the point the device connection is detected, and accumulate across
+			 *  enumeration retries. Bus reset signalling time is not included.
+			 *
+			 *  \see \ref USB_Host_EnumerationTiming for the global enumeration timing record.
+			 */
+			typedef struct
+			{
+				uint16_t DebounceMS; /**< Time from connection detection to the first bus reset. */
+				uint16_t ResetMS; /**< Time spent in bus reset recovery before the first control request. */
+				uint16_t DescriptorMS; /**< Time spent reading the control endpoint size, and the following bus reset recovery. */
+				uint16_t AddressMS; /**< Time spent setting the device address, and the following address recovery. */
+				uint16_t TotalMS; /**< Total time from connection detection to enumeration completion or failure. */
+				uint8_t  Retries; /**< Number of times the enumeration was retried after a failed control request. */
+			} USB_Host_EnumerationTiming_t;
+
+			/** \brief Host Device Table Entry.
+			 *
+			 *  Type define for an entry in the host device table, which tracks each device attached to the host either
+			 *  directly or through one or more downstream hubs when the \c HOST_MAX_DEVICES compile time token is defined.
+			 *  The bus address of each device is always one greater than the index of its entry in the table, so that a
+			 *  device can be located from its address without a search.
+			 *
+			 *  \see \ref USB_Host_Devices for the global host device table.
+			 */
+			typedef struct
+			{
+				uint8_t Address; /**< Bus address assigned to the device, or zero if the table entry is unused. */
+				uint8_t ParentAddress; /**< Bus address of the hub the device is attached to, or zero if the device is
+				                        *   attached directly to the host port.
+				                        */
+				uint8_t ParentPort; /**< Hub port number the device is attached to, or zero if the device is attached
+				                     *   directly to the host port.
+				                     */
+				bool    IsFullSpeed; /**< Indicates if the device is operating at Full Speed (12Mb/s) rather than Low Speed (1.5Mb/s). */
+				uint8_t ControlPipeSize; /**< Maximum packet size of the device's default control endpoint. */
+				uint8_t ConfigurationNumber; /**< Currently set configuration number of the device, or zero if unconfigured. */
+			} USB_Host_Device_t;
+
+		/* Global Variables: */
+			#if defined(HOST_ENUMERATION_TIMING) || defined(__DOXYGEN__)
+				/** Per-phase timing record of the most recent device enumeration. This is reset each time a new
+				 *  device connection is detected, and is complete once the \ref EVENT_USB_Host_DeviceEnumerationComplete()
+				 *  or \ref EVENT_USB_Host_DeviceEnumerationFailed() event fires.
+				 *
+				 *  \note This variable is only available when the \c HOST_ENUMERATION_TIMING compile time token is defined.
+				 */
+				extern USB_Host_EnumerationTiming_t USB_Host_EnumerationTiming;
+			#endif
+
+			#if defined(HOST_MAX_DEVICES) || defined(__DOXYGEN__)
+				/** Table of devices currently attached to the host, indexed by each device's bus address minus one. The
+				 *  table is cleared each time a new device is connected to the host port, which is then enumerated into
+				 *  the first table entry at address \ref USB_HOST_DEVICEADDRESS.
+				 *
+				 *  \note This variable is only available when the \c HOST_MAX_DEVICES compile time token is defined.
+				 *
+				 *  \attention This variable should be treated as read-only in the user application, and never manually
+				 *             changed in value.
+				 */
+				extern USB_Host_Device_t USB_Host_Devices[HOST_MAX_DEVICES];
+
+				/** Bus address of the currently selected device, set via \ref USB_Host_SelectDevice(). Control requests
+				 *  and newly configured pipes are directed to this device.
+				 *
+				 *  \note This variable is only available when the \c HOST_MAX_DEVICES compile time token is defined.
+				 *
+				 *  \attention This variable should be treated as read-only in the user application, and never manually
+				 *             changed in value.
+				 */
+				extern uint8_t USB_Host_DeviceAddress;
+			#endif
+
+		/* Function Prototypes: */
+			#if defined(HOST_MAX_DEVICES) || defined(__DOXYGEN__)
+				/** Allocates a free entry in the host device table for a device newly attached to a downstream hub port,
+				 *  assigning it the lowest free bus address. The device is not contacted; once the hub port has been reset
+				 *  the device should be moved to its assigned address via \ref USB_Host_AddressDevice().
+				 *
+				 *  \note This function is only available when the \c HOST_MAX_DEVICES compile time token is defined.
+				 *
+				 *  \param[in] ParentAddress  Bus address of the hub the device is attached to.
+				 *  \param[in] ParentPort     Hub port number the device is attached to.
+				 *  \param[in] IsFullSpeed    Indicates if the device is operating at Full Speed rather than Low Speed.
+				 *
+				 *  \return Pointer to the allocated device table entry, or \c NULL if the device table is full.
+				 */
+				USB_Host_Device_t* USB_Host_AllocateDevice(const uint8_t ParentAddress,
+				                                           const uint8_t ParentPort,
+				                                           const bool IsFullSpeed);
+
+				/** Releases the host device table entry of a detached device, along with the entries of any devices attached
+				 *  downstream of it if the device is a hub. Any pipes bound to the released devices are frozen and disabled,
+				 *  and the default address is selected if the current device is released.
+				 *
+				 *  \note This function is only available when the \c HOST_MAX_DEVICES compile time token is defined.
+				 *
+				 *  \param[in] Address  Bus address of the device to release.
+				 */
+				void USB_Host_FreeDevice(const uint8_t Address);
+
+				/** Selects the given attached device as the target of subsequent control requests, and the device which
+				 *  pipes configured afterwards via \ref Pipe_ConfigurePipe() will be bound to. The \ref USB_Host_ControlPipeSize
+				 *  and \ref USB_Host_ConfigurationNumber globals are switched to those of the newly selected device.
+				 *
+				 *  Pipes configured while a device is selected remain bound to that device, and are automatically directed
+				 *  to it when selected regardless of the currently selected device. Non-control pipes must be kept frozen
+				 *  while not in use, as is done by all the library class drivers.
+				 *
+				 *  \note This function is only available when the \c HOST_MAX_DEVICES compile time token is defined.
+				 *
+				 *  \param[in] Address  Bus address of the device to select, or zero to select the default address.
+				 */
+				void USB_Host_SelectDevice(const uint8_t Address);
+
+				/** Moves a newly attached device from the default address to the bus address of the given device table
+				 *  entry, after the port the device is attached to has been reset. The size of the device's default control
+				 *  endpoint is read into the table entry, and the device is selected via \ref USB_Host_SelectDevice() once
+				 *  it has been addressed.
+				 *
+				 *  \note This function is only available when the \c HOST_MAX_DEVICES compile time token is defined.
+				 *
+				 *  \param[in,out] Device  Pointer to the device table entry previously allocated for the new device.
+				 *
+				 *  \return A value from the \ref USB_Host_SendControlErrorCodes_t enum.
+				 */
+				uint8_t USB_Host_AddressDevice(USB_Host_Device_t* const Device) ATTR_NON_NULL_PTR_ARG(1);
+			#endif
+
+		/* Inline Functions: */
+			#if defined(HOST_MAX_DEVICES) || defined(__DOXYGEN__)
+				/** Retrieves the host device table entry of the attached device with the given bus address.
+				 *
+				 *  \note This function is only available when the \c HOST_MAX_DEVICES compile time token is defined.
+				 *
+				 *  \param[in] Address  Bus address of the device to retrieve.
+				 *
+				 *  \return Pointer to the device's table entry, or \c NULL if no device is attached at the given address.
+				 */
+				static inline USB_Host_Device_t* USB_Host_GetDevice(const uint8_t Address) ATTR_WARN_UNUSED_RESULT ATTR_ALWAYS_INLINE;
+				static inline USB_Host_Device_t* USB_Host_GetDevice(const uint8_t Address)
+				{
+					if (!(Address) || (Address > HOST_MAX_DEVICES))
+					  return NULL;
+
+					USB_Host_Device_t* Device = &USB_Host_Devices[Address - 1];
+
+					return (Device->Address) ? Device : NULL;
+				}
+			#endif
+
 	/* Architecture Includes: */
 		#if (ARCH == ARCH_AVR8)
 			#include "AVR8/Host_AVR8.h"
@@ -128,6 +287,56 @@
 			#include "UC3/Host_UC3.h"
 		#endif
 
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Macros: */
+			#if defined(HOST_FAST_ENUMERATION)
+				#define HOST_CONNECT_DEBOUNCE_MS        100
+				#define HOST_RESET_RECOVERY_MS          10
+				#define HOST_SET_ADDRESS_RECOVERY_MS    2
+
+				#if !defined(HOST_ENUMERATION_RETRIES)
+					#define HOST_ENUMERATION_RETRIES    3
+				#endif
+			#else
+				#define HOST_CONNECT_DEBOUNCE_MS        100
+				#define HOST_RESET_RECOVERY_MS          200
+				#define HOST_SET_ADDRESS_RECOVERY_MS    100
+
+				#if !defined(HOST_ENUMERATION_RETRIES)
+					#define HOST_ENUMERATION_RETRIES    0
+				#endif
+			#endif
+
+			#define HOST_FRAME_NUMBER_MASK              0x07FF
+
+			#if defined(HOST_MAX_DEVICES)
+				#define HOST_CONTROLPIPE_BANK_SIZE      PIPE_CONTROLPIPE_DEFAULT_SIZE
+			#else
+				#define HOST_CONTROLPIPE_BANK_SIZE      USB_Host_ControlPipeSize
+			#endif
+
+			#if defined(HOST_ENUMERATION_TIMING)
+				#define HOST_ENUMERATION_TIMING_START()      USB_Host_StartEnumerationTiming()
+				#define HOST_ENUMERATION_TIMING_PHASE(Phase) USB_Host_EndEnumerationPhase(&USB_Host_EnumerationTiming.Phase)
+				#define HOST_ENUMERATION_TIMING_END()        USB_Host_EndEnumerationPhase(NULL)
+				#define HOST_ENUMERATION_TIMING_PAUSE()      USB_Host_UpdateEnumerationClock()
+				#define HOST_ENUMERATION_TIMING_RESUME()     USB_Host_ResyncEnumerationClock()
+			#else
+				#define HOST_ENUMERATION_TIMING_START()
+				#define HOST_ENUMERATION_TIMING_PHASE(Phase)
+				#define HOST_ENUMERATION_TIMING_END()
+				#define HOST_ENUMERATION_TIMING_PAUSE()
+				#define HOST_ENUMERATION_TIMING_RESUME()
+			#endif
+
+		/* Function Prototypes: */
+			#if defined(HOST_MAX_DEVICES)
+				void USB_Host_ClearDevices(void);
+				void USB_Host_AttachRootDevice(void);
+			#endif
+	#endif
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
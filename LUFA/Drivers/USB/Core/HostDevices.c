@@ -0,0 +1,180 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+#define  __INCLUDE_FROM_USB_DRIVER
+#include "USBMode.h"
+
+#if defined(USB_CAN_BE_HOST) && defined(HOST_MAX_DEVICES)
+
+#include "USBTask.h"
+
+USB_Host_Device_t USB_Host_Devices[HOST_MAX_DEVICES];
+uint8_t           USB_Host_DeviceAddress;
+
+void USB_Host_ClearDevices(void)
+{
+	memset(USB_Host_Devices, 0x00, sizeof(USB_Host_Devices));
+
+	USB_Host_DeviceAddress = 0;
+	Pipe_BindToDevice(PIPE_CONTROLPIPE, 0);
+}
+
+void USB_Host_AttachRootDevice(void)
+{
+	USB_Host_Device_t* RootDevice = &USB_Host_Devices[USB_HOST_DEVICEADDRESS - 1];
+
+	RootDevice->Address             = USB_HOST_DEVICEADDRESS;
+	RootDevice->ParentAddress       = 0;
+	RootDevice->ParentPort          = 0;
+	RootDevice->IsFullSpeed         = USB_Host_IsDeviceFullSpeed();
+	RootDevice->ControlPipeSize     = USB_Host_ControlPipeSize;
+	RootDevice->ConfigurationNumber = 0;
+
+	USB_Host_SelectDevice(USB_HOST_DEVICEADDRESS);
+}
+
+USB_Host_Device_t* USB_Host_AllocateDevice(const uint8_t ParentAddress,
+                                           const uint8_t ParentPort,
+                                           const bool IsFullSpeed)
+{
+	for (uint8_t DeviceIndex = 0; DeviceIndex < HOST_MAX_DEVICES; DeviceIndex++)
+	{
+		USB_Host_Device_t* Device = &USB_Host_Devices[DeviceIndex];
+
+		if (Device->Address)
+		  continue;
+
+		Device->Address             = (DeviceIndex + 1);
+		Device->ParentAddress       = ParentAddress;
+		Device->ParentPort          = ParentPort;
+		Device->IsFullSpeed         = IsFullSpeed;
+		Device->ControlPipeSize     = PIPE_CONTROLPIPE_DEFAULT_SIZE;
+		Device->ConfigurationNumber = 0;
+
+		return Device;
+	}
+
+	return NULL;
+}
+
+void USB_Host_FreeDevice(const uint8_t Address)
+{
+	USB_Host_Device_t* Device = USB_Host_GetDevice(Address);
+
+	if (Device == NULL)
+	  return;
+
+	if (Address == USB_Host_DeviceAddress)
+	  USB_Host_SelectDevice(0);
+
+	Device->Address = 0;
+	Pipe_ReleaseDevicePipes(Address);
+
+	for (uint8_t DeviceIndex = 0; DeviceIndex < HOST_MAX_DEVICES; DeviceIndex++)
+	{
+		USB_Host_Device_t* ChildDevice = &USB_Host_Devices[DeviceIndex];
+
+		if (ChildDevice->Address && (ChildDevice->ParentAddress == Address))
+		  USB_Host_FreeDevice(ChildDevice->Address);
+	}
+}
+
+void USB_Host_SelectDevice(const uint8_t Address)
+{
+	if (Address == USB_Host_DeviceAddress)
+	  return;
+
+	USB_Host_Device_t* Device = USB_Host_GetDevice(USB_Host_DeviceAddress);
+
+	if (Device != NULL)
+	{
+		Device->ControlPipeSize     = USB_Host_ControlPipeSize;
+		Device->ConfigurationNumber = USB_Host_ConfigurationNumber;
+	}
+
+	if ((Device = USB_Host_GetDevice(Address)) != NULL)
+	{
+		USB_Host_ControlPipeSize     = Device->ControlPipeSize;
+		USB_Host_ConfigurationNumber = Device->ConfigurationNumber;
+	}
+	else
+	{
+		USB_Host_ControlPipeSize     = PIPE_CONTROLPIPE_DEFAULT_SIZE;
+		USB_Host_ConfigurationNumber = 0;
+	}
+
+	USB_Host_DeviceAddress = Address;
+	Pipe_BindToDevice(PIPE_CONTROLPIPE, Address);
+}
+
+uint8_t USB_Host_AddressDevice(USB_Host_Device_t* const Device)
+{
+	uint8_t ErrorCode;
+	uint8_t DataBuffer[8];
+
+	USB_Host_SelectDevice(0);
+
+	USB_ControlRequest = (USB_Request_Header_t)
+		{
+			.bmRequestType = (REQDIR_DEVICETOHOST | REQTYPE_STANDARD | REQREC_DEVICE),
+			.bRequest      = REQ_GetDescriptor,
+			.wValue        = (DTYPE_Device << 8),
+			.wIndex        = 0,
+			.wLength       = sizeof(DataBuffer),
+		};
+
+	Pipe_SelectPipe(PIPE_CONTROLPIPE);
+
+	if ((ErrorCode = USB_Host_SendControlRequest(DataBuffer)) != HOST_SENDCONTROL_Successful)
+	  return ErrorCode;
+
+	Device->ControlPipeSize = DataBuffer[offsetof(USB_Descriptor_Device_t, Endpoint0Size)];
+
+	USB_ControlRequest = (USB_Request_Header_t)
+		{
+			.bmRequestType = (REQDIR_HOSTTODEVICE | REQTYPE_STANDARD | REQREC_DEVICE),
+			.bRequest      = REQ_SetAddress,
+			.wValue        = Device->Address,
+			.wIndex        = 0,
+			.wLength       = 0,
+		};
+
+	if ((ErrorCode = USB_Host_SendControlRequest(NULL)) != HOST_SENDCONTROL_Successful)
+	  return ErrorCode;
+
+	if ((ErrorCode = USB_Host_WaitMS(HOST_SET_ADDRESS_RECOVERY_MS)) != HOST_WAITERROR_Successful)
+	  return ErrorCode;
+
+	USB_Host_SelectDevice(Device->Address);
+
+	return HOST_SENDCONTROL_Successful;
+}
+
+#endif
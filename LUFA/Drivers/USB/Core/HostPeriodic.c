@@ -0,0 +1,253 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+#define  __INCLUDE_FROM_USB_DRIVER
+#include "USBMode.h"
+
+#if defined(USB_CAN_BE_HOST)
+
+#include "USBTask.h"
+
+#define  __INCLUDE_FROM_HOSTPERIODIC_C
+#include "HostPeriodic.h"
+
+static USB_Host_PeriodicPipe_t* USB_Host_PeriodicPipes;
+
+bool USB_Host_AddPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe)
+{
+	if (!(PeriodicPipe->Config.QueueBuffer) || !(PeriodicPipe->Config.QueueDepth) || !(PeriodicPipe->Config.ReportSize))
+	  return false;
+
+	USB_Host_RemovePeriodicPipe(PeriodicPipe);
+
+	Pipe_SelectPipe(PeriodicPipe->Config.PipeAddress);
+	Pipe_Freeze();
+	Pipe_SetInterruptPeriod(PeriodicPipe->Config.IntervalMS);
+
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	memset(&PeriodicPipe->State, 0x00, sizeof(PeriodicPipe->State));
+	PeriodicPipe->State.FramesRemaining = 1;
+	PeriodicPipe->State.Next            = USB_Host_PeriodicPipes;
+	USB_Host_PeriodicPipes              = PeriodicPipe;
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	return true;
+}
+
+void USB_Host_RemovePeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	USB_Host_PeriodicPipe_t** Link = &USB_Host_PeriodicPipes;
+
+	while (*Link != NULL)
+	{
+		if (*Link == PeriodicPipe)
+		{
+			*Link = PeriodicPipe->State.Next;
+			break;
+		}
+
+		Link = &(*Link)->State.Next;
+	}
+
+	if (PeriodicPipe->State.IsArmed)
+	{
+		uint8_t PrevPipeNumber = Pipe_GetCurrentPipe();
+
+		USB_Host_SelectPeriodicPipe(PeriodicPipe->Config.PipeAddress);
+		Pipe_Freeze();
+		USB_Host_SelectPeriodicPipe(PrevPipeNumber);
+
+		PeriodicPipe->State.IsArmed = false;
+	}
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+void USB_Host_ClearPeriodicPipes(void)
+{
+	USB_Host_PeriodicPipes = NULL;
+}
+
+void USB_Host_ProcessPeriodicPipes(void)
+{
+	if (USB_HostState != HOST_STATE_Configured)
+	  return;
+
+	uint8_t PrevPipeNumber = Pipe_GetCurrentPipe();
+
+	for (USB_Host_PeriodicPipe_t* PeriodicPipe = USB_Host_PeriodicPipes; PeriodicPipe != NULL;
+	     PeriodicPipe = PeriodicPipe->State.Next)
+	{
+		if (PeriodicPipe->State.IsArmed)
+		  USB_Host_CollectPeriodicPipe(PeriodicPipe, false);
+
+		if (--PeriodicPipe->State.FramesRemaining)
+		  continue;
+
+		PeriodicPipe->State.FramesRemaining = (PeriodicPipe->Config.IntervalMS ? PeriodicPipe->Config.IntervalMS : 1);
+
+		/* A transaction still outstanding after a full polling interval is abandoned before the pipe is re-armed */
+		if (PeriodicPipe->State.IsArmed)
+		  USB_Host_CollectPeriodicPipe(PeriodicPipe, true);
+
+		if (PeriodicPipe->State.ReportsQueued >= PeriodicPipe->Config.QueueDepth)
+		  continue;
+
+		#if defined(HOST_MAX_DEVICES)
+		/* Tokens are always sent to the loaded device address, so pipes of other devices must wait for a frame in
+		 * which the main program has their device addressed */
+		if (USB_Pipe_DeviceAddress[PeriodicPipe->Config.PipeAddress & PIPE_PIPENUM_MASK] != USB_Host_GetDeviceAddress())
+		{
+			PeriodicPipe->State.FramesRemaining = 1;
+			continue;
+		}
+		#endif
+
+		USB_Host_ArmPeriodicPipe(PeriodicPipe);
+	}
+
+	USB_Host_SelectPeriodicPipe(PrevPipeNumber);
+}
+
+uint8_t USB_Host_ReadPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe,
+                                  void* const Buffer,
+                                  const uint8_t BufferSize)
+{
+	if (!(PeriodicPipe->State.ReportsQueued))
+	  return 0;
+
+	uint8_t* QueueSlot    = &PeriodicPipe->Config.QueueBuffer[PeriodicPipe->State.Tail * (PeriodicPipe->Config.ReportSize + 1)];
+	uint8_t  ReportLength = QueueSlot[0];
+
+	if (ReportLength > BufferSize)
+	  ReportLength = BufferSize;
+
+	memcpy(Buffer, &QueueSlot[1], ReportLength);
+
+	if (++PeriodicPipe->State.Tail == PeriodicPipe->Config.QueueDepth)
+	  PeriodicPipe->State.Tail = 0;
+
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	PeriodicPipe->State.ReportsQueued--;
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	return ReportLength;
+}
+
+static void USB_Host_SelectPeriodicPipe(const uint8_t PipeAddress)
+{
+	#if defined(HOST_MAX_DEVICES)
+	/* Selecting a pipe also loads its device address, which must be left unchanged for the pipe in use by the main program */
+	uint8_t PrevDeviceAddress = USB_Host_GetDeviceAddress();
+
+	Pipe_SelectPipe(PipeAddress);
+	USB_Host_SetDeviceAddress(PrevDeviceAddress);
+	#else
+	Pipe_SelectPipe(PipeAddress);
+	#endif
+}
+
+static void USB_Host_ArmPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe)
+{
+	USB_Host_SelectPeriodicPipe(PeriodicPipe->Config.PipeAddress);
+
+	if (!(Pipe_IsConfigured()))
+	  return;
+
+	Pipe_ClearNAKReceived();
+	Pipe_Unfreeze();
+
+	PeriodicPipe->State.IsArmed = true;
+}
+
+static void USB_Host_CollectPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe,
+                                         const bool Timeout)
+{
+	USB_Host_SelectPeriodicPipe(PeriodicPipe->Config.PipeAddress);
+
+	bool ReportReceived = Pipe_IsINReceived();
+
+	if (!(ReportReceived) && !(Timeout) && !(Pipe_IsNAKReceived() || Pipe_IsStalled() || Pipe_IsError()))
+	  return;
+
+	Pipe_Freeze();
+	Pipe_ClearNAKReceived();
+
+	if (Pipe_IsError())
+	  Pipe_ClearError();
+
+	if (ReportReceived)
+	{
+		#if defined(HOST_MAX_DEVICES)
+		/* A report is only valid if the pipe's device was still addressed when the transaction was made */
+		if (USB_Pipe_DeviceAddress[PeriodicPipe->Config.PipeAddress & PIPE_PIPENUM_MASK] == USB_Host_GetDeviceAddress())
+		  USB_Host_QueuePeriodicReport(PeriodicPipe);
+		#else
+		USB_Host_QueuePeriodicReport(PeriodicPipe);
+		#endif
+
+		Pipe_ClearIN();
+	}
+
+	PeriodicPipe->State.IsArmed = false;
+}
+
+static void USB_Host_QueuePeriodicReport(USB_Host_PeriodicPipe_t* const PeriodicPipe)
+{
+	uint16_t ReportLength = Pipe_BytesInPipe();
+
+	if (ReportLength > PeriodicPipe->Config.ReportSize)
+	  ReportLength = PeriodicPipe->Config.ReportSize;
+
+	if (ReportLength)
+	{
+		uint8_t* QueueSlot = &PeriodicPipe->Config.QueueBuffer[PeriodicPipe->State.Head * (PeriodicPipe->Config.ReportSize + 1)];
+
+		QueueSlot[0] = ReportLength;
+		Pipe_Read_Stream_LE(&QueueSlot[1], ReportLength, NULL);
+
+		if (++PeriodicPipe->State.Head == PeriodicPipe->Config.QueueDepth)
+		  PeriodicPipe->State.Head = 0;
+
+		PeriodicPipe->State.ReportsQueued++;
+	}
+}
+
+#endif
+
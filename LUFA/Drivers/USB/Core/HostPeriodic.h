@@ -0,0 +1,206 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *  \brief USB host periodic pipe scheduling.
+ *  \copydetails Group_PipePeriodic
+ *
+ *  \note This file should not be included directly. It is automatically included as needed by the USB driver
+ *        dispatch header located in LUFA/Drivers/USB/USB.h.
+ */
+
+/** \ingroup Group_PipeManagement
+ *  \defgroup Group_PipePeriodic Periodic Pipe Scheduling
+ *  \brief Start of Frame driven polling of IN pipes into per-pipe report queues.
+ *
+ *  Module for the scheduled polling of INTERRUPT (and optionally BULK) IN pipes while in host mode. Each scheduled
+ *  pipe is armed for a single transaction once every polling interval, timed from the bus Start of Frame, and the
+ *  result of the transaction is collected from a later Start of Frame event, so that the scheduler never waits on the
+ *  bus from within the interrupt. Each received packet is stored into a queue owned by the pipe, and the pipe is frozen
+ *  again once its transaction has completed or been NAKed. The application and class drivers then read reports from the
+ *  queue at their leisure, rather than repeatedly unfreezing and polling the pipe, so that no bus transactions are
+ *  wasted and report latency is independent of the main program loop.
+ *
+ *  The scheduler never alters the pipe selected by the main program, its freeze state or the loaded device address.
+ *  When the \c HOST_MAX_DEVICES token is defined the USB controller shares a single device address between all pipes,
+ *  so a scheduled pipe is only armed in frames where its device's address is the one currently loaded, and a report is
+ *  discarded if the main program has loaded a different address before it could be collected.
+ *
+ *  To use the scheduler, enable host Start of Frame events via \ref USB_Host_EnableSOFEvents() and call
+ *  \ref USB_Host_ProcessPeriodicPipes() from the \ref EVENT_USB_Host_StartOfFrame() event. Each pipe is then
+ *  added to the schedule via \ref USB_Host_AddPeriodicPipe() once it has been configured.
+ *
+ *  @{
+ */
+
+#ifndef __HOSTPERIODIC_H__
+#define __HOSTPERIODIC_H__
+
+	/* Includes: */
+		#include "../../../Common/Common.h"
+		#include "USBMode.h"
+
+	/* Enable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			extern "C" {
+		#endif
+
+	/* Preprocessor Checks: */
+		#if !defined(__INCLUDE_FROM_USB_DRIVER)
+			#error Do not include this file directly. Include LUFA/Drivers/USB/USB.h instead.
+		#endif
+
+	/* Public Interface - May be used in end-application: */
+		/* Macros: */
+			/** Computes the size in bytes of the queue buffer required by a periodic pipe, for the given number of queued
+			 *  reports of the given maximum size.
+			 *
+			 *  \param[in] Depth       Maximum number of reports held in the queue.
+			 *  \param[in] ReportSize  Maximum size of each report, in bytes.
+			 */
+			#define USB_HOST_PERIODIC_QUEUE_SIZE(Depth, ReportSize) ((Depth) * ((ReportSize) + 1))
+
+		/* Type Defines: */
+			/** \brief Host Periodic Pipe Configuration and State Structure.
+			 *
+			 *  Periodic pipe structure. An instance of this structure should be made within the user application for
+			 *  each pipe to be scheduled, and passed to each of the periodic pipe functions as the \c PeriodicPipe
+			 *  parameter.
+			 */
+			typedef struct USB_Host_PeriodicPipe
+			{
+				struct
+				{
+					uint8_t  PipeAddress; /**< Address of the configured IN pipe to poll. */
+					uint8_t  IntervalMS; /**< Polling interval of the pipe in milliseconds, normally the \c bInterval value of
+					                      *   the pipe's endpoint descriptor. A value of zero polls the pipe once per frame.
+					                      */
+					uint8_t* QueueBuffer; /**< Buffer used to hold queued reports, of at least \ref USB_HOST_PERIODIC_QUEUE_SIZE()
+					                       *   bytes for the queue's \c QueueDepth and \c ReportSize values.
+					                       */
+					uint8_t  QueueDepth; /**< Maximum number of reports held in the queue. */
+					uint8_t  ReportSize; /**< Maximum size of each queued report, in bytes. Longer packets are truncated. */
+				} Config; /**< Config data for the periodic pipe. All elements in this section <b>must</b> be set before the
+				           *   pipe is added to the schedule.
+				           */
+				struct
+				{
+					struct USB_Host_PeriodicPipe* Next; /**< Next pipe in the schedule. */
+
+					uint8_t          FramesRemaining; /**< Number of frames until the pipe is next armed. */
+					bool             IsArmed; /**< Indicates if the pipe has been armed for a transaction whose result has
+					                           *   not yet been collected.
+					                           */
+					uint8_t          Head; /**< Index of the queue slot the next received report is stored into. */
+					uint8_t          Tail; /**< Index of the queue slot the next report is read from. */
+					volatile uint8_t ReportsQueued; /**< Number of reports currently held in the queue. */
+				} State; /**< State data for the periodic pipe. All elements in this section are reset to their defaults when
+				          *   the pipe is added to the schedule, and should not be altered by the user application.
+				          */
+			} USB_Host_PeriodicPipe_t;
+
+		/* Function Prototypes: */
+			/** Adds the given pipe to the periodic schedule, resetting its report queue. The pipe must already have been
+			 *  configured via \ref Pipe_ConfigurePipe() or \ref Pipe_ConfigurePipeTable(). A pipe which is already scheduled
+			 *  is restarted.
+			 *
+			 *  \param[in,out] PeriodicPipe  Pointer to a structure containing the periodic pipe's configuration and state.
+			 *
+			 *  \return Boolean \c true if the pipe was added to the schedule, \c false if the queue configuration is invalid.
+			 */
+			bool USB_Host_AddPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Removes the given pipe from the periodic schedule. Reports already in the pipe's queue remain available to
+			 *  be read.
+			 *
+			 *  \param[in,out] PeriodicPipe  Pointer to a structure containing the periodic pipe's configuration and state.
+			 */
+			void USB_Host_RemovePeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe) ATTR_NON_NULL_PTR_ARG(1);
+
+			/** Removes all pipes from the periodic schedule. This is called automatically by the library each time a new
+			 *  device is attached.
+			 */
+			void USB_Host_ClearPeriodicPipes(void);
+
+			/** Services the periodic schedule, collecting the result of each pipe armed in a previous frame into the pipe's
+			 *  queue, and arming each pipe whose polling interval has elapsed for a single transaction. This does not wait on
+			 *  the bus, and should be called from the \ref EVENT_USB_Host_StartOfFrame() event once per frame. Pipes whose
+			 *  queue is full are not armed until a report has been read.
+			 */
+			void USB_Host_ProcessPeriodicPipes(void);
+
+			/** Reads the oldest report from the given periodic pipe's queue. Reports longer than the given buffer are
+			 *  truncated to the buffer's size, and the remainder of the report discarded.
+			 *
+			 *  \param[in,out] PeriodicPipe  Pointer to a structure containing the periodic pipe's configuration and state.
+			 *  \param[out]    Buffer        Buffer where the report should be stored.
+			 *  \param[in]     BufferSize    Size of the destination buffer, in bytes.
+			 *
+			 *  \return Number of bytes stored into the buffer, or zero if the queue is empty.
+			 */
+			uint8_t USB_Host_ReadPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe,
+			                                  void* const Buffer,
+			                                  const uint8_t BufferSize) ATTR_NON_NULL_PTR_ARG(1) ATTR_NON_NULL_PTR_ARG(2);
+
+		/* Inline Functions: */
+			/** Retrieves the number of reports waiting in the given periodic pipe's queue.
+			 *
+			 *  \param[in] PeriodicPipe  Pointer to a structure containing the periodic pipe's configuration and state.
+			 *
+			 *  \return Number of reports waiting to be read from the queue.
+			 */
+			static inline uint8_t USB_Host_PeriodicPipeReportsQueued(const USB_Host_PeriodicPipe_t* const PeriodicPipe)
+			                                                         ATTR_ALWAYS_INLINE ATTR_NON_NULL_PTR_ARG(1);
+			static inline uint8_t USB_Host_PeriodicPipeReportsQueued(const USB_Host_PeriodicPipe_t* const PeriodicPipe)
+			{
+				return PeriodicPipe->State.ReportsQueued;
+			}
+
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Function Prototypes: */
+			#if defined(__INCLUDE_FROM_HOSTPERIODIC_C)
+				static void USB_Host_SelectPeriodicPipe(const uint8_t PipeAddress);
+				static void USB_Host_ArmPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe) ATTR_NON_NULL_PTR_ARG(1);
+				static void USB_Host_CollectPeriodicPipe(USB_Host_PeriodicPipe_t* const PeriodicPipe,
+				                                         const bool Timeout) ATTR_NON_NULL_PTR_ARG(1);
+				static void USB_Host_QueuePeriodicReport(USB_Host_PeriodicPipe_t* const PeriodicPipe) ATTR_NON_NULL_PTR_ARG(1);
+			#endif
+	#endif
+
+	/* Disable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			}
+		#endif
+
+#endif
+
+/** @} */
+
@@ -45,6 +45,10 @@ uint8_t USB_Device_ControlEndpointSize = ENDPOINT_CONTROLEP_DEFAULT_SIZE;
 volatile uint32_t USB_Endpoint_SelectedEndpoint = ENDPOINT_CONTROLEP;
 volatile uint8_t* USB_Endpoint_FIFOPos[ENDPOINT_TOTAL_ENDPOINTS];
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+static Endpoint_CompletionEntry_t USB_Endpoint_CompletionHandlers[ENDPOINT_TOTAL_ENDPOINTS];
+#endif
+
 bool Endpoint_ConfigureEndpointTable(const USB_Endpoint_Table_t* const Table,
                                      const uint8_t Entries)
 {
@@ -119,8 +123,86 @@ void Endpoint_ClearEndpoints(void)
 		USB_Endpoint_FIFOPos[EPNum]    = &AVR32_USBB_SLAVE[EPNum * 0x10000];
 		Endpoint_DisableEndpoint();
 	}
+
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	memset(USB_Endpoint_CompletionHandlers, 0x00, sizeof(USB_Endpoint_CompletionHandlers));
+	#endif
 }
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+bool Endpoint_SetCompletionHandler(const uint8_t Address,
+                                   const Endpoint_CompletionHandler_t Handler,
+                                   void* const Context)
+{
+	uint8_t EPNum = (Address & ENDPOINT_EPNUM_MASK);
+
+	if ((EPNum == ENDPOINT_CONTROLEP) || (EPNum >= ENDPOINT_TOTAL_ENDPOINTS))
+	  return false;
+
+	Endpoint_DisableCompletionInterrupt(Address);
+
+	USB_Endpoint_CompletionHandlers[EPNum].Address = Address;
+	USB_Endpoint_CompletionHandlers[EPNum].Handler = Handler;
+	USB_Endpoint_CompletionHandlers[EPNum].Context = Context;
+
+	if (Handler != NULL)
+	  Endpoint_EnableCompletionInterrupt(Address);
+
+	return true;
+}
+
+void Endpoint_EnableCompletionInterrupt(const uint8_t Address)
+{
+	uint8_t EPNum = (Address & ENDPOINT_EPNUM_MASK);
+
+	if (Address & ENDPOINT_DIR_IN)
+	  (&AVR32_USBB.UECON0SET)[EPNum].txines = true;
+	else
+	  (&AVR32_USBB.UECON0SET)[EPNum].rxoutes = true;
+
+	AVR32_USBB.udinteset = (AVR32_USBB_UDINTESET_EP0INTES_MASK << EPNum);
+}
+
+void Endpoint_DisableCompletionInterrupt(const uint8_t Address)
+{
+	uint8_t EPNum = (Address & ENDPOINT_EPNUM_MASK);
+
+	(&AVR32_USBB.UECON0CLR)[EPNum].txinec  = true;
+	(&AVR32_USBB.UECON0CLR)[EPNum].rxoutec = true;
+}
+
+void Endpoint_ProcessCompletionInterrupts(void)
+{
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	for (uint8_t EPNum = (ENDPOINT_CONTROLEP + 1); EPNum < ENDPOINT_TOTAL_ENDPOINTS; EPNum++)
+	{
+		Endpoint_CompletionEntry_t* Entry = &USB_Endpoint_CompletionHandlers[EPNum];
+
+		if (Entry->Handler == NULL)
+		  continue;
+
+		if (Entry->Address & ENDPOINT_DIR_IN)
+		{
+			if (!((&AVR32_USBB.UECON0)[EPNum].txine && (&AVR32_USBB.UESTA0)[EPNum].txini))
+			  continue;
+		}
+		else
+		{
+			if (!((&AVR32_USBB.UECON0)[EPNum].rxoute && (&AVR32_USBB.UESTA0)[EPNum].rxouti))
+			  continue;
+		}
+
+		Endpoint_SelectEndpoint(Entry->Address);
+
+		if (!(Entry->Handler(Entry->Address, Entry->Context)))
+		  Endpoint_DisableCompletionInterrupt(Entry->Address);
+	}
+
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+}
+#endif
+
 void Endpoint_ClearStatusStage(void)
 {
 	if (USB_ControlRequest.bmRequestType & REQDIR_DEVICETOHOST)
@@ -40,6 +40,10 @@
 
 uint8_t USB_Host_ControlPipeSize = PIPE_CONTROLPIPE_DEFAULT_SIZE;
 
+#if defined(HOST_MAX_DEVICES)
+uint8_t USB_Pipe_DeviceAddress[PIPE_TOTAL_PIPES];
+#endif
+
 volatile uint32_t USB_Pipe_SelectedPipe = PIPE_CONTROLPIPE;
 volatile uint8_t* USB_Pipe_FIFOPos[PIPE_TOTAL_PIPES];
 
@@ -75,6 +79,10 @@ bool Pipe_ConfigurePipe(const uint8_t Address,
 	if (Type == EP_TYPE_CONTROL)
 	  Token = PIPE_TOKEN_SETUP;
 
+#if defined(HOST_MAX_DEVICES)
+	Pipe_BindToDevice(Number, USB_Host_DeviceAddress);
+#endif
+
 	USB_Pipe_FIFOPos[Number]     = &AVR32_USBB_SLAVE[Number * PIPE_HSB_ADDRESS_SPACE_SIZE];
 
 #if defined(ORDERED_EP_CONFIG)
@@ -156,6 +164,11 @@ bool Pipe_IsEndpointBound(const uint8_t EndpointAddress)
 		if (!(Pipe_IsConfigured()))
 		  continue;
 
+		#if defined(HOST_MAX_DEVICES)
+		if (USB_Pipe_DeviceAddress[PNum] != USB_Host_DeviceAddress)
+		  continue;
+		#endif
+
 		if (Pipe_GetBoundEndpointAddress() == EndpointAddress)
 		  return true;
 	}
@@ -164,6 +177,27 @@ bool Pipe_IsEndpointBound(const uint8_t EndpointAddress)
 	return false;
 }
 
+#if defined(HOST_MAX_DEVICES)
+void Pipe_ReleaseDevicePipes(const uint8_t DeviceAddress)
+{
+	uint8_t PrevPipeNumber = Pipe_GetCurrentPipe();
+
+	for (uint8_t PNum = (PIPE_CONTROLPIPE + 1); PNum < PIPE_TOTAL_PIPES; PNum++)
+	{
+		if (USB_Pipe_DeviceAddress[PNum] != DeviceAddress)
+		  continue;
+
+		Pipe_SelectPipe(PNum);
+		Pipe_Freeze();
+		Pipe_DisablePipe();
+
+		Pipe_BindToDevice(PNum, 0);
+	}
+
+	Pipe_SelectPipe(PrevPipeNumber);
+}
+#endif
+
 uint8_t Pipe_WaitUntilReady(void)
 {
 	#if (USB_STREAM_TIMEOUT_MS < 0xFF)
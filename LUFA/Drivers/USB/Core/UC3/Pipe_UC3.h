@@ -104,6 +104,10 @@
 		/* External Variables: */
 			extern volatile uint32_t USB_Pipe_SelectedPipe;
 			extern volatile uint8_t* USB_Pipe_FIFOPos[];
+
+			#if defined(HOST_MAX_DEVICES)
+				extern uint8_t USB_Pipe_DeviceAddress[];
+			#endif
 	#endif
 
 	/* Public Interface - May be used in end-application: */
@@ -909,8 +913,27 @@
 				return (MaskVal << AVR32_USBB_PSIZE_OFFSET);
 			}
 
+			#if defined(HOST_MAX_DEVICES)
+				static inline void Pipe_BindToDevice(const uint8_t Number,
+				                                     const uint8_t DeviceAddress) ATTR_ALWAYS_INLINE;
+				static inline void Pipe_BindToDevice(const uint8_t Number,
+				                                     const uint8_t DeviceAddress)
+				{
+					volatile uint32_t* AddressRegister = &(&AVR32_USBB.uhaddr1)[Number >> 2];
+					uint8_t            AddressShift    = ((Number & 0x03) << 3);
+
+					*AddressRegister = ((*AddressRegister & ~(0x7FUL << AddressShift)) | ((uint32_t)DeviceAddress << AddressShift));
+
+					USB_Pipe_DeviceAddress[Number] = DeviceAddress;
+				}
+			#endif
+
 		/* Function Prototypes: */
 			void Pipe_ClearPipes(void);
+
+			#if defined(HOST_MAX_DEVICES)
+				void Pipe_ReleaseDevicePipes(const uint8_t DeviceAddress);
+			#endif
 	#endif
 
 	/* Disable C linkage for C++ Compilers: */
@@ -129,6 +129,10 @@ ISR(USB_GEN_vect)
 
 		EVENT_USB_Device_Reset();
 	}
+
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	Endpoint_ProcessCompletionInterrupts();
+	#endif
 	#endif
 
 	#if defined(USB_CAN_BE_HOST)
@@ -0,0 +1,136 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+#define  __INCLUDE_FROM_USB_DRIVER
+#include "USBMode.h"
+
+#define  __INCLUDE_FROM_USBTRACE_C
+#include "USBTrace.h"
+
+#if defined(USB_TRACE_BUFFER_SIZE)
+
+static USB_TraceRecord_t USB_Trace_Buffer[USB_TRACE_BUFFER_SIZE];
+static uint8_t           USB_Trace_Head;
+static uint8_t           USB_Trace_Count;
+static uint16_t          USB_Trace_RecordsLost;
+static uint8_t           USB_Trace_IgnoredEndpoint;
+
+static void USB_Trace_Store(const uint16_t Timestamp,
+                            const uint8_t EventID,
+                            const uint8_t Endpoint,
+                            const uint16_t ByteCount)
+{
+	USB_TraceRecord_t* Record = &USB_Trace_Buffer[(USB_Trace_Head + USB_Trace_Count) & (USB_TRACE_BUFFER_SIZE - 1)];
+
+	Record->Timestamp = Timestamp;
+	Record->EventID   = EventID;
+	Record->Endpoint  = Endpoint;
+	Record->ByteCount = ByteCount;
+
+	USB_Trace_Count++;
+}
+
+void USB_Trace_Record(const uint8_t EventID,
+                      const uint8_t Endpoint,
+                      const uint16_t ByteCount)
+{
+	uint16_t Timestamp = USB_TRACE_TIMESTAMP();
+
+	if ((EventID >= USB_TRACE_EVENT_EndpointInterrupt) && USB_Trace_IgnoredEndpoint && (Endpoint == USB_Trace_IgnoredEndpoint))
+	  return;
+
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	/* Lost records must be reported before any newer record is stored, so that the gap is visible in the trace */
+	if (USB_Trace_RecordsLost && (USB_Trace_Count < (USB_TRACE_BUFFER_SIZE - 1)))
+	{
+		USB_Trace_Store(Timestamp, USB_TRACE_EVENT_Overflow, 0, USB_Trace_RecordsLost);
+		USB_Trace_RecordsLost = 0;
+	}
+
+	if (!(USB_Trace_RecordsLost) && (USB_Trace_Count < USB_TRACE_BUFFER_SIZE))
+	  USB_Trace_Store(Timestamp, EventID, Endpoint, ByteCount);
+	else if (USB_Trace_RecordsLost != 0xFFFF)
+	  USB_Trace_RecordsLost++;
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+uint8_t USB_Trace_Read(USB_TraceRecord_t* Records,
+                       const uint8_t MaxRecords)
+{
+	uint8_t RecordsRead = 0;
+
+	while (RecordsRead < MaxRecords)
+	{
+		uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+		GlobalInterruptDisable();
+
+		bool RecordAvailable = (USB_Trace_Count != 0);
+
+		if (RecordAvailable)
+		{
+			*(Records++) = USB_Trace_Buffer[USB_Trace_Head];
+
+			USB_Trace_Head = ((USB_Trace_Head + 1) & (USB_TRACE_BUFFER_SIZE - 1));
+			USB_Trace_Count--;
+		}
+
+		SetGlobalInterruptMask(CurrentGlobalInt);
+
+		if (!(RecordAvailable))
+		  break;
+
+		RecordsRead++;
+	}
+
+	return RecordsRead;
+}
+
+void USB_Trace_Clear(void)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	USB_Trace_Head        = 0;
+	USB_Trace_Count       = 0;
+	USB_Trace_RecordsLost = 0;
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+void USB_Trace_IgnoreEndpoint(const uint8_t Address)
+{
+	USB_Trace_IgnoredEndpoint = Address;
+}
+
+#endif
+
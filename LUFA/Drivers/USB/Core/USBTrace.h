@@ -0,0 +1,237 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *  \brief USB event trace ring.
+ *  \copydetails Group_USBTrace
+ *
+ *  \note This file should not be included directly. It is automatically included as needed by the USB driver
+ *        dispatch header located in LUFA/Drivers/USB/USB.h.
+ */
+
+/** \ingroup Group_USB
+ *  \defgroup Group_USBTrace USB Event Tracing
+ *  \brief Optional timestamped trace of USB controller events.
+ *
+ *  Module for the optional tracing of USB controller events into a RAM ring buffer, for the diagnosis of throughput
+ *  stalls and enumeration problems in the field. When enabled, the library records a compact binary record for each
+ *  bus event handled by the USB interrupt routines, each control request, each data endpoint completion interrupt,
+ *  and each stream start, bank transition, completion and error. Each record holds a 16-bit timestamp taken from a
+ *  free-running timer, so that the application can later drain the ring over any interface (such as a CDC or vendor
+ *  specific interface) for analysis on the host.
+ *
+ *  Tracing is enabled by defining the \c USB_TRACE_BUFFER_SIZE compile time token to the number of records held in
+ *  the ring, which must be a power of two no greater than 128. When the token is not defined, all trace points
+ *  compile away to nothing.
+ *
+ *  Timestamps are read via the \ref USB_TRACE_TIMESTAMP() macro, which by default reads the 16-bit Timer 1 count
+ *  register on the AVR8 architecture, the TCC0 count register on the XMEGA architecture, or the lower 16 bits of the
+ *  CPU cycle counter on the UC3 architecture. The application is responsible for starting the timer in free-running
+ *  mode at a known rate, or may define \c USB_TRACE_TIMESTAMP() itself to read an alternative time source.
+ *
+ *  As the timestamps are only 16 bits wide, the interval between two consecutive records can only be recovered if it is
+ *  shorter than one full period of the timestamp timer (524ms for the VirtualSerial demo's 125KHz timer); longer idle
+ *  periods appear in the trace as their length modulo the timer period.
+ *
+ *  When the ring is drained over a USB interface, the application should exclude that interface's data IN endpoint from
+ *  the trace via \ref USB_Trace_IgnoreEndpoint(), so that sending trace records does not itself generate new records.
+ *
+ *  The LUFA/Demos/Device/ClassDriver/VirtualSerial/TraceDecoder directory contains a host tool to convert a trace
+ *  dump into per-endpoint throughput figures and latency histograms.
+ *
+ *  \note The bus event, endpoint interrupt and stream trace points are currently only present in the AVR8
+ *        architecture's USB driver; control requests are traced on all architectures.
+ *
+ *  @{
+ */
+
+#ifndef __USBTRACE_H__
+#define __USBTRACE_H__
+
+	/* Includes: */
+		#include "../../../Common/Common.h"
+		#include "USBMode.h"
+
+	/* Enable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			extern "C" {
+		#endif
+
+	/* Preprocessor Checks: */
+		#if !defined(__INCLUDE_FROM_USB_DRIVER)
+			#error Do not include this file directly. Include LUFA/Drivers/USB/USB.h instead.
+		#endif
+
+		#if defined(USB_TRACE_BUFFER_SIZE)
+			#if ((USB_TRACE_BUFFER_SIZE < 2) || (USB_TRACE_BUFFER_SIZE > 128) || (USB_TRACE_BUFFER_SIZE & (USB_TRACE_BUFFER_SIZE - 1)))
+				#error USB_TRACE_BUFFER_SIZE must be a power of two between 2 and 128.
+			#endif
+		#endif
+
+	/* Public Interface - May be used in end-application: */
+		/* Macros: */
+			#if !defined(USB_TRACE_TIMESTAMP) || defined(__DOXYGEN__)
+				/** Reads the current 16-bit trace timestamp. This may be defined by the application (for example, in the
+				 *  project's \c LUFAConfig.h file) to read a time source other than the architecture default.
+				 */
+				#if (ARCH == ARCH_AVR8) || defined(__DOXYGEN__)
+					#define USB_TRACE_TIMESTAMP()           TCNT1
+				#elif (ARCH == ARCH_XMEGA)
+					#define USB_TRACE_TIMESTAMP()           TCC0.CNT
+				#elif (ARCH == ARCH_UC3)
+					#define USB_TRACE_TIMESTAMP()           ((uint16_t)__builtin_mfsr(AVR32_COUNT))
+				#endif
+			#endif
+
+			#if defined(USB_TRACE_BUFFER_SIZE) || defined(__DOXYGEN__)
+				/** Adds a new record to the trace ring. This compiles to nothing unless the \c USB_TRACE_BUFFER_SIZE compile
+				 *  time token is defined.
+				 *
+				 *  \param[in] EventID    Event being recorded, a value from the \ref USB_Trace_Events_t enum.
+				 *  \param[in] Endpoint   Endpoint or pipe address the event relates to, or an event specific value.
+				 *  \param[in] ByteCount  Number of bytes the event relates to, or an event specific value.
+				 */
+				#define USB_TRACE(EventID, Endpoint, ByteCount)  USB_Trace_Record(EventID, Endpoint, ByteCount)
+			#else
+				#define USB_TRACE(EventID, Endpoint, ByteCount)  do { } while (0)
+			#endif
+
+		/* Type Defines: */
+			/** \brief USB Trace Record.
+			 *
+			 *  Type define for a single record in the trace ring. Records are stored and drained in this packed six byte
+			 *  little endian format, which is the format expected by the host side trace decoder.
+			 */
+			typedef struct
+			{
+				uint16_t Timestamp; /**< Value of \ref USB_TRACE_TIMESTAMP() when the event occurred. */
+				uint8_t  EventID; /**< Event that occurred, a value from the \ref USB_Trace_Events_t enum. */
+				uint8_t  Endpoint; /**< Endpoint or pipe address the event relates to, or an event specific value. */
+				uint16_t ByteCount; /**< Number of bytes the event relates to, or an event specific value. */
+			} ATTR_PACKED USB_TraceRecord_t;
+
+		/* Enums: */
+			/** Enum for the events which may be recorded into the trace ring. The meaning of the \c Endpoint and \c ByteCount
+			 *  fields of each record are given for each event.
+			 */
+			enum USB_Trace_Events_t
+			{
+				USB_TRACE_EVENT_Overflow          = 0, /**< Records were lost due to a full ring; \c ByteCount holds the number
+				                                        *   of records lost.
+				                                        */
+				USB_TRACE_EVENT_Connect           = 1, /**< VBUS was applied to the device. */
+				USB_TRACE_EVENT_Disconnect        = 2, /**< VBUS was removed from the device. */
+				USB_TRACE_EVENT_Suspend           = 3, /**< The bus was suspended. */
+				USB_TRACE_EVENT_WakeUp            = 4, /**< The bus was woken from suspension. */
+				USB_TRACE_EVENT_Reset             = 5, /**< The host completed a bus reset. */
+				USB_TRACE_EVENT_DeviceAttached    = 6, /**< A device was attached while in host mode. */
+				USB_TRACE_EVENT_DeviceUnattached  = 7, /**< The attached device was removed while in host mode. */
+				USB_TRACE_EVENT_HostError         = 8, /**< A host mode VBUS or bus connection error occurred; \c ByteCount
+				                                        *   holds a value from the \ref USB_Host_ErrorCodes_t enum, or zero
+				                                        *   if no device was detected.
+				                                        */
+				USB_TRACE_EVENT_ControlRequest    = 9, /**< A control request was received; \c Endpoint holds the request's
+				                                        *   \c bRequest value and \c ByteCount its \c wLength value.
+				                                        */
+				USB_TRACE_EVENT_EndpointInterrupt = 10, /**< A data endpoint's completion interrupt fired; \c ByteCount
+				                                         *   holds the number of bytes in the endpoint's bank.
+				                                         */
+				USB_TRACE_EVENT_StreamStart       = 11, /**< A stream transfer was started; \c ByteCount holds the number
+				                                         *   of bytes requested.
+				                                         */
+				USB_TRACE_EVENT_BankComplete      = 12, /**< A stream transfer completed a bank; \c ByteCount holds the
+				                                         *   number of bytes transferred so far.
+				                                         */
+				USB_TRACE_EVENT_StreamComplete    = 13, /**< A stream transfer completed; \c ByteCount holds the number of
+				                                         *   bytes transferred.
+				                                         */
+				USB_TRACE_EVENT_StreamError       = 14, /**< A stream transfer was aborted; \c ByteCount holds the stream
+				                                         *   error code.
+				                                         */
+			};
+
+		/* Function Prototypes: */
+			#if defined(USB_TRACE_BUFFER_SIZE) || defined(__DOXYGEN__)
+				/** Adds a new record to the trace ring, timestamped with the current value of \ref USB_TRACE_TIMESTAMP().
+				 *  If the ring is full the record is discarded, and an \ref USB_TRACE_EVENT_Overflow record giving the
+				 *  number of records lost is added once space becomes available. This function is safe to call from both
+				 *  interrupt and non-interrupt contexts, although the \ref USB_TRACE() macro should normally be used instead.
+				 *
+				 *  \param[in] EventID    Event being recorded, a value from the \ref USB_Trace_Events_t enum.
+				 *  \param[in] Endpoint   Endpoint or pipe address the event relates to, or an event specific value.
+				 *  \param[in] ByteCount  Number of bytes the event relates to, or an event specific value.
+				 */
+				void USB_Trace_Record(const uint8_t EventID,
+				                      const uint8_t Endpoint,
+				                      const uint16_t ByteCount);
+
+				/** Removes the oldest records from the trace ring, up to the given maximum, so that they can be sent to
+				 *  the host.
+				 *
+				 *  \param[out] Records     Buffer where the removed records should be stored.
+				 *  \param[in]  MaxRecords  Maximum number of records to remove.
+				 *
+				 *  \return Number of records removed from the ring and stored into the buffer.
+				 */
+				uint8_t USB_Trace_Read(USB_TraceRecord_t* Records,
+				                       const uint8_t MaxRecords) ATTR_NON_NULL_PTR_ARG(1);
+
+				/** Discards all records in the trace ring, and resets the count of lost records. */
+				void USB_Trace_Clear(void);
+
+				/** Excludes the given endpoint or pipe from the trace, so that its interrupt and stream events are not
+				 *  recorded. This should be used for the endpoint the trace ring is drained through, as each transfer of
+				 *  trace records would otherwise add further stream records to the ring.
+				 *
+				 *  \param[in] Address  Address of the endpoint or pipe to exclude, or zero to trace all endpoints.
+				 */
+				void USB_Trace_IgnoreEndpoint(const uint8_t Address);
+			#endif
+
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Function Prototypes: */
+			#if defined(__INCLUDE_FROM_USBTRACE_C) && defined(USB_TRACE_BUFFER_SIZE)
+				static void USB_Trace_Store(const uint16_t Timestamp,
+				                            const uint8_t EventID,
+				                            const uint8_t Endpoint,
+				                            const uint16_t ByteCount);
+			#endif
+	#endif
+
+	/* Disable C linkage for C++ Compilers: */
+		#if defined(__cplusplus)
+			}
+		#endif
+
+#endif
+
+/** @} */
+
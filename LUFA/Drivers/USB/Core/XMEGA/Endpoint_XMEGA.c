@@ -48,6 +48,18 @@ volatile uint8_t          USB_Endpoint_SelectedEndpoint;
 volatile USB_EP_t*        USB_Endpoint_SelectedHandle;
 volatile Endpoint_FIFO_t* USB_Endpoint_SelectedFIFO;
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+static Endpoint_CompletionEntry_t USB_Endpoint_CompletionHandlers[ENDPOINT_TOTAL_ENDPOINTS];
+
+static inline bool Endpoint_IsBankReady(void)
+{
+	if (USB_Endpoint_SelectedEndpoint & ENDPOINT_DIR_IN)
+	  return ((USB_Endpoint_SelectedHandle->STATUS & USB_EP_BUSNACK0_bm) ? true : false);
+	else
+	  return ((USB_Endpoint_SelectedHandle->STATUS & USB_EP_TRNCOMPL0_bm) ? true : false);
+}
+#endif
+
 bool Endpoint_IsINReady(void)
 {
 	Endpoint_SelectEndpoint(USB_Endpoint_SelectedEndpoint | ENDPOINT_DIR_IN);
@@ -190,8 +202,95 @@ void Endpoint_ClearEndpoints(void)
 		((USB_EndpointTable_t*)USB.EPPTR)->Endpoints[EPNum].IN.CTRL  = 0;
 		((USB_EndpointTable_t*)USB.EPPTR)->Endpoints[EPNum].OUT.CTRL = 0;
 	}
+
+	#if defined(INTERRUPT_DATA_ENDPOINTS)
+	memset(USB_Endpoint_CompletionHandlers, 0x00, sizeof(USB_Endpoint_CompletionHandlers));
+	#endif
 }
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+bool Endpoint_SetCompletionHandler(const uint8_t Address,
+                                   const Endpoint_CompletionHandler_t Handler,
+                                   void* const Context)
+{
+	uint8_t EPNum = (Address & ENDPOINT_EPNUM_MASK);
+
+	if ((EPNum == ENDPOINT_CONTROLEP) || (EPNum >= ENDPOINT_TOTAL_ENDPOINTS))
+	  return false;
+
+	if (USB_Endpoint_CompletionHandlers[EPNum].Handler != NULL)
+	  Endpoint_DisableCompletionInterrupt(USB_Endpoint_CompletionHandlers[EPNum].Address);
+
+	USB_Endpoint_CompletionHandlers[EPNum].Address = Address;
+	USB_Endpoint_CompletionHandlers[EPNum].Handler = Handler;
+	USB_Endpoint_CompletionHandlers[EPNum].Context = Context;
+
+	if (Handler != NULL)
+	  Endpoint_EnableCompletionInterrupt(Address);
+
+	return true;
+}
+
+void Endpoint_EnableCompletionInterrupt(const uint8_t Address)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	Endpoint_SelectEndpoint(Address);
+	USB_Endpoint_SelectedHandle->CTRL &= ~USB_EP_INTDSBL_bm;
+	USB.INTCTRLB |= USB_TRNIE_bm;
+
+	if (Endpoint_IsBankReady())
+	  USB.INTFLAGSBSET = USB_TRNIF_bm;
+
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+void Endpoint_DisableCompletionInterrupt(const uint8_t Address)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	Endpoint_SelectEndpoint(Address);
+	USB_Endpoint_SelectedHandle->CTRL |= USB_EP_INTDSBL_bm;
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+}
+
+void Endpoint_ProcessCompletionInterrupts(void)
+{
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	for (uint8_t EPNum = (ENDPOINT_CONTROLEP + 1); EPNum < ENDPOINT_TOTAL_ENDPOINTS; EPNum++)
+	{
+		Endpoint_CompletionEntry_t* Entry = &USB_Endpoint_CompletionHandlers[EPNum];
+
+		if (Entry->Handler == NULL)
+		  continue;
+
+		Endpoint_SelectEndpoint(Entry->Address);
+
+		if ((USB_Endpoint_SelectedHandle->CTRL & USB_EP_INTDSBL_bm) || !(Endpoint_IsBankReady()))
+		  continue;
+
+		if (!(Entry->Handler(Entry->Address, Entry->Context)))
+		{
+			Endpoint_SelectEndpoint(Entry->Address);
+			USB_Endpoint_SelectedHandle->CTRL |= USB_EP_INTDSBL_bm;
+		}
+	}
+
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+}
+#endif
+
 void Endpoint_ClearStatusStage(void)
 {
 	if (USB_ControlRequest.bmRequestType & REQDIR_DEVICETOHOST)
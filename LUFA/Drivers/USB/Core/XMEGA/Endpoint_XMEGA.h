@@ -149,6 +149,10 @@
 			                                    const uint8_t Config,
 			                                    const uint8_t Size);
 			void Endpoint_ClearEndpoints(void);
+
+			#if defined(INTERRUPT_DATA_ENDPOINTS)
+				void Endpoint_ProcessCompletionInterrupts(void);
+			#endif
 	#endif
 
 	/* Public Interface - May be used in end-application: */
@@ -678,6 +682,56 @@
 			 */
 			uint8_t Endpoint_WaitUntilReady(void);
 
+			#if defined(INTERRUPT_DATA_ENDPOINTS) || defined(__DOXYGEN__)
+				/** Registers a completion handler against the given data endpoint, and enables the endpoint's
+				 *  interrupt so that the handler is run from the USB controller interrupt each time the endpoint's
+				 *  bank becomes ready. The handler should read or write the endpoint bank and clear it via
+				 *  \ref Endpoint_ClearOUT() or \ref Endpoint_ClearIN() before returning \c true. If the handler
+				 *  cannot service the bank immediately it should return \c false, which disables the endpoint's
+				 *  interrupt so that the work can be deferred to the main program loop; the interrupt must then be
+				 *  re-enabled via \ref Endpoint_EnableCompletionInterrupt() once the work is complete.
+				 *
+				 *  Reconfiguring an endpoint disables its interrupt, so handlers should be registered after the endpoint
+				 *  has been configured, each time the device configuration is changed.
+				 *
+				 *  \note On the XMEGA architecture, only one direction of each endpoint number may have a
+				 *        completion handler registered at any one time.
+				 *
+				 *  \note Only available when the \c INTERRUPT_DATA_ENDPOINTS token is defined.
+				 *
+				 *  \warning Once registered, the endpoint must only be accessed from within its handler, or with
+				 *           the endpoint's interrupt disabled.
+				 *
+				 *  \param[in] Address  Address of the data endpoint to register the handler against.
+				 *  \param[in] Handler  Completion handler to run, or \c NULL to unregister the current handler.
+				 *  \param[in] Context  Context pointer passed to the handler each time it is run.
+				 *
+				 *  \return Boolean \c true if the handler was registered, \c false if the endpoint address is invalid.
+				 */
+				bool Endpoint_SetCompletionHandler(const uint8_t Address,
+				                                   const Endpoint_CompletionHandler_t Handler,
+				                                   void* const Context);
+
+				/** Enables the interrupt of a data endpoint with a registered completion handler, so that the
+				 *  handler is run as soon as the endpoint's bank is ready. This should be called once deferred work
+				 *  for the endpoint has been completed in the main program loop.
+				 *
+				 *  \note Only available when the \c INTERRUPT_DATA_ENDPOINTS token is defined.
+				 *
+				 *  \param[in] Address  Address of the data endpoint whose interrupt is to be enabled.
+				 */
+				void Endpoint_EnableCompletionInterrupt(const uint8_t Address);
+
+				/** Disables the interrupt of a data endpoint with a registered completion handler, so that the
+				 *  endpoint may be safely accessed from the main program loop.
+				 *
+				 *  \note Only available when the \c INTERRUPT_DATA_ENDPOINTS token is defined.
+				 *
+				 *  \param[in] Address  Address of the data endpoint whose interrupt is to be disabled.
+				 */
+				void Endpoint_DisableCompletionInterrupt(const uint8_t Address);
+			#endif
+
 	/* Disable C linkage for C++ Compilers: */
 		#if defined(__cplusplus)
 			}
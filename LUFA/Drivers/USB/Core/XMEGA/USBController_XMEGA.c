@@ -146,6 +146,10 @@ void USB_ResetInterface(void)
 #if defined(USB_CAN_BE_DEVICE)
 static void USB_Init_Device(void)
 {
+	#if defined(USE_DESCRIPTOR_TABLE) && defined(JTAG_ASSERT)
+	JTAG_ASSERT(USB_Device_IsDescriptorTableValid());
+	#endif
+
 	USB_DeviceState                 = DEVICE_STATE_Unattached;
 	USB_Device_ConfigurationNumber  = 0;
 
@@ -103,4 +103,13 @@ ISR(USB_BUSEVENT_vect)
 	}
 }
 
+#if defined(INTERRUPT_DATA_ENDPOINTS)
+ISR(USB_TRNCOMPL_vect)
+{
+	USB.INTFLAGSBCLR = USB_TRNIF_bm;
+
+	Endpoint_ProcessCompletionInterrupts();
+}
+#endif
+
 #endif
@@ -46,8 +46,11 @@
  *    - LUFA/Drivers/USB/Core/ConfigDescriptors.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
  *    - LUFA/Drivers/USB/Core/DeviceStandardReq.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
  *    - LUFA/Drivers/USB/Core/Events.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
+ *    - LUFA/Drivers/USB/Core/HostDevices.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
+ *    - LUFA/Drivers/USB/Core/HostPeriodic.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
  *    - LUFA/Drivers/USB/Core/HostStandardReq.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
  *    - LUFA/Drivers/USB/Core/USBTask.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
+ *    - LUFA/Drivers/USB/Core/USBTrace.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
  *    - LUFA/Drivers/USB/Core/<i>ARCH</i>/Device_<i>ARCH</i>.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
  *    - LUFA/Drivers/USB/Core/<i>ARCH</i>/Endpoint_<i>ARCH</i>.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
  *    - LUFA/Drivers/USB/Core/<i>ARCH</i>/EndpointStream_<i>ARCH</i>.c <i>(Makefile source module name: LUFA_SRC_USB)</i>
@@ -116,6 +119,11 @@
  *   <td bgcolor="#00EE00">Yes</td>
  *  </tr>
  *  <tr>
+ *   <td>Hub</td>
+ *   <td bgcolor="#EE0000">No</td>
+ *   <td bgcolor="#00EE00">Yes</td>
+ *  </tr>
+ *  <tr>
  *   <td>MIDI</td>
  *   <td bgcolor="#00EE00">Yes</td>
  *   <td bgcolor="#00EE00">Yes</td>
@@ -389,12 +397,14 @@
 		#include "Core/ConfigDescriptors.h"
 		#include "Core/USBController.h"
 		#include "Core/USBInterrupt.h"
+		#include "Core/USBTrace.h"
 
 		#if defined(USB_CAN_BE_HOST) || defined(__DOXYGEN__)
 			#include "Core/Host.h"
 			#include "Core/Pipe.h"
 			#include "Core/HostStandardReq.h"
 			#include "Core/PipeStream.h"
+			#include "Core/HostPeriodic.h"
 		#endif
 
 		#if defined(USB_CAN_BE_DEVICE) || defined(__DOXYGEN__)
@@ -412,6 +422,7 @@
 		#include "Class/AudioClass.h"
 		#include "Class/CDCClass.h"
 		#include "Class/HIDClass.h"
+		#include "Class/HubClass.h"
 		#include "Class/MassStorageClass.h"
 		#include "Class/MIDIClass.h"
 		#include "Class/PrinterClass.h"
@@ -43,6 +43,14 @@
 #ifndef _APP_CONFIG_H_
 #define _APP_CONFIG_H_
 
-	#define MAX_SIMULTANEOUS_NOTES     3
+	#define MAX_SIMULTANEOUS_NOTES     8
+
+	#define AUDIO_SAMPLE_RATE          15625
+	#define VOICE_ACCUMULATOR_BITS     24
+
+	#define ENVELOPE_ATTACK_MS         10
+	#define ENVELOPE_DECAY_MS          250
+	#define ENVELOPE_SUSTAIN_LEVEL     160
+	#define ENVELOPE_RELEASE_MS        300
 
 #endif
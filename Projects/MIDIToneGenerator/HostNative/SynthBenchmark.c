@@ -0,0 +1,173 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Main source file for the host-native benchmark of the MIDIToneGenerator project's voice engine. This renders a
+ *  fixed number of samples for each possible number of simultaneous voices, and reports the host time and cycles
+ *  taken per sample along with the output range, so that the cost of each additional voice and the mixer's headroom
+ *  scaling can be checked without hardware. Host cycle counts are only indicative of the relative cost per voice,
+ *  not of the AVR cycle count.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+#include "NativePlatform.h"
+#include "../Lib/VoiceEngine.h"
+
+/** Default number of samples to render for each voice count. */
+#define DEFAULT_BENCHMARK_SAMPLES  (AUDIO_SAMPLE_RATE * 64)
+
+/** MIDI pitch of the lowest note in the benchmark chord. */
+#define BENCHMARK_BASE_PITCH       48
+
+/** MIDI velocity of each note in the benchmark chord. */
+#define BENCHMARK_VELOCITY         100
+
+/** Number of voice control ticks rendered in each timed block of samples. The voice engine's control task and the
+ *  output range tracking are run between the timed blocks, so that only the sample rendering is measured.
+ */
+#define BENCHMARK_BLOCK_TICKS      4
+
+/** Number of samples rendered in each timed block. This must be less than 256, so that the voice engine's control task
+ *  does not fall behind its 8-bit sample tick counter.
+ */
+#define BENCHMARK_BLOCK_SAMPLES    (VOICE_CONTROL_TICK_SAMPLES * BENCHMARK_BLOCK_TICKS)
+
+/** Reads the host's cycle counter, if available.
+ *
+ *  \return Current cycle count, or zero if the host has no accessible cycle counter.
+ */
+static inline uint64_t ReadCycleCounter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/** Reads the host's monotonic clock.
+ *
+ *  \return Current time in nanoseconds.
+ */
+static inline uint64_t ReadNanoseconds(void)
+{
+	struct timespec CurrentTime;
+	clock_gettime(CLOCK_MONOTONIC, &CurrentTime);
+
+	return (((uint64_t)CurrentTime.tv_sec * 1000000000ULL) + CurrentTime.tv_nsec);
+}
+
+/** Main program entry point. The number of samples to render per voice count may be given as the first command line
+ *  argument.
+ */
+int main(int argc,
+         char* argv[])
+{
+	uint32_t TotalSamples = (argc > 1) ? strtoul(argv[1], NULL, 0) : DEFAULT_BENCHMARK_SAMPLES;
+
+	if (!(TotalSamples))
+	  return EXIT_FAILURE;
+
+	printf("%u voices max, %u-bit accumulators, %u Hz, mix budget %lu, %lu samples per run\n\n",
+	       MAX_SIMULTANEOUS_NOTES, VOICE_ACCUMULATOR_BITS, AUDIO_SAMPLE_RATE, (unsigned long)VOICE_MIX_BUDGET,
+	       (unsigned long)TotalSamples);
+	printf("Voices  ns/sample  cycles/sample  cycles/voice  min  max\n");
+
+	uint64_t BaseCycles = 0;
+
+	for (uint8_t Voices = 0; Voices <= MAX_SIMULTANEOUS_NOTES; Voices++)
+	{
+		VoiceEngine_Init();
+
+		/* Start a chord of fourths, and let the envelopes settle at the sustain level before measuring */
+		for (uint8_t i = 0; i < Voices; i++)
+		  VoiceEngine_NoteOn(BENCHMARK_BASE_PITCH + (i * 5), BENCHMARK_VELOCITY);
+
+		for (uint32_t i = 0; i < (AUDIO_SAMPLE_RATE * 2); i++)
+		{
+			VoiceEngine_RenderSample();
+			VoiceEngine_Task();
+		}
+
+		uint8_t  MinSample     = UINT8_MAX;
+		uint8_t  MaxSample     = 0;
+		uint64_t ElapsedTime   = 0;
+		uint64_t ElapsedCycles = 0;
+
+		for (uint32_t SamplesRendered = 0; SamplesRendered < TotalSamples; SamplesRendered += BENCHMARK_BLOCK_SAMPLES)
+		{
+			uint8_t  BlockSamples[BENCHMARK_BLOCK_SAMPLES];
+			uint16_t BlockLength = BENCHMARK_BLOCK_SAMPLES;
+
+			if (BlockLength > (TotalSamples - SamplesRendered))
+			  BlockLength = (TotalSamples - SamplesRendered);
+
+			uint64_t StartTime   = ReadNanoseconds();
+			uint64_t StartCycles = ReadCycleCounter();
+
+			for (uint16_t i = 0; i < BlockLength; i++)
+			  BlockSamples[i] = VoiceEngine_RenderSample();
+
+			ElapsedCycles += (ReadCycleCounter() - StartCycles);
+			ElapsedTime   += (ReadNanoseconds() - StartTime);
+
+			for (uint16_t i = 0; i < BlockLength; i++)
+			{
+				if (BlockSamples[i] < MinSample)
+				  MinSample = BlockSamples[i];
+
+				if (BlockSamples[i] > MaxSample)
+				  MaxSample = BlockSamples[i];
+			}
+
+			/* Each call of the control task processes at most a single control tick */
+			for (uint8_t i = 0; i < BENCHMARK_BLOCK_TICKS; i++)
+			  VoiceEngine_Task();
+		}
+
+		double CyclesPerSample = ((double)ElapsedCycles / TotalSamples);
+
+		if (!(Voices))
+		  BaseCycles = ElapsedCycles;
+
+		printf("%6u  %9.2f  %13.2f  %12.2f  %3u  %3u\n", Voices, ((double)ElapsedTime / TotalSamples), CyclesPerSample,
+		       Voices ? ((((double)ElapsedCycles - (double)BaseCycles) / TotalSamples) / Voices) : 0.0, MinSample, MaxSample);
+	}
+
+	return EXIT_SUCCESS;
+}
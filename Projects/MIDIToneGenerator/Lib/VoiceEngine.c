@@ -0,0 +1,326 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Polyphonic DDS voice engine for the MIDI tone generator. Each voice is a sine oscillator driven by a 16 or 24-bit
+ *  phase accumulator, shaped by a per-voice ADSR envelope and the note's velocity. Only voices in the compact active
+ *  voice list are processed by the sample ISR, and the envelope and mix level processing is performed at a lower
+ *  control rate outside the ISR.
+ */
+
+#define  INCLUDE_FROM_VOICEENGINE_C
+#include "VoiceEngine.h"
+
+/** 8-bit signed 256 entry Sine Wave lookup table */
+const int8_t VoiceEngine_SineTable[256] PROGMEM =
+{
+	   0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+	  49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+	  90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+	 117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+	 127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+	 117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+	  90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+	  49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+	   0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+	 -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+	 -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+	-117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+	-127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+	-117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+	 -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+	 -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3,
+};
+
+/** Phase accumulator increments for the highest MIDI octave (pitches 120 to 131). Increments for lower octaves are
+ *  derived by halving these values once per octave.
+ */
+static const uint32_t TopOctaveIncrements[12] PROGMEM =
+{
+	VOICE_PHASE_INCREMENT(8372.02),  VOICE_PHASE_INCREMENT(8869.84),  VOICE_PHASE_INCREMENT(9397.27),
+	VOICE_PHASE_INCREMENT(9956.06),  VOICE_PHASE_INCREMENT(10548.08), VOICE_PHASE_INCREMENT(11175.30),
+	VOICE_PHASE_INCREMENT(11839.82), VOICE_PHASE_INCREMENT(12543.85), VOICE_PHASE_INCREMENT(13289.75),
+	VOICE_PHASE_INCREMENT(14080.00), VOICE_PHASE_INCREMENT(14917.24), VOICE_PHASE_INCREMENT(15804.27),
+};
+
+/** Storage for each synthesiser voice, active or idle. */
+static VoiceEngine_Voice_t Voices[MAX_SIMULTANEOUS_NOTES];
+
+/** Compact list of the voices currently generating sound, processed by \ref VoiceEngine_RenderSample(). */
+VoiceEngine_Voice_t* VoiceEngine_ActiveVoices[MAX_SIMULTANEOUS_NOTES];
+
+/** Number of voices in the active voice list. */
+volatile uint8_t VoiceEngine_TotalActiveVoices;
+
+/** Free running count of generated samples, used to pace the envelope processing. */
+volatile uint8_t VoiceEngine_SampleTicks;
+
+/** Sample tick count at which the envelopes were last processed. */
+static uint8_t LastControlTick;
+
+
+/** Initializes the voice engine, silencing all voices. */
+void VoiceEngine_Init(void)
+{
+	VoiceEngine_AllNotesOff();
+}
+
+/** Envelope processing task. This must be called frequently from the main program loop, and updates each active
+ *  voice's envelope and mix amplitude once per \ref VOICE_CONTROL_TICK_SAMPLES generated samples.
+ */
+void VoiceEngine_Task(void)
+{
+	if ((uint8_t)(VoiceEngine_SampleTicks - LastControlTick) < VOICE_CONTROL_TICK_SAMPLES)
+	  return;
+
+	LastControlTick += VOICE_CONTROL_TICK_SAMPLES;
+
+	uint16_t TotalAmplitude = 0;
+
+	for (uint8_t i = 0; i < VoiceEngine_TotalActiveVoices; i++)
+	{
+		VoiceEngine_Voice_t* Voice = VoiceEngine_ActiveVoices[i];
+
+		VoiceEngine_UpdateEnvelope(Voice);
+
+		/* Remove voices from the active list once their release has completed */
+		if (Voice->EnvelopeStage == ENVELOPE_STAGE_Idle)
+		{
+			VoiceEngine_RemoveActiveVoice(i--);
+			continue;
+		}
+
+		Voice->Amplitude = (((uint16_t)(Voice->EnvelopeLevel >> 8) * Voice->Velocity) >> 7);
+		TotalAmplitude  += Voice->Amplitude;
+	}
+
+	/* Scale all voices down together when their total amplitude would exceed the mixer's headroom, rather than clipping */
+	uint16_t MixGain = (TotalAmplitude > VOICE_MIX_BUDGET) ? ((VOICE_MIX_BUDGET << 8) / TotalAmplitude) : 256;
+
+	for (uint8_t i = 0; i < VoiceEngine_TotalActiveVoices; i++)
+	{
+		VoiceEngine_Voice_t* Voice = VoiceEngine_ActiveVoices[i];
+
+		Voice->MixAmplitude = ((Voice->Amplitude * MixGain) >> 8);
+	}
+}
+
+/** Starts a new note on a free voice, or retriggers the voice already playing the given pitch. When all voices are
+ *  in use, the quietest voice is reassigned to the new note.
+ *
+ *  \param[in] Pitch     MIDI pitch of the note to start.
+ *  \param[in] Velocity  MIDI velocity of the note to start, zero to stop the note instead.
+ */
+void VoiceEngine_NoteOn(const uint8_t Pitch,
+                        const uint8_t Velocity)
+{
+	if (!(Velocity))
+	{
+		VoiceEngine_NoteOff(Pitch);
+		return;
+	}
+
+	VoicePhase_t PhaseIncrement = VoiceEngine_GetPhaseIncrement(Pitch);
+
+	if (!(PhaseIncrement))
+	  return;
+
+	VoiceEngine_Voice_t* Voice = VoiceEngine_AllocateVoice(Pitch);
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		Voice->PhaseIncrement = PhaseIncrement;
+		Voice->Pitch          = Pitch;
+		Voice->Velocity       = (Velocity & 0x7F);
+
+		/* Newly allocated voices start from silence, retriggered and reassigned voices attack from their current level */
+		if (Voice->EnvelopeStage == ENVELOPE_STAGE_Idle)
+		{
+			Voice->Phase         = 0;
+			Voice->EnvelopeLevel = 0;
+			Voice->Amplitude     = 0;
+			Voice->MixAmplitude  = 0;
+
+			VoiceEngine_ActiveVoices[VoiceEngine_TotalActiveVoices++] = Voice;
+		}
+
+		Voice->EnvelopeStage = ENVELOPE_STAGE_Attack;
+	}
+}
+
+/** Releases the voice playing the given pitch, if any, so that it fades out over the envelope release time.
+ *
+ *  \param[in] Pitch  MIDI pitch of the note to stop.
+ */
+void VoiceEngine_NoteOff(const uint8_t Pitch)
+{
+	for (uint8_t i = 0; i < VoiceEngine_TotalActiveVoices; i++)
+	{
+		VoiceEngine_Voice_t* Voice = VoiceEngine_ActiveVoices[i];
+
+		if ((Voice->Pitch == Pitch) && (Voice->EnvelopeStage != ENVELOPE_STAGE_Release))
+		  Voice->EnvelopeStage = ENVELOPE_STAGE_Release;
+	}
+}
+
+/** Immediately silences all voices and empties the active voice list. */
+void VoiceEngine_AllNotesOff(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		VoiceEngine_TotalActiveVoices = 0;
+
+		for (uint8_t i = 0; i < MAX_SIMULTANEOUS_NOTES; i++)
+		  Voices[i].EnvelopeStage = ENVELOPE_STAGE_Idle;
+	}
+}
+
+/** Retrieves the number of voices currently generating sound, including voices in their release stage.
+ *
+ *  \return Number of voices in the active voice list.
+ */
+uint8_t VoiceEngine_GetActiveVoiceCount(void)
+{
+	return VoiceEngine_TotalActiveVoices;
+}
+
+/** Calculates the phase accumulator increment for a given MIDI pitch.
+ *
+ *  \param[in] Pitch  MIDI pitch to calculate the increment for.
+ *
+ *  \return Phase accumulator increment, or zero if the pitch cannot be generated at the current sample rate.
+ */
+static VoicePhase_t VoiceEngine_GetPhaseIncrement(const uint8_t Pitch)
+{
+	if (Pitch > 127)
+	  return 0;
+
+	uint8_t  Octave    = (Pitch / 12);
+	uint32_t Increment = (pgm_read_dword(&TopOctaveIncrements[Pitch % 12]) >> (10 - Octave));
+
+	/* Reject notes at or above the Nyquist frequency, which would alias to a lower tone */
+	if (Increment >= (1UL << (VOICE_ACCUMULATOR_BITS - 1)))
+	  return 0;
+
+	return Increment;
+}
+
+/** Selects the voice to play a new note, preferring a voice already playing the same pitch, then an idle voice, then
+ *  the quietest active voice.
+ *
+ *  \param[in] Pitch  MIDI pitch of the new note.
+ *
+ *  \return Pointer to the selected voice.
+ */
+static VoiceEngine_Voice_t* VoiceEngine_AllocateVoice(const uint8_t Pitch)
+{
+	VoiceEngine_Voice_t* QuietestVoice = NULL;
+
+	for (uint8_t i = 0; i < VoiceEngine_TotalActiveVoices; i++)
+	{
+		VoiceEngine_Voice_t* Voice = VoiceEngine_ActiveVoices[i];
+
+		if (Voice->Pitch == Pitch)
+		  return Voice;
+
+		if (!(QuietestVoice) || (Voice->Amplitude < QuietestVoice->Amplitude))
+		  QuietestVoice = Voice;
+	}
+
+	for (uint8_t i = 0; i < MAX_SIMULTANEOUS_NOTES; i++)
+	{
+		if (Voices[i].EnvelopeStage == ENVELOPE_STAGE_Idle)
+		  return &Voices[i];
+	}
+
+	return QuietestVoice;
+}
+
+/** Advances a voice's ADSR envelope by one control tick.
+ *
+ *  \param[in,out] Voice  Pointer to the voice whose envelope is to be updated.
+ */
+static void VoiceEngine_UpdateEnvelope(VoiceEngine_Voice_t* const Voice)
+{
+	const uint16_t SustainLevel = ((uint16_t)ENVELOPE_SUSTAIN_LEVEL << 8);
+
+	switch (Voice->EnvelopeStage)
+	{
+		case ENVELOPE_STAGE_Attack:
+			if (Voice->EnvelopeLevel < (UINT16_MAX - ENVELOPE_ATTACK_STEP))
+			{
+				Voice->EnvelopeLevel += ENVELOPE_ATTACK_STEP;
+			}
+			else
+			{
+				Voice->EnvelopeLevel = UINT16_MAX;
+				Voice->EnvelopeStage = ENVELOPE_STAGE_Decay;
+			}
+
+			break;
+		case ENVELOPE_STAGE_Decay:
+			if ((Voice->EnvelopeLevel - SustainLevel) > ENVELOPE_DECAY_STEP)
+			{
+				Voice->EnvelopeLevel -= ENVELOPE_DECAY_STEP;
+			}
+			else
+			{
+				Voice->EnvelopeLevel = SustainLevel;
+				Voice->EnvelopeStage = ENVELOPE_STAGE_Sustain;
+			}
+
+			break;
+		case ENVELOPE_STAGE_Release:
+			if (Voice->EnvelopeLevel > ENVELOPE_RELEASE_STEP)
+			{
+				Voice->EnvelopeLevel -= ENVELOPE_RELEASE_STEP;
+			}
+			else
+			{
+				Voice->EnvelopeLevel = 0;
+				Voice->EnvelopeStage = ENVELOPE_STAGE_Idle;
+			}
+
+			break;
+	}
+}
+
+/** Removes a voice from the active voice list, moving the last active voice into its place.
+ *
+ *  \param[in] Index  Index of the voice within the active voice list.
+ */
+static void VoiceEngine_RemoveActiveVoice(const uint8_t Index)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		VoiceEngine_ActiveVoices[Index] = VoiceEngine_ActiveVoices[--VoiceEngine_TotalActiveVoices];
+	}
+}
@@ -0,0 +1,185 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for VoiceEngine.c.
+ */
+
+#ifndef _VOICE_ENGINE_H_
+#define _VOICE_ENGINE_H_
+
+	/* Includes: */
+		#include <avr/pgmspace.h>
+		#include <util/atomic.h>
+		#include <stdint.h>
+		#include <stdbool.h>
+
+		#if !defined(HOST_NATIVE_BUILD)
+			#include <LUFA/Common/Common.h>
+		#else
+			#include "../HostNative/NativePlatform.h"
+		#endif
+
+		#include "Config/AppConfig.h"
+
+	/* Preprocessor Checks: */
+		#if ((VOICE_ACCUMULATOR_BITS != 16) && (VOICE_ACCUMULATOR_BITS != 24))
+			#error VOICE_ACCUMULATOR_BITS must be either 16 or 24.
+		#endif
+
+		#if ((MAX_SIMULTANEOUS_NOTES < 1) || (MAX_SIMULTANEOUS_NOTES > 32))
+			#error MAX_SIMULTANEOUS_NOTES must be between 1 and 32.
+		#endif
+
+	/* Macros: */
+		/** Number of audio samples between each envelope update, giving an envelope update rate of approximately 1KHz. */
+		#define VOICE_CONTROL_TICK_SAMPLES  (AUDIO_SAMPLE_RATE / 1000)
+
+		/** Envelope level increment per control tick during the attack stage. */
+		#define ENVELOPE_ATTACK_STEP        ((UINT16_MAX / (ENVELOPE_ATTACK_MS + 1)) + 1)
+
+		/** Envelope level decrement per control tick during the decay stage. */
+		#define ENVELOPE_DECAY_STEP         (((UINT16_MAX - ((uint16_t)ENVELOPE_SUSTAIN_LEVEL << 8)) / (ENVELOPE_DECAY_MS + 1)) + 1)
+
+		/** Envelope level decrement per control tick during the release stage. */
+		#define ENVELOPE_RELEASE_STEP       ((UINT16_MAX / (ENVELOPE_RELEASE_MS + 1)) + 1)
+
+		/** Total of the per-voice mix amplitudes that the mixer may output without exceeding the 8-bit output range. Each
+		 *  voice may round its contribution down by one LSB, so the budget leaves one LSB of headroom per voice below
+		 *  full scale.
+		 */
+		#define VOICE_MIX_BUDGET            (((128UL - MAX_SIMULTANEOUS_NOTES) * 256) / 127)
+
+		/** Converts a phase accumulator value into an index into the 256 entry sine table.
+		 *
+		 *  \param[in] Phase  Phase accumulator value to convert.
+		 *
+		 *  \return Sine table index for the given phase.
+		 */
+		#define VOICE_PHASE_INDEX(Phase)    ((uint8_t)((Phase) >> (VOICE_ACCUMULATOR_BITS - 8)))
+
+		/** Calculates the phase accumulator increment per sample for a given tone frequency at compile time.
+		 *
+		 *  \param[in] Frequency  Tone frequency in Hz.
+		 *
+		 *  \return Phase accumulator increment, scaled to the accumulator width.
+		 */
+		#define VOICE_PHASE_INCREMENT(Frequency) \
+		                                    ((uint32_t)((((Frequency) * (double)(1UL << VOICE_ACCUMULATOR_BITS)) / AUDIO_SAMPLE_RATE) + 0.5))
+
+	/* Type Defines: */
+		#if (VOICE_ACCUMULATOR_BITS == 16)
+			typedef uint16_t VoicePhase_t;
+		#elif !defined(HOST_NATIVE_BUILD)
+			typedef __uint24 VoicePhase_t;
+		#else
+			typedef uint32_t VoicePhase_t;
+		#endif
+
+		/** Type define for a single synthesiser voice, generating one note. */
+		typedef struct
+		{
+			VoicePhase_t Phase; /**< Current phase accumulator value of the voice's oscillator. */
+			VoicePhase_t PhaseIncrement; /**< Phase accumulator increment per sample, setting the voice's frequency. */
+			uint8_t      MixAmplitude; /**< Headroom scaled amplitude used by the mixer, updated each envelope tick. */
+			uint8_t      Amplitude; /**< Unscaled voice amplitude, from the envelope level and note velocity. */
+			uint8_t      Pitch; /**< MIDI pitch of the note being played by the voice. */
+			uint8_t      Velocity; /**< MIDI velocity of the note being played by the voice. */
+			uint8_t      EnvelopeStage; /**< Current envelope stage, a value from the \ref VoiceEngine_EnvelopeStages_t enum. */
+			uint16_t     EnvelopeLevel; /**< Current envelope level, from zero to full scale. */
+		} VoiceEngine_Voice_t;
+
+	/* Enums: */
+		/** Enum for the ADSR envelope stages of a voice. */
+		enum VoiceEngine_EnvelopeStages_t
+		{
+			ENVELOPE_STAGE_Idle    = 0, /**< Voice is not in the active voice list. */
+			ENVELOPE_STAGE_Attack  = 1, /**< Envelope is rising to full scale after a note on. */
+			ENVELOPE_STAGE_Decay   = 2, /**< Envelope is falling to the sustain level. */
+			ENVELOPE_STAGE_Sustain = 3, /**< Envelope is held at the sustain level until a note off. */
+			ENVELOPE_STAGE_Release = 4, /**< Envelope is falling to zero after a note off. */
+		};
+
+	/* External Variables: */
+		extern const int8_t         VoiceEngine_SineTable[256] PROGMEM;
+		extern VoiceEngine_Voice_t* VoiceEngine_ActiveVoices[MAX_SIMULTANEOUS_NOTES];
+		extern volatile uint8_t     VoiceEngine_TotalActiveVoices;
+		extern volatile uint8_t     VoiceEngine_SampleTicks;
+
+	/* Inline Functions: */
+		/** Generates the next output sample, advancing the oscillator of each voice in the active voice list and mixing
+		 *  them together. The mix amplitudes of the active voices never total more than \ref VOICE_MIX_BUDGET, so the
+		 *  mixed output always falls within the 8-bit output range without clipping.
+		 *
+		 *  \note This should be called once per sample period from the sample timer ISR.
+		 *
+		 *  \return Unsigned 8-bit output sample.
+		 */
+		static inline uint8_t VoiceEngine_RenderSample(void) ATTR_ALWAYS_INLINE;
+		static inline uint8_t VoiceEngine_RenderSample(void)
+		{
+			uint8_t TotalActiveVoices = VoiceEngine_TotalActiveVoices;
+			int16_t MixedSample       = 0;
+
+			for (uint8_t i = 0; i < TotalActiveVoices; i++)
+			{
+				VoiceEngine_Voice_t* Voice = VoiceEngine_ActiveVoices[i];
+
+				VoicePhase_t Phase = (Voice->Phase + Voice->PhaseIncrement);
+				Voice->Phase = Phase;
+
+				/* Signed 8-bit by unsigned 8-bit multiply, keeping the upper byte of the 16-bit product */
+				int8_t SineSample = (int8_t)pgm_read_byte(&VoiceEngine_SineTable[VOICE_PHASE_INDEX(Phase)]);
+				MixedSample += ((int16_t)(SineSample * Voice->MixAmplitude) >> 8);
+			}
+
+			VoiceEngine_SampleTicks++;
+
+			return (uint8_t)(MixedSample + 128);
+		}
+
+	/* Function Prototypes: */
+		void    VoiceEngine_Init(void);
+		void    VoiceEngine_Task(void);
+		void    VoiceEngine_NoteOn(const uint8_t Pitch,
+		                           const uint8_t Velocity);
+		void    VoiceEngine_NoteOff(const uint8_t Pitch);
+		void    VoiceEngine_AllNotesOff(void);
+		uint8_t VoiceEngine_GetActiveVoiceCount(void);
+
+		#if defined(INCLUDE_FROM_VOICEENGINE_C)
+			static VoicePhase_t VoiceEngine_GetPhaseIncrement(const uint8_t Pitch);
+			static VoiceEngine_Voice_t* VoiceEngine_AllocateVoice(const uint8_t Pitch);
+			static void VoiceEngine_UpdateEnvelope(VoiceEngine_Voice_t* const Voice);
+			static void VoiceEngine_RemoveActiveVoice(const uint8_t Index);
+		#endif
+
+#endif
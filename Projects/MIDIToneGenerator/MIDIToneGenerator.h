@@ -46,6 +46,7 @@
 
 		#include "Descriptors.h"
 		#include "Config/AppConfig.h"
+		#include "Lib/VoiceEngine.h"
 
 		#include <LUFA/Drivers/Board/LEDs.h>
 		#include <LUFA/Drivers/USB/USB.h>
@@ -64,34 +65,16 @@
 		/** LED mask for the library LED driver, to indicate that an error has occurred in the USB interface. */
 		#define LEDMASK_USB_ERROR        (LEDS_LED1 | LEDS_LED3)
 
-		/** Scale factor used to convert the floating point frequencies and ratios into a fixed point number */
-		#define SCALE_FACTOR               65536
+		/** MIDI control change number for the All Notes Off channel mode message. */
+		#define MIDI_CONTROL_ALL_NOTES_OFF 123
 
-		/** Base (lowest) allowable MIDI note frequency */
-		#define BASE_FREQUENCY             27.5
+		/** Compare value for the sample timer, running from the system clock divided by 8, to generate the audio sample rate. */
+		#define SAMPLE_TIMER_TOP           (((F_CPU / 8) / AUDIO_SAMPLE_RATE) - 1)
 
-		/** Ratio between each note in an octave */
-		#define NOTE_OCTIVE_RATIO          1.05946
-
-		/** Lowest valid MIDI pitch index */
-		#define BASE_PITCH_INDEX           21
-
-		/** Number of samples in the virtual sample table (can be expanded to lower maximum frequency, but allow for
-		 *  more simultaneous notes due to the reduced amount of processing time needed when the samples are spaced out)
-		 */
-		#define VIRTUAL_SAMPLE_TABLE_SIZE  512
-
-		/** Sample table increments per period for the base MIDI note frequency */
-		#define BASE_INCREMENT             (((F_CPU / VIRTUAL_SAMPLE_TABLE_SIZE / 2) / BASE_FREQUENCY))
-
-	/* Type Defines: */
-		typedef struct
-		{
-			uint8_t  LRUAge;
-			uint8_t  Pitch;
-			uint32_t TableIncrement;
-			uint32_t TablePosition;
-		} DDSNoteData;
+	/* Preprocessor Checks: */
+		#if (SAMPLE_TIMER_TOP > 0xFF)
+			#error AUDIO_SAMPLE_RATE is too low for the 8-bit sample timer at the current F_CPU.
+		#endif
 
 	/* Function Prototypes: */
 		void SetupHardware(void);
@@ -45,4 +45,10 @@
 
 	#define DUMMY_RTC
 
+	#define LOG_QUEUE_SIZE                32
+	#define LOG_SYNC_SECTORS              4
+	#define LOG_FLUSH_TICKS               120
+
+	#define DISK_CACHE_SECTORS            2
+
 #endif
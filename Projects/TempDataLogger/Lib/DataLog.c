@@ -0,0 +1,312 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Deferred temperature logging pipeline. The logging timer interrupt only queues compact binary samples,
+ *  which are later formatted as text from the main program loop and appended to the log file in sector
+ *  sized batches, so that each sample no longer costs a file system update and Dataflash page write.
+ */
+
+#define  INCLUDE_FROM_DATALOG_C
+#include "DataLog.h"
+
+/** FAT Fs structure to hold a FAT file handle for the log data write destination. */
+static FIL LogFile;
+
+/** Indicates if the log file is currently open and accepting samples. */
+static volatile bool LogIsOpen;
+
+/** Total number of 500ms ticks elapsed since startup, used to timestamp queued samples. */
+static volatile uint32_t LogTicks;
+
+/** Queue of samples recorded by the logging timer interrupt, waiting to be formatted and written. */
+static volatile LogRecord_t LogQueue[LOG_QUEUE_SIZE];
+
+/** Index of the next free entry in the sample queue, written only by the logging timer interrupt. */
+static volatile uint8_t LogQueueHead;
+
+/** Index of the oldest entry in the sample queue, written only by the main program loop. */
+static volatile uint8_t LogQueueTail;
+
+/** Formatted log data waiting to be written, up to the next sector boundary of the log file. */
+static char LogBatch[LOG_SECTOR_SIZE];
+
+/** Number of bytes of formatted log data waiting in the batch buffer. */
+static uint16_t LogBatchLength;
+
+/** Log tick count of the oldest sample waiting in the batch buffer. */
+static uint32_t LogBatchTick;
+
+/** Number of full sectors written to the log file since the file system was last synchronized. */
+static uint8_t LogSectorsSinceSync;
+
+/** Time and date corresponding to the \ref LogCursorTick tick count, used to timestamp formatted samples. */
+static TimeDate_t LogCursorTimeDate;
+
+/** Log tick count at which the time and date in \ref LogCursorTimeDate was current. */
+static uint32_t LogCursorTick;
+
+
+/** Opens the given log file for appending.
+ *
+ *  \param[in] FileName  Name of the log file to open on the mounted file system
+ *
+ *  \return Boolean \c true if the file was opened, \c false otherwise
+ */
+bool DataLog_Open(const char* FileName)
+{
+	if (LogIsOpen)
+	  return true;
+
+	if (f_open(&LogFile, FileName, FA_OPEN_ALWAYS | FA_WRITE) != FR_OK)
+	  return false;
+
+	f_lseek(&LogFile, LogFile.fsize);
+
+	LogBatchLength      = 0;
+	LogSectorsSinceSync = 0;
+
+	/* Timestamps of queued samples are derived from the time at which the file is opened */
+	RTC_GetTimeDate(&LogCursorTimeDate);
+	LogCursorTick = DataLog_GetTicks();
+
+	LogQueueTail = LogQueueHead;
+	LogIsOpen    = true;
+
+	return true;
+}
+
+/** Writes out all queued samples and closes the log file. */
+void DataLog_Close(void)
+{
+	if (!(LogIsOpen))
+	  return;
+
+	/* Stop the logging timer interrupt from queuing further samples before draining the queue */
+	LogIsOpen = false;
+
+	if (!(DataLog_ProcessQueue()))
+	  return;
+
+	DataLog_Flush();
+	f_close(&LogFile);
+}
+
+/** Determines if the log file is currently open and accepting samples.
+ *
+ *  \return Boolean \c true if the log file is open, \c false otherwise
+ */
+bool DataLog_IsOpen(void)
+{
+	return LogIsOpen;
+}
+
+/** Formats and batches the samples queued by the logging timer interrupt, writing each full sector of formatted
+ *  data to the log file. Partial batches are flushed once the oldest sample in them reaches \c LOG_FLUSH_TICKS
+ *  ticks old. This should be called frequently from the main program loop.
+ */
+void DataLog_Task(void)
+{
+	if (!(LogIsOpen))
+	  return;
+
+	if (!(DataLog_ProcessQueue()))
+	  return;
+
+	if (LogBatchLength && ((DataLog_GetTicks() - LogBatchTick) >= LOG_FLUSH_TICKS))
+	  DataLog_Flush();
+}
+
+/** Advances the log tick count. This should be called from the 500ms logging timer interrupt. */
+void DataLog_Tick500ms(void)
+{
+	LogTicks++;
+}
+
+/** Queues a new temperature sample for logging, timestamped with the current log tick count. This is safe to call
+ *  from the logging timer interrupt, and the sample is discarded if the log file is closed or the queue is full.
+ *
+ *  \param[in] Temperature  Sampled temperature to log, in degrees Celsius
+ */
+void DataLog_QueueSample(const int8_t Temperature)
+{
+	if (!(LogIsOpen))
+	  return;
+
+	uint8_t NextHead = ((LogQueueHead + 1) & (LOG_QUEUE_SIZE - 1));
+
+	if (NextHead == LogQueueTail)
+	  return;
+
+	LogQueue[LogQueueHead].Tick        = LogTicks;
+	LogQueue[LogQueueHead].Temperature = Temperature;
+
+	LogQueueHead = NextHead;
+}
+
+/** Atomically retrieves the current log tick count.
+ *
+ *  \return Total number of 500ms ticks elapsed since startup
+ */
+static uint32_t DataLog_GetTicks(void)
+{
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+
+	uint32_t Ticks = LogTicks;
+
+	SetGlobalInterruptMask(CurrentGlobalInt);
+
+	return Ticks;
+}
+
+/** Formats and batches all samples currently waiting in the sample queue.
+ *
+ *  \return Boolean \c true if all samples were processed, \c false if the log file was closed due to a write error
+ */
+static bool DataLog_ProcessQueue(void)
+{
+	while (LogQueueTail != LogQueueHead)
+	{
+		LogRecord_t Record;
+
+		Record.Tick        = LogQueue[LogQueueTail].Tick;
+		Record.Temperature = LogQueue[LogQueueTail].Temperature;
+
+		LogQueueTail = ((LogQueueTail + 1) & (LOG_QUEUE_SIZE - 1));
+
+		if (!(LogBatchLength))
+		  LogBatchTick = Record.Tick;
+
+		if (!(DataLog_AppendRecord(&Record)))
+		{
+			LogQueueTail = LogQueueHead;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** Formats a queued sample as a line of text and appends it to the batch buffer.
+ *
+ *  \param[in] Record  Pointer to the queued sample to format
+ *
+ *  \return Boolean \c true if the sample was appended, \c false if the log file was closed due to a write error
+ */
+static bool DataLog_AppendRecord(const LogRecord_t* const Record)
+{
+	char    LineBuffer[LOG_LINE_LENGTH];
+	uint8_t LineLength;
+
+	/* Advance the timestamp cursor a whole second at a time up to the sample's tick count */
+	while ((int32_t)(Record->Tick - LogCursorTick) >= 2)
+	{
+		RTC_AdvanceSecond(&LogCursorTimeDate);
+		LogCursorTick += 2;
+	}
+
+	LineLength = snprintf(LineBuffer, sizeof(LineBuffer), "%02d/%02d/20%02d, %02d:%02d:%02d, %d Degrees\r\n",
+	                      LogCursorTimeDate.Day, LogCursorTimeDate.Month, LogCursorTimeDate.Year,
+	                      LogCursorTimeDate.Hour, LogCursorTimeDate.Minute, LogCursorTimeDate.Second,
+	                      Record->Temperature);
+
+	return DataLog_AppendLine(LineBuffer, MIN(LineLength, sizeof(LineBuffer) - 1));
+}
+
+/** Appends a formatted line to the batch buffer, writing out the batch each time it reaches the next sector
+ *  boundary of the log file so that full sectors are written whole.
+ *
+ *  \param[in] Line    Pointer to the formatted line to append
+ *  \param[in] Length  Length of the line, in bytes
+ *
+ *  \return Boolean \c true if the line was appended, \c false if the log file was closed due to a write error
+ */
+static bool DataLog_AppendLine(const char* Line,
+                               uint8_t Length)
+{
+	while (Length)
+	{
+		uint16_t BatchCapacity = (LOG_SECTOR_SIZE - (LogFile.fptr % LOG_SECTOR_SIZE));
+		uint16_t BytesToCopy   = MIN(Length, (BatchCapacity - LogBatchLength));
+
+		memcpy(&LogBatch[LogBatchLength], Line, BytesToCopy);
+		LogBatchLength += BytesToCopy;
+		Line           += BytesToCopy;
+		Length         -= BytesToCopy;
+
+		if (LogBatchLength < BatchCapacity)
+		  continue;
+
+		if (!(DataLog_WriteBatch()))
+		  return false;
+
+		if (LOG_SYNC_SECTORS && (++LogSectorsSinceSync >= LOG_SYNC_SECTORS))
+		{
+			f_sync(&LogFile);
+			LogSectorsSinceSync = 0;
+		}
+	}
+
+	return true;
+}
+
+/** Writes the batch buffer to the log file.
+ *
+ *  \return Boolean \c true if the batch was written, \c false if the log file was closed due to a write error
+ */
+static bool DataLog_WriteBatch(void)
+{
+	UINT BytesWritten;
+
+	if ((f_write(&LogFile, LogBatch, LogBatchLength, &BytesWritten) != FR_OK) || (BytesWritten != LogBatchLength))
+	{
+		LogIsOpen      = false;
+		LogBatchLength = 0;
+
+		f_close(&LogFile);
+		return false;
+	}
+
+	LogBatchLength = 0;
+	return true;
+}
+
+/** Writes out any partial batch of formatted data and synchronizes the log file. */
+static void DataLog_Flush(void)
+{
+	if (LogBatchLength && !(DataLog_WriteBatch()))
+	  return;
+
+	f_sync(&LogFile);
+	LogSectorsSinceSync = 0;
+}
+
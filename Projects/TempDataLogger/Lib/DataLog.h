@@ -0,0 +1,89 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for DataLog.c.
+ */
+
+#ifndef _DATA_LOG_H_
+#define _DATA_LOG_H_
+
+	/* Includes: */
+		#include <avr/io.h>
+		#include <stdio.h>
+		#include <string.h>
+
+		#include "RTC.h"
+		#include "FATFs/ff.h"
+		#include "Config/AppConfig.h"
+
+		#include <LUFA/Common/Common.h>
+
+	/* Preprocessor Checks: */
+		#if ((LOG_QUEUE_SIZE < 2) || (LOG_QUEUE_SIZE > 128) || (LOG_QUEUE_SIZE & (LOG_QUEUE_SIZE - 1)))
+			#error LOG_QUEUE_SIZE must be a power of two between 2 and 128.
+		#endif
+
+	/* Macros: */
+		/** Size of a file system sector, in bytes. Formatted log lines are batched into writes of this size. */
+		#define LOG_SECTOR_SIZE               512
+
+		/** Maximum length of a single formatted log line, in bytes. */
+		#define LOG_LINE_LENGTH               40
+
+	/* Type Defines: */
+		/** Type define for a single queued temperature sample, as recorded from the logging timer interrupt. */
+		typedef struct
+		{
+			uint32_t Tick; /**< Log tick count at the time the sample was taken, in 500ms ticks. */
+			int8_t   Temperature; /**< Sampled temperature, in degrees Celsius. */
+		} LogRecord_t;
+
+	/* Function Prototypes: */
+		bool DataLog_Open(const char* FileName);
+		void DataLog_Close(void);
+		bool DataLog_IsOpen(void);
+		void DataLog_Task(void);
+		void DataLog_Tick500ms(void);
+		void DataLog_QueueSample(const int8_t Temperature);
+
+		#if defined(INCLUDE_FROM_DATALOG_C)
+			static uint32_t DataLog_GetTicks(void);
+			static bool DataLog_ProcessQueue(void);
+			static bool DataLog_AppendRecord(const LogRecord_t* const Record);
+			static bool DataLog_AppendLine(const char* Line,
+			                               uint8_t Length);
+			static bool DataLog_WriteBatch(void);
+			static void DataLog_Flush(void);
+		#endif
+
+#endif
+
@@ -41,7 +41,7 @@ DRESULT disk_read (
 	BYTE count		/* Number of sectors to read (1..128) */
 )
 {
-	DataflashManager_ReadBlocks_RAM(sector, count, buff);
+	DiskCache_ReadSectors(sector, count, buff);
 	return RES_OK;
 }
 
@@ -58,7 +58,7 @@ DRESULT disk_write (
 	BYTE count			/* Number of sectors to write (1..128) */
 )
 {
-	DataflashManager_WriteBlocks_RAM(sector, count, buff);
+	DiskCache_WriteSectors(sector, count, buff);
 	return RES_OK;
 }
 #endif /* _READONLY */
@@ -75,9 +75,14 @@ DRESULT disk_ioctl (
 )
 {
 	if (ctrl == CTRL_SYNC)
-	  return RES_OK;
+	{
+		DiskCache_Flush();
+		return RES_OK;
+	}
 	else
-	  return RES_PARERR;
+	{
+		return RES_PARERR;
+	}
 }
 
 
@@ -11,7 +11,7 @@ extern "C" {
 
 #include "integer.h"
 
-#include "../DataflashManager.h"
+#include "../DiskCache.h"
 
 
 /* Status of Disk Functions */
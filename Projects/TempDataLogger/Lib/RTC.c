@@ -7,6 +7,45 @@
 
 #include "RTC.h"
 
+void RTC_AdvanceSecond(TimeDate_t* const TimeDate)
+{
+	if (++TimeDate->Second < 60)
+	  return;
+
+	TimeDate->Second = 0;
+
+	if (++TimeDate->Minute < 60)
+	  return;
+
+	TimeDate->Minute = 0;
+
+	if (++TimeDate->Hour < 24)
+	  return;
+
+	TimeDate->Hour = 0;
+
+	static const char MonthLength[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+	uint8_t DaysInMonth = MonthLength[TimeDate->Month - 1];
+
+	/* Check if we need to account for a leap year */
+	if ((TimeDate->Month == 2) &&
+	    ((!(TimeDate->Year % 400)) || ((TimeDate->Year % 100) && !(TimeDate->Year % 4))))
+	{
+		DaysInMonth++;
+	}
+
+	if (++TimeDate->Day <= DaysInMonth)
+	  return;
+
+	TimeDate->Day = 1;
+
+	if (++TimeDate->Month <= 12)
+	  return;
+
+	TimeDate->Month = 1;
+	TimeDate->Year++;
+}
+
 #if defined(DUMMY_RTC)
 
 /** Current dummy RTC time and date */
@@ -30,41 +69,7 @@ void RTC_Tick500ms(void)
 	if (HalfSecondElapsed == false)
 	  return;
 
-	if (++DummyRTC_Count.Second < 60)
-	  return;
-
-	DummyRTC_Count.Second = 0;
-
-	if (++DummyRTC_Count.Minute < 60)
-	  return;
-
-	DummyRTC_Count.Minute = 0;
-
-	if (++DummyRTC_Count.Hour < 24)
-	  return;
-
-	DummyRTC_Count.Hour = 0;
-
-	static const char MonthLength[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-	uint8_t DaysInMonth = MonthLength[DummyRTC_Count.Month - 1];
-
-	/* Check if we need to account for a leap year */
-	if ((DummyRTC_Count.Month == 2) &&
-	    ((!(DummyRTC_Count.Year % 400)) || ((DummyRTC_Count.Year % 100) && !(DummyRTC_Count.Year % 4))))
-	{
-		DaysInMonth++;
-	}
-
-	if (++DummyRTC_Count.Day <= DaysInMonth)
-	  return;
-
-	DummyRTC_Count.Day = 1;
-
-	if (++DummyRTC_Count.Month <= 12)
-	  return;
-
-	DummyRTC_Count.Month = 1;
-	DummyRTC_Count.Year++;
+	RTC_AdvanceSecond((TimeDate_t*)&DummyRTC_Count);
 }
 
 bool RTC_SetTimeDate(const TimeDate_t* NewTimeDate)
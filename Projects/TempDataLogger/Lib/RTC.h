@@ -121,6 +121,7 @@
 		void RTC_Tick500ms(void);
 		bool RTC_SetTimeDate(const TimeDate_t* NewTimeDate);
 		bool RTC_GetTimeDate(TimeDate_t* const TimeDate);
+		void RTC_AdvanceSecond(TimeDate_t* const TimeDate);
 
 #endif
 
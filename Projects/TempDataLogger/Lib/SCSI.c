@@ -308,11 +308,21 @@ static bool SCSI_Command_ReadWrite_10(USB_ClassInfo_MS_Device_t* const MSInterfa
 		return false;
 	}
 
+	/* Ensure the host sees any sectors still held dirty in the local file system's disk cache */
+	DiskCache_Flush();
+
 	/* Determine if the packet is a READ (10) or WRITE (10) command, call appropriate function */
 	if (IsDataRead == DATA_READ)
-	  DataflashManager_ReadBlocks(MSInterfaceInfo, BlockAddress, TotalBlocks);
+	{
+		DataflashManager_ReadBlocks(MSInterfaceInfo, BlockAddress, TotalBlocks);
+	}
 	else
-	  DataflashManager_WriteBlocks(MSInterfaceInfo, BlockAddress, TotalBlocks);
+	{
+		DataflashManager_WriteBlocks(MSInterfaceInfo, BlockAddress, TotalBlocks);
+
+		/* Discard any cached copies of the sectors the host has just overwritten */
+		DiskCache_Invalidate(BlockAddress, TotalBlocks);
+	}
 
 	/* Update the bytes transferred counter and succeed the command */
 	MSInterfaceInfo->State.CommandBlock.DataTransferLength -= ((uint32_t)TotalBlocks * VIRTUAL_MEMORY_BLOCK_SIZE);
@@ -45,6 +45,7 @@
 		#include "../TempDataLogger.h"
 		#include "../Descriptors.h"
 		#include "DataflashManager.h"
+		#include "DiskCache.h"
 		#include "Config/AppConfig.h"
 
 	/* Macros: */
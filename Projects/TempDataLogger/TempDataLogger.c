@@ -96,15 +96,21 @@ static uint16_t CurrentLoggingTicks;
 /** FAT Fs structure to hold the internal state of the FAT driver for the Dataflash contents. */
 static FATFS DiskFATState;
 
-/** FAT Fs structure to hold a FAT file handle for the log data write destination. */
-static FIL TempLogFile;
+/** Indicates if the log file should be open, cleared while a USB host requires exclusive file system access. The
+ *  log file itself is only opened and closed from the main program loop, as the file system is not reentrant.
+ */
+static volatile bool LogFileRequested = true;
+
+/** Indicates if the log file has been opened from the main program loop in response to \ref LogFileRequested. */
+static bool LogFileOpened;
 
 
 /** ISR to handle the 500ms ticks for sampling and data logging */
 ISR(TIMER1_COMPA_vect, ISR_BLOCK)
 {
-	/* Signal a 500ms tick has elapsed to the RTC */
+	/* Signal a 500ms tick has elapsed to the RTC and the data log */
 	RTC_Tick500ms();
+	DataLog_Tick500ms();
 
 	/* Check to see if the logging interval has expired */
 	if (++CurrentLoggingTicks < LoggingInterval500MS_SRAM)
@@ -113,28 +119,9 @@ ISR(TIMER1_COMPA_vect, ISR_BLOCK)
 	/* Reset log tick counter to prepare for next logging interval */
 	CurrentLoggingTicks = 0;
 
-	uint8_t LEDMask = LEDs_GetLEDs();
-	LEDs_SetAllLEDs(LEDMASK_USB_BUSY);
-
-	/* Only log when not connected to a USB host */
+	/* Only log when not connected to a USB host; the sample is written out later from the main program loop */
 	if (USB_DeviceState == DEVICE_STATE_Unattached)
-	{
-		TimeDate_t CurrentTimeDate;
-		RTC_GetTimeDate(&CurrentTimeDate);
-
-		char     LineBuffer[100];
-		uint16_t BytesWritten;
-
-		BytesWritten = sprintf(LineBuffer, "%02d/%02d/20%02d, %02d:%02d:%02d, %d Degrees\r\n",
-		                       CurrentTimeDate.Day, CurrentTimeDate.Month, CurrentTimeDate.Year,
-		                       CurrentTimeDate.Hour, CurrentTimeDate.Minute, CurrentTimeDate.Second,
-		                       Temperature_GetTemperature());
-
-		f_write(&TempLogFile, LineBuffer, BytesWritten, &BytesWritten);
-		f_sync(&TempLogFile);
-	}
-
-	LEDs_SetAllLEDs(LEDMask);
+	  DataLog_QueueSample(Temperature_GetTemperature());
 }
 
 /** Main program entry point. This routine contains the overall program flow, including initial
@@ -151,14 +138,24 @@ int main(void)
 	if (LoggingInterval500MS_SRAM == 0xFF)
 	  LoggingInterval500MS_SRAM = DEFAULT_LOG_INTERVAL;
 
-	/* Mount and open the log file on the Dataflash FAT partition */
-	OpenLogFile();
-
 	LEDs_SetAllLEDs(LEDMASK_USB_NOTREADY);
 	GlobalInterruptEnable();
 
 	for (;;)
 	{
+		/* Open or close the log file as requested by the USB connection events */
+		if (LogFileOpened != LogFileRequested)
+		{
+			LogFileOpened = LogFileRequested;
+
+			if (LogFileOpened)
+			  OpenLogFile();
+			else
+			  CloseLogFile();
+		}
+
+		DataLog_Task();
+
 		MS_Device_USBTask(&Disk_MS_Interface);
 		HID_Device_USBTask(&Generic_HID_Interface);
 		USB_USBTask();
@@ -177,16 +174,14 @@ void OpenLogFile(void)
 
 	/* Mount the storage device, open the file */
 	f_mount(0, &DiskFATState);
-	f_open(&TempLogFile, LogFileName, FA_OPEN_ALWAYS | FA_WRITE);
-	f_lseek(&TempLogFile, TempLogFile.fsize);
+	DataLog_Open(LogFileName);
 }
 
 /** Closes the open data log file on the Dataflash's FAT formatted partition */
 void CloseLogFile(void)
 {
-	/* Sync any data waiting to be written, unmount the storage device */
-	f_sync(&TempLogFile);
-	f_close(&TempLogFile);
+	/* Write out any samples waiting to be logged, close the file */
+	DataLog_Close();
 }
 
 /** Configures the board hardware and chip peripherals for the demo's functionality. */
@@ -232,7 +227,7 @@ void EVENT_USB_Device_Connect(void)
 	LEDs_SetAllLEDs(LEDMASK_USB_ENUMERATING);
 
 	/* Close the log file so that the host has exclusive file system access */
-	CloseLogFile();
+	LogFileRequested = false;
 }
 
 /** Event handler for the library USB Disconnection event. */
@@ -241,7 +236,7 @@ void EVENT_USB_Device_Disconnect(void)
 	LEDs_SetAllLEDs(LEDMASK_USB_NOTREADY);
 
 	/* Mount and open the log file on the Dataflash FAT partition */
-	OpenLogFile();
+	LogFileRequested = true;
 }
 
 /** Event handler for the library USB Configuration Changed event. */
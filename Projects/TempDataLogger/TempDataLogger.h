@@ -47,6 +47,7 @@
 
 		#include "Lib/SCSI.h"
 		#include "Lib/DataflashManager.h"
+		#include "Lib/DataLog.h"
 		#include "Lib/FATFs/ff.h"
 		#include "Lib/RTC.h"
 		#include "Config/AppConfig.h"
@@ -46,6 +46,9 @@
 
 		/* Non-USB Related Configuration Tokens: */
 //		#define DISABLE_TERMINAL_CODES
+		#define INTERRUPT_SERIAL_BUFFERS
+		#define SERIAL_RX_BUFFER_SIZE            128
+		#define SERIAL_TX_BUFFER_SIZE            128
 
 		/* USB Class Driver Related Tokens: */
 //		#define HID_HOST_BOOT_PROTOCOL_ONLY
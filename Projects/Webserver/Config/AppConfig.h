@@ -47,6 +47,14 @@
 	#define ENABLE_DHCP_SERVER
 	#define ENABLE_TELNET_SERVER
 	#define MAX_URI_LENGTH                50
+	#define MAX_OPEN_FILES                2
+
+//	#define DATAFLASH_FTL
+	#define FTL_LOG_PAGES                 32
+	#define FTL_GC_THRESHOLD              12
+	#define FTL_FLUSH_IDLE_TASKS          2000
+
+	#define DISK_CACHE_SECTORS            1
 
 	#define DEVICE_IP_ADDRESS             (uint8_t[]){ 10,   0,   0,   2}
 	#define DEVICE_NETMASK                (uint8_t[]){255, 255, 255,   0}
@@ -0,0 +1,64 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Host-native replacement for the AVR-LibC program space header. Host builds have a single address space, so
+ *  program space data is placed in RAM and the program space string functions map to their standard equivalents.
+ */
+
+#ifndef _NATIVE_PGMSPACE_H_
+#define _NATIVE_PGMSPACE_H_
+
+	/* Includes: */
+		#include <stdint.h>
+		#include <string.h>
+		#include <stdio.h>
+
+	/* Macros: */
+		#define PROGMEM
+		#define PSTR(String)                                  (String)
+
+		#define pgm_read_byte(Address)                        (*(const uint8_t*)(Address))
+		#define pgm_read_word(Address)                        (*(const uint16_t*)(Address))
+		#define pgm_read_dword(Address)                       (*(const uint32_t*)(Address))
+		#define pgm_read_ptr(Address)                         (*(void* const*)(Address))
+
+		#define memcpy_P(Destination, Source, Length)         memcpy(Destination, Source, Length)
+		#define strcpy_P(Destination, Source)                 strcpy(Destination, Source)
+		#define strcat_P(Destination, Source)                 strcat(Destination, Source)
+		#define strcmp_P(String1, String2)                    strcmp(String1, String2)
+		#define strlen_P(String)                              strlen(String)
+		#define strlcpy_P(Destination, Source, Size)          strlcpy(Destination, Source, Size)
+		#define sprintf_P                                     sprintf
+		#define printf_P                                      printf
+
+#endif
+
@@ -0,0 +1,46 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Host-native replacement for the AVR-LibC atomic block header. The native build is single threaded and has no
+ *  interrupts, so atomic blocks execute their contents directly.
+ */
+
+#ifndef _NATIVE_ATOMIC_H_
+#define _NATIVE_ATOMIC_H_
+
+	/* Macros: */
+		#define ATOMIC_BLOCK(Type)                            for (int AtomicBlockOnce = 1; AtomicBlockOnce; AtomicBlockOnce = 0)
+		#define ATOMIC_RESTORESTATE
+		#define ATOMIC_FORCEON
+
+#endif
+
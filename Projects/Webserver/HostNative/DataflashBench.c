@@ -0,0 +1,244 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Dataflash storage benchmark for the host-native build of the Webserver project. This runs a set of block write
+ *  workloads through the project's DataflashManager RAM block functions on top of the simulated USBKEY Dataflash ICs,
+ *  reporting the resulting write amplification, page wear and throughput. The benchmark is built both with and
+ *  without the Dataflash FTL enabled, so that the two storage schemes can be compared.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "DataflashSim.h"
+#include "../Lib/DataflashManager.h"
+
+/** Number of blocks at the start of the disk which are touched by the benchmark workloads. */
+#define BENCH_DISK_BLOCKS         8192
+
+/** Type define for a benchmark workload entry. */
+typedef struct
+{
+	const char* Name; /**< Human readable name of the workload */
+	void (*Run)(void); /**< Function issuing the workload's block writes */
+} Bench_Workload_t;
+
+/** Expected contents of each block of the benchmark area of the disk. */
+static uint8_t ShadowDisk[BENCH_DISK_BLOCKS][VIRTUAL_MEMORY_BLOCK_SIZE];
+
+/** Flags indicating which blocks of the benchmark area have been written by the current workload. */
+static bool BlockWritten[BENCH_DISK_BLOCKS];
+
+/** Number of blocks written by the current workload. */
+static uint32_t TotalBlocksWritten;
+
+
+/** Fills the given blocks with new pseudo-random data, and writes them to the Dataflash.
+ *
+ *  \param[in] BlockAddress  First block to write
+ *  \param[in] TotalBlocks   Number of consecutive blocks to write
+ */
+static void Bench_WriteBlocks(const uint32_t BlockAddress,
+                              const uint16_t TotalBlocks)
+{
+	for (uint16_t BlockNum = 0; BlockNum < TotalBlocks; BlockNum++)
+	{
+		for (uint16_t ByteNum = 0; ByteNum < VIRTUAL_MEMORY_BLOCK_SIZE; ByteNum++)
+		  ShadowDisk[BlockAddress + BlockNum][ByteNum] = rand();
+
+		BlockWritten[BlockAddress + BlockNum] = true;
+	}
+
+	DataflashManager_WriteBlocks_RAM(BlockAddress, TotalBlocks, ShadowDisk[BlockAddress]);
+	TotalBlocksWritten += TotalBlocks;
+
+	#if defined(DATAFLASH_FTL)
+	DataflashFTL_Task();
+	#endif
+}
+
+/** Sequential workload, writing 2MB of data in 8KB requests. */
+static void Bench_Sequential(void)
+{
+	for (uint16_t Block = 0; Block < 4096; Block += 16)
+	  Bench_WriteBlocks(Block, 16);
+}
+
+/** File append workload, modelling a FAT file system appending to a file one block at a time; each data block write
+ *  is followed by an update of the file's FAT block and directory entry block.
+ */
+static void Bench_FileAppend(void)
+{
+	for (uint16_t Block = 0; Block < 1024; Block++)
+	{
+		Bench_WriteBlocks(1024 + Block, 1);
+		Bench_WriteBlocks(32 + (Block / 128), 1);
+		Bench_WriteBlocks(16, 1);
+	}
+}
+
+/** Random workload, writing 4MB of data in 4KB requests to random aligned locations of the benchmark area. */
+static void Bench_Random(void)
+{
+	for (uint16_t Request = 0; Request < 1024; Request++)
+	  Bench_WriteBlocks((rand() % (BENCH_DISK_BLOCKS / 8)) * 8, 8);
+}
+
+/** Hot spot workload, repeatedly rewriting a small set of scattered single blocks. */
+static void Bench_HotSpot(void)
+{
+	for (uint16_t Request = 0; Request < 4096; Request++)
+	  Bench_WriteBlocks((rand() % 8) * 97, 1);
+}
+
+/** Mixed workload, interleaving single block rewrites with whole page writes over the same small area, so that whole
+ *  page writes supersede blocks still held in the write log.
+ */
+static void Bench_Mixed(void)
+{
+	for (uint16_t Request = 0; Request < 2048; Request++)
+	{
+		if (Request % 4)
+		  Bench_WriteBlocks((rand() % 256), 1);
+		else
+		  Bench_WriteBlocks(((rand() % 32) * 8), 8);
+	}
+}
+
+/** Reads back every block written by the current workload, and compares it against the expected contents.
+ *
+ *  \return Boolean \c true if all blocks match, \c false otherwise
+ */
+static bool Bench_Verify(void)
+{
+	uint8_t BlockData[VIRTUAL_MEMORY_BLOCK_SIZE];
+
+	for (uint16_t Block = 0; Block < BENCH_DISK_BLOCKS; Block++)
+	{
+		if (!(BlockWritten[Block]))
+		  continue;
+
+		DataflashManager_ReadBlocks_RAM(Block, 1, BlockData);
+
+		if (memcmp(BlockData, ShadowDisk[Block], VIRTUAL_MEMORY_BLOCK_SIZE))
+		{
+			printf("  Block %u does not match the written data\n", Block);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** Runs the given workload on a freshly erased Dataflash, and prints its statistics.
+ *
+ *  \param[in] Workload  Workload to run
+ *
+ *  \return Boolean \c true if the written data was read back intact, \c false otherwise
+ */
+static bool Bench_RunWorkload(const Bench_Workload_t* const Workload)
+{
+	DataflashSim_Stats_t Stats;
+	bool                 DataValid;
+
+	DataflashSim_Reset();
+	Dataflash_Init();
+
+	#if defined(DATAFLASH_FTL)
+	DataflashFTL_Init();
+	#endif
+
+	memset(BlockWritten, 0x00, sizeof(BlockWritten));
+	TotalBlocksWritten = 0;
+	srand(1);
+
+	DataflashSim_ResetStats();
+	Workload->Run();
+
+	#if defined(DATAFLASH_FTL)
+	DataflashFTL_Flush();
+	#endif
+
+	Stats     = DataflashSim_Stats;
+	DataValid = Bench_Verify();
+
+	#if defined(DATAFLASH_FTL)
+	/* Rebuild the FTL state from the Dataflash contents, as on the next power up, and check again */
+	DataflashFTL_Init();
+	DataValid = (DataValid && Bench_Verify());
+	#endif
+
+	uint32_t LogicalKB = ((TotalBlocksWritten * VIRTUAL_MEMORY_BLOCK_SIZE) / 1024);
+	double   Seconds   = (Stats.ElapsedNS / 1e9);
+
+	printf("%-12s %8u %9u %7u %9u %6.2f %8u %9.1f %s\n", Workload->Name, LogicalKB, Stats.PagePrograms,
+	       Stats.PageErases, Stats.PageTransfers,
+	       ((double)(Stats.PagePrograms + Stats.PageErases) * DATAFLASH_PAGE_SIZE) / (LogicalKB * 1024.0),
+	       Stats.MaxPageWear, (LogicalKB / Seconds), (DataValid && !(Stats.BusyViolations)) ? "OK" : "FAIL");
+
+	if (Stats.BusyViolations)
+	  printf("  %u commands were issued to a busy Dataflash IC\n", Stats.BusyViolations);
+
+	return (DataValid && !(Stats.BusyViolations));
+}
+
+/** Main program entry point. This runs each of the benchmark workloads in turn, returning a failure exit code if
+ *  any workload's data could not be read back intact.
+ */
+int main(void)
+{
+	static const Bench_Workload_t Workloads[] =
+		{
+			{.Name = "Sequential", .Run = Bench_Sequential},
+			{.Name = "FileAppend", .Run = Bench_FileAppend},
+			{.Name = "Random4K",   .Run = Bench_Random},
+			{.Name = "HotSpot",    .Run = Bench_HotSpot},
+			{.Name = "Mixed",      .Run = Bench_Mixed},
+		};
+
+	bool AllPassed = true;
+
+	#if defined(DATAFLASH_FTL)
+	printf("Dataflash FTL enabled, %u log pages, %u logical blocks\n", FTL_LOG_PAGES, FTL_LOGICAL_BLOCKS);
+	#else
+	printf("Dataflash FTL disabled, direct block mapping\n");
+	#endif
+
+	printf("%-12s %8s %9s %7s %9s %6s %8s %9s %s\n", "Workload", "KB", "Programs", "Erases", "Transfers",
+	       "WAF", "MaxWear", "KB/s", "Data");
+
+	for (uint8_t WorkloadIndex = 0; WorkloadIndex < (sizeof(Workloads) / sizeof(Workloads[0])); WorkloadIndex++)
+	  AllPassed &= Bench_RunWorkload(&Workloads[WorkloadIndex]);
+
+	return AllPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
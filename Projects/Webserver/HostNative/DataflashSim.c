@@ -0,0 +1,355 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Command-level simulation of the two AT45DB642D Dataflash ICs of the USBKEY board, for the host-native build of
+ *  the Webserver project. The main memory pages and SRAM buffers of each IC are modelled in the standard (1056 byte)
+ *  page size mode, along with the typical datasheet timings of the SPI bus and of each internal operation, so that
+ *  the Dataflash access patterns of the firmware can be measured. Each internal operation runs in the background
+ *  of the simulated time, until the IC's status register is polled and the MCU must wait for it to complete.
+ */
+
+#include <string.h>
+
+#include "DataflashSim.h"
+
+/** Type define for the state of a single simulated Dataflash IC. */
+typedef struct
+{
+	uint8_t  Memory[DATAFLASH_PAGES][DATAFLASHSIM_FULL_PAGE_SIZE]; /**< Main memory array contents */
+	uint8_t  Buffer[2][DATAFLASHSIM_FULL_PAGE_SIZE]; /**< SRAM buffer contents */
+	uint32_t Wear[DATAFLASH_PAGES]; /**< Number of program and erase cycles of each main memory page */
+	uint64_t BusyUntilNS; /**< Simulated time at which the current internal operation completes */
+	int8_t   BusyBuffer; /**< SRAM buffer in use by the current internal operation, or -1 if none */
+	uint8_t  Command; /**< Opcode of the command currently being received */
+	uint16_t CommandBytes; /**< Number of bytes received since the IC was selected */
+	uint32_t Address; /**< 24-bit address received with the current command */
+	uint16_t DataIndex; /**< Current byte offset of the data phase within the addressed page or buffer */
+} DataflashSim_Chip_t;
+
+/** Accumulated statistics of the simulated Dataflash ICs. */
+DataflashSim_Stats_t DataflashSim_Stats;
+
+/** State of each simulated Dataflash IC. */
+static DataflashSim_Chip_t Chips[DATAFLASH_TOTALCHIPS];
+
+/** Mask of the currently selected Dataflash IC, or \ref DATAFLASH_NO_CHIP if none. */
+static uint8_t SelectedChipMask;
+
+
+/** Determines if the given simulated IC is currently executing an internal operation.
+ *
+ *  \param[in] Chip  Simulated IC to check
+ *
+ *  \return Boolean \c true if the IC is busy, \c false otherwise
+ */
+static bool DataflashSim_IsBusy(const DataflashSim_Chip_t* const Chip)
+{
+	return (DataflashSim_Stats.ElapsedNS < Chip->BusyUntilNS);
+}
+
+/** Starts a simulated internal operation on the given IC, marking it busy for the given duration.
+ *
+ *  \param[in,out] Chip        Simulated IC that is to execute the operation
+ *  \param[in]     DurationNS  Duration of the operation, in nanoseconds
+ *  \param[in]     Buffer      SRAM buffer used by the operation, or -1 if none
+ *  \param[in]     Page        Main memory page affected by the operation, or -1 if the page is only read
+ */
+static void DataflashSim_StartOperation(DataflashSim_Chip_t* const Chip,
+                                        const uint32_t DurationNS,
+                                        const int8_t Buffer,
+                                        const int16_t Page)
+{
+	Chip->BusyUntilNS = (DataflashSim_Stats.ElapsedNS + DurationNS);
+	Chip->BusyBuffer  = Buffer;
+
+	if (Page < 0)
+	  return;
+
+	if (++Chip->Wear[Page] > DataflashSim_Stats.MaxPageWear)
+	  DataflashSim_Stats.MaxPageWear = Chip->Wear[Page];
+}
+
+/** Determines if the given command opcode may be accepted by a simulated IC while it is busy. Only status reads and
+ *  accesses to the SRAM buffer not involved in the current internal operation are permitted.
+ *
+ *  \param[in] Chip     Simulated IC receiving the command
+ *  \param[in] Command  Command opcode being received
+ *
+ *  \return Boolean \c true if the command is allowed, \c false otherwise
+ */
+static bool DataflashSim_CommandAllowedWhileBusy(const DataflashSim_Chip_t* const Chip,
+                                                 const uint8_t Command)
+{
+	switch (Command)
+	{
+		case DF_CMD_GETSTATUS:
+			return true;
+		case DF_CMD_BUFF1READ_LF:
+		case DF_CMD_BUFF1WRITE:
+			return (Chip->BusyBuffer != 0);
+		case DF_CMD_BUFF2READ_LF:
+		case DF_CMD_BUFF2WRITE:
+			return (Chip->BusyBuffer != 1);
+		default:
+			return false;
+	}
+}
+
+/** Executes the internal operation of the command received by the given IC, once its chip select is released.
+ *
+ *  \param[in,out] Chip  Simulated IC which has been deselected
+ */
+static void DataflashSim_CompleteCommand(DataflashSim_Chip_t* const Chip)
+{
+	uint16_t Page = ((Chip->Address >> 11) % DATAFLASH_PAGES);
+
+	/* All internal operations require the full opcode and address to have been received */
+	if (Chip->CommandBytes < 4)
+	  return;
+
+	switch (Chip->Command)
+	{
+		case DF_CMD_BUFF1TOMAINMEMWITHERASE:
+		case DF_CMD_BUFF2TOMAINMEMWITHERASE:
+		{
+			int8_t Buffer = (Chip->Command == DF_CMD_BUFF2TOMAINMEMWITHERASE);
+
+			memcpy(Chip->Memory[Page], Chip->Buffer[Buffer], DATAFLASHSIM_FULL_PAGE_SIZE);
+			DataflashSim_StartOperation(Chip, DATAFLASHSIM_PROGRAM_ERASE_NS, Buffer, Page);
+			DataflashSim_Stats.PagePrograms++;
+			break;
+		}
+		case DF_CMD_BUFF1TOMAINMEM:
+		case DF_CMD_BUFF2TOMAINMEM:
+		{
+			int8_t Buffer = (Chip->Command == DF_CMD_BUFF2TOMAINMEM);
+
+			for (uint16_t ByteNum = 0; ByteNum < DATAFLASHSIM_FULL_PAGE_SIZE; ByteNum++)
+			  Chip->Memory[Page][ByteNum] &= Chip->Buffer[Buffer][ByteNum];
+
+			DataflashSim_StartOperation(Chip, DATAFLASHSIM_PROGRAM_NS, Buffer, Page);
+			DataflashSim_Stats.PagePrograms++;
+			break;
+		}
+		case DF_CMD_PAGEERASE:
+			memset(Chip->Memory[Page], 0xFF, DATAFLASHSIM_FULL_PAGE_SIZE);
+			DataflashSim_StartOperation(Chip, DATAFLASHSIM_PAGE_ERASE_NS, -1, Page);
+			DataflashSim_Stats.PageErases++;
+			break;
+		case DF_CMD_MAINMEMTOBUFF1:
+		case DF_CMD_MAINMEMTOBUFF2:
+		{
+			int8_t Buffer = (Chip->Command == DF_CMD_MAINMEMTOBUFF2);
+
+			memcpy(Chip->Buffer[Buffer], Chip->Memory[Page], DATAFLASHSIM_FULL_PAGE_SIZE);
+			DataflashSim_StartOperation(Chip, DATAFLASHSIM_TRANSFER_NS, Buffer, -1);
+			DataflashSim_Stats.PageTransfers++;
+			break;
+		}
+	}
+}
+
+/** Processes a byte received by the given IC while its chip select is asserted, returning the IC's response.
+ *
+ *  \param[in,out] Chip  Simulated IC receiving the byte
+ *  \param[in]     Byte  Byte clocked into the IC
+ *
+ *  \return Byte clocked out of the IC
+ */
+static uint8_t DataflashSim_ProcessByte(DataflashSim_Chip_t* const Chip,
+                                        const uint8_t Byte)
+{
+	uint16_t BytePosition = Chip->CommandBytes;
+	uint8_t  Response     = 0xFF;
+
+	if (Chip->CommandBytes < UINT16_MAX)
+	  Chip->CommandBytes++;
+
+	/* First byte after selection is the command opcode, which a busy IC will ignore unless permitted */
+	if (!(BytePosition))
+	{
+		Chip->Command = Byte;
+		Chip->Address = 0;
+
+		if (DataflashSim_IsBusy(Chip) && !(DataflashSim_CommandAllowedWhileBusy(Chip, Byte)))
+		{
+			DataflashSim_Stats.BusyViolations++;
+			Chip->Command = 0x00;
+		}
+
+		return Response;
+	}
+
+	if (Chip->Command == DF_CMD_GETSTATUS)
+	{
+		/* The MCU spins on the status register until ready, so skip ahead to the end of the current operation */
+		if (DataflashSim_IsBusy(Chip))
+		  DataflashSim_Stats.ElapsedNS = Chip->BusyUntilNS;
+
+		return (DF_STATUS_READY | 0x3C);
+	}
+	else if (Chip->Command == DF_CMD_READMANUFACTURERDEVICEINFO)
+	{
+		static const uint8_t DeviceInfo[] = {DF_MANUFACTURER_ATMEL, 0x28, 0x00, 0x01, 0x00};
+
+		return (BytePosition <= sizeof(DeviceInfo)) ? DeviceInfo[BytePosition - 1] : 0x00;
+	}
+
+	/* Remaining commands are followed by a 24-bit page and byte address */
+	if (BytePosition <= 3)
+	{
+		Chip->Address   = ((Chip->Address << 8) | Byte);
+		Chip->DataIndex = ((Chip->Address & 0x7FF) % DATAFLASHSIM_FULL_PAGE_SIZE);
+
+		return Response;
+	}
+
+	uint16_t Page = ((Chip->Address >> 11) % DATAFLASH_PAGES);
+
+	switch (Chip->Command)
+	{
+		case DF_CMD_MAINMEMPAGEREAD:
+			/* Main memory page reads have four dummy bytes between the address and the data */
+			if (BytePosition < 8)
+			  return Response;
+
+			Response = Chip->Memory[Page][Chip->DataIndex];
+			break;
+		case DF_CMD_BUFF1READ_LF:
+		case DF_CMD_BUFF2READ_LF:
+			Response = Chip->Buffer[Chip->Command == DF_CMD_BUFF2READ_LF][Chip->DataIndex];
+			break;
+		case DF_CMD_BUFF1WRITE:
+		case DF_CMD_BUFF2WRITE:
+			Chip->Buffer[Chip->Command == DF_CMD_BUFF2WRITE][Chip->DataIndex] = Byte;
+			break;
+		default:
+			return Response;
+	}
+
+	/* Data phase accesses wrap around within the page or buffer */
+	Chip->DataIndex = ((Chip->DataIndex + 1) % DATAFLASHSIM_FULL_PAGE_SIZE);
+
+	return Response;
+}
+
+/** Erases the main memory and buffers of all simulated Dataflash ICs, and resets the accumulated statistics. */
+void DataflashSim_Reset(void)
+{
+	memset(Chips, 0x00, sizeof(Chips));
+
+	for (uint8_t ChipIndex = 0; ChipIndex < DATAFLASH_TOTALCHIPS; ChipIndex++)
+	{
+		memset(Chips[ChipIndex].Memory, 0xFF, sizeof(Chips[ChipIndex].Memory));
+		memset(Chips[ChipIndex].Buffer, 0xFF, sizeof(Chips[ChipIndex].Buffer));
+		Chips[ChipIndex].BusyBuffer = -1;
+	}
+
+	SelectedChipMask = DATAFLASH_NO_CHIP;
+	memset(&DataflashSim_Stats, 0x00, sizeof(DataflashSim_Stats));
+}
+
+/** Resets the accumulated statistics and page wear counters of the simulated Dataflash ICs, without altering their
+ *  contents or the progress of any internal operations.
+ */
+void DataflashSim_ResetStats(void)
+{
+	for (uint8_t ChipIndex = 0; ChipIndex < DATAFLASH_TOTALCHIPS; ChipIndex++)
+	{
+		DataflashSim_Chip_t* Chip = &Chips[ChipIndex];
+
+		Chip->BusyUntilNS = DataflashSim_IsBusy(Chip) ? (Chip->BusyUntilNS - DataflashSim_Stats.ElapsedNS) : 0;
+		memset(Chip->Wear, 0x00, sizeof(Chip->Wear));
+	}
+
+	memset(&DataflashSim_Stats, 0x00, sizeof(DataflashSim_Stats));
+}
+
+/** Initializes the simulated Dataflash driver, deselecting all ICs. */
+void Dataflash_Init(void)
+{
+	Dataflash_DeselectChip();
+}
+
+/** Sends a byte to the currently selected simulated Dataflash IC, and returns a byte from the Dataflash.
+ *
+ *  \param[in] Byte  Byte of data to send to the Dataflash
+ *
+ *  \return Last response byte from the Dataflash
+ */
+uint8_t Dataflash_TransferByte(const uint8_t Byte)
+{
+	DataflashSim_Stats.ElapsedNS += DATAFLASHSIM_SPI_BYTE_NS;
+	DataflashSim_Stats.BytesTransferred++;
+
+	switch (SelectedChipMask)
+	{
+		case DATAFLASH_CHIP1:
+			return DataflashSim_ProcessByte(&Chips[0], Byte);
+		case DATAFLASH_CHIP2:
+			return DataflashSim_ProcessByte(&Chips[1], Byte);
+		default:
+			return 0xFF;
+	}
+}
+
+/** Determines the currently selected simulated Dataflash IC.
+ *
+ *  \return Mask of the currently selected Dataflash chip, or \ref DATAFLASH_NO_CHIP if none
+ */
+uint8_t Dataflash_GetSelectedChip(void)
+{
+	return SelectedChipMask;
+}
+
+/** Selects the given simulated Dataflash IC. Releasing the chip select of a previously selected IC completes the
+ *  command it received, starting any resulting internal operation.
+ *
+ *  \param[in] ChipMask  Mask of the Dataflash IC to select, or \ref DATAFLASH_NO_CHIP to deselect all ICs
+ */
+void Dataflash_SelectChip(const uint8_t ChipMask)
+{
+	if (ChipMask == SelectedChipMask)
+	  return;
+
+	for (uint8_t ChipIndex = 0; ChipIndex < DATAFLASH_TOTALCHIPS; ChipIndex++)
+	{
+		DataflashSim_Chip_t* Chip = &Chips[ChipIndex];
+
+		if (SelectedChipMask & (1 << ChipIndex))
+		  DataflashSim_CompleteCommand(Chip);
+
+		Chip->CommandBytes = 0;
+	}
+
+	SelectedChipMask = ChipMask;
+}
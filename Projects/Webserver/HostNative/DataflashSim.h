@@ -0,0 +1,230 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for DataflashSim.c. This provides the board Dataflash driver API of the USBKEY board, with its
+ *  two AT45DB642D Dataflash ICs, on top of a command-level simulation of the Dataflash ICs.
+ */
+
+#ifndef _DATAFLASH_SIM_H_
+#define _DATAFLASH_SIM_H_
+
+	/* Includes: */
+		#include <stdint.h>
+		#include <stdbool.h>
+
+		#include <LUFA/Drivers/Misc/AT45DB642D.h>
+
+	/* Macros: */
+		#if !defined(ATTR_NON_NULL_PTR_ARG)
+			#define ATTR_NON_NULL_PTR_ARG(...)       __attribute__ ((nonnull (__VA_ARGS__)))
+		#endif
+
+		/** Constant indicating the total number of simulated dataflash ICs. */
+		#define DATAFLASH_TOTALCHIPS                 2
+
+		/** Mask for no dataflash chip selected. */
+		#define DATAFLASH_NO_CHIP                    0
+
+		/** Mask for the first dataflash chip selected. */
+		#define DATAFLASH_CHIP1                      (1 << 0)
+
+		/** Mask for the second dataflash chip selected. */
+		#define DATAFLASH_CHIP2                      (1 << 1)
+
+		/** Retrieves the Dataflash chip select mask for the given Dataflash chip index.
+		 *
+		 *  \param[in] index  Index of the dataflash chip mask to retrieve.
+		 *
+		 *  \return Mask for the given Dataflash chip's /CS pin
+		 */
+		#define DATAFLASH_CHIP_MASK(index)           (1 << ((index) - 1))
+
+		/** Internal main memory page size for the simulated dataflash ICs. */
+		#define DATAFLASH_PAGE_SIZE                  1024
+
+		/** Total number of pages inside each of the simulated dataflash ICs. */
+		#define DATAFLASH_PAGES                      8192
+
+		/** Size of each simulated page and SRAM buffer in the standard page size mode, including the spare area. */
+		#define DATAFLASHSIM_FULL_PAGE_SIZE          (DATAFLASH_PAGE_SIZE + (DATAFLASH_PAGE_SIZE / 32))
+
+		/** Time taken to clock one byte over the SPI bus, in nanoseconds (4MHz SPI clock of an 8MHz USBKEY). */
+		#define DATAFLASHSIM_SPI_BYTE_NS             2000
+
+		/** Typical buffer to main memory page program with built-in erase time (tEP), in nanoseconds. */
+		#define DATAFLASHSIM_PROGRAM_ERASE_NS        17000000
+
+		/** Typical buffer to main memory page program without built-in erase time (tP), in nanoseconds. */
+		#define DATAFLASHSIM_PROGRAM_NS              3000000
+
+		/** Typical page erase time (tPE), in nanoseconds. */
+		#define DATAFLASHSIM_PAGE_ERASE_NS           15000000
+
+		/** Main memory page to buffer transfer time (tXFR), in nanoseconds. */
+		#define DATAFLASHSIM_TRANSFER_NS             200000
+
+	/* Type Defines: */
+		/** Type define for the accumulated statistics of the simulated Dataflash ICs. */
+		typedef struct
+		{
+			uint64_t ElapsedNS; /**< Simulated time, in nanoseconds, including time spent waiting on busy ICs */
+			uint64_t BytesTransferred; /**< Total number of bytes clocked over the SPI bus */
+			uint32_t PagePrograms; /**< Number of buffer to main memory page program operations */
+			uint32_t PageErases; /**< Number of standalone page erase operations */
+			uint32_t PageTransfers; /**< Number of main memory page to buffer transfer operations */
+			uint32_t MaxPageWear; /**< Highest number of program and erase cycles seen by any single page */
+			uint32_t BusyViolations; /**< Number of commands issued to an IC while it was busy and unable to accept them */
+		} DataflashSim_Stats_t;
+
+	/* External Variables: */
+		extern DataflashSim_Stats_t DataflashSim_Stats;
+
+	/* Function Prototypes: */
+		void    DataflashSim_Reset(void);
+		void    DataflashSim_ResetStats(void);
+
+		void    Dataflash_Init(void);
+		uint8_t Dataflash_TransferByte(const uint8_t Byte);
+		uint8_t Dataflash_GetSelectedChip(void);
+		void    Dataflash_SelectChip(const uint8_t ChipMask);
+
+	/* Inline Functions: */
+		/** Sends a byte to the currently selected dataflash IC, and ignores the next byte from the dataflash.
+		 *
+		 *  \param[in] Byte  Byte of data to send to the dataflash
+		 */
+		static inline void Dataflash_SendByte(const uint8_t Byte)
+		{
+			Dataflash_TransferByte(Byte);
+		}
+
+		/** Sends a dummy byte to the currently selected dataflash IC, and returns the next byte from the dataflash.
+		 *
+		 *  \return Last response byte from the dataflash
+		 */
+		static inline uint8_t Dataflash_ReceiveByte(void)
+		{
+			return Dataflash_TransferByte(0x00);
+		}
+
+		/** Sends a block of bytes to the currently selected dataflash IC, and ignores the response bytes from the dataflash.
+		 *
+		 *  \param[in] Buffer  Pointer to the data to send to the dataflash
+		 *  \param[in] Length  Number of bytes to send
+		 */
+		static inline void Dataflash_SendBlock(const void* Buffer,
+		                                       const uint16_t Length)
+		{
+			const uint8_t* DataIn = (const uint8_t*)Buffer;
+
+			for (uint16_t ByteNum = 0; ByteNum < Length; ByteNum++)
+			  Dataflash_TransferByte(*(DataIn++));
+		}
+
+		/** Sends dummy bytes to the currently selected dataflash IC, and stores the returned block of bytes from the dataflash.
+		 *
+		 *  \param[out] Buffer  Pointer to a buffer where the data read from the dataflash is to be stored
+		 *  \param[in]  Length  Number of bytes to read
+		 */
+		static inline void Dataflash_ReceiveBlock(void* Buffer,
+		                                          const uint16_t Length)
+		{
+			uint8_t* DataOut = (uint8_t*)Buffer;
+
+			for (uint16_t ByteNum = 0; ByteNum < Length; ByteNum++)
+			  *(DataOut++) = Dataflash_TransferByte(0x00);
+		}
+
+		/** Deselects the current dataflash chip, so that no dataflash is selected. */
+		static inline void Dataflash_DeselectChip(void)
+		{
+			Dataflash_SelectChip(DATAFLASH_NO_CHIP);
+		}
+
+		/** Selects a dataflash IC from the given page number, in the same manner as the USBKEY board driver.
+		 *
+		 *  \param[in] PageAddress  Address of the page to manipulate, ranging from
+		 *                          0 to ((DATAFLASH_PAGES * DATAFLASH_TOTALCHIPS) - 1).
+		 */
+		static inline void Dataflash_SelectChipFromPage(const uint16_t PageAddress)
+		{
+			Dataflash_DeselectChip();
+
+			if (PageAddress >= (DATAFLASH_PAGES * DATAFLASH_TOTALCHIPS))
+			  return;
+
+			if (PageAddress & 0x01)
+			  Dataflash_SelectChip(DATAFLASH_CHIP2);
+			else
+			  Dataflash_SelectChip(DATAFLASH_CHIP1);
+		}
+
+		/** Toggles the select line of the currently selected dataflash IC, so that it is ready to receive
+		 *  a new command.
+		 */
+		static inline void Dataflash_ToggleSelectedChipCS(void)
+		{
+			uint8_t SelectedChipMask = Dataflash_GetSelectedChip();
+
+			Dataflash_DeselectChip();
+			Dataflash_SelectChip(SelectedChipMask);
+		}
+
+		/** Spin-loops while the currently selected dataflash is busy executing a command, such as a main
+		 *  memory page program or main memory to buffer transfer.
+		 */
+		static inline void Dataflash_WaitWhileBusy(void)
+		{
+			Dataflash_ToggleSelectedChipCS();
+			Dataflash_SendByte(DF_CMD_GETSTATUS);
+			while (!(Dataflash_ReceiveByte() & DF_STATUS_READY));
+			Dataflash_ToggleSelectedChipCS();
+		}
+
+		/** Sends a set of page and buffer address bytes to the currently selected dataflash IC, for use with
+		 *  dataflash commands which require a complete 24-bit address.
+		 *
+		 *  \param[in] PageAddress  Page address within the selected dataflash IC
+		 *  \param[in] BufferByte   Address within the dataflash's buffer
+		 */
+		static inline void Dataflash_SendAddressBytes(uint16_t PageAddress,
+		                                              const uint16_t BufferByte)
+		{
+			PageAddress >>= 1;
+
+			Dataflash_SendByte(PageAddress >> 5);
+			Dataflash_SendByte((PageAddress << 3) | (BufferByte >> 8));
+			Dataflash_SendByte(BufferByte);
+		}
+
+#endif
+
@@ -0,0 +1,96 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  File-backed disk image for the host-native build of the Webserver project. This implements the RAM variants of the
+ *  Dataflash block access functions used by the FatFs disk I/O layer, on top of a raw FAT disk image file.
+ */
+
+#include <stdio.h>
+
+#include "NativePlatform.h"
+
+/** Open disk image file, standing in for the board Dataflash. */
+static FILE* DiskImage;
+
+
+/** Opens the given disk image file for use as the virtual Dataflash disk.
+ *
+ *  \param[in] FileName  Path to the raw FAT formatted disk image.
+ *
+ *  \return Boolean \c true if the image was opened, \c false otherwise.
+ */
+bool DiskImage_Init(const char* FileName)
+{
+	if ((DiskImage = fopen(FileName, "r+b")) == NULL)
+	{
+		perror(FileName);
+		return false;
+	}
+
+	return true;
+}
+
+/** Writes blocks from the given RAM buffer to the disk image.
+ *
+ *  \param[in] BlockAddress  Data block starting address for the write sequence.
+ *  \param[in] TotalBlocks   Number of blocks of data to write.
+ *  \param[in] BufferPtr     Pointer to the data source RAM buffer.
+ */
+void DataflashManager_WriteBlocks_RAM(const uint32_t BlockAddress,
+                                      uint16_t TotalBlocks,
+                                      const uint8_t* BufferPtr)
+{
+	fseek(DiskImage, ((long)BlockAddress * VIRTUAL_MEMORY_BLOCK_SIZE), SEEK_SET);
+	fwrite(BufferPtr, VIRTUAL_MEMORY_BLOCK_SIZE, TotalBlocks, DiskImage);
+	fflush(DiskImage);
+}
+
+/** Reads blocks from the disk image into the given RAM buffer. Blocks past the end of the image read as erased
+ *  (all 0xFF) memory, as they would from a blank Dataflash.
+ *
+ *  \param[in]  BlockAddress  Data block starting address for the read sequence.
+ *  \param[in]  TotalBlocks   Number of blocks of data to read.
+ *  \param[out] BufferPtr     Pointer to the data destination RAM buffer.
+ */
+void DataflashManager_ReadBlocks_RAM(const uint32_t BlockAddress,
+                                     uint16_t TotalBlocks,
+                                     uint8_t* BufferPtr)
+{
+	size_t BlocksRead;
+
+	fseek(DiskImage, ((long)BlockAddress * VIRTUAL_MEMORY_BLOCK_SIZE), SEEK_SET);
+	BlocksRead = fread(BufferPtr, VIRTUAL_MEMORY_BLOCK_SIZE, TotalBlocks, DiskImage);
+
+	if (BlocksRead < TotalBlocks)
+	  memset(&BufferPtr[BlocksRead * VIRTUAL_MEMORY_BLOCK_SIZE], 0xFF, ((TotalBlocks - BlocksRead) * VIRTUAL_MEMORY_BLOCK_SIZE));
+}
+
@@ -0,0 +1,65 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Host-native implementation of the uIP clock, derived from the host's monotonic clock in place of the AVR timer
+ *  interrupt used by the firmware.
+ */
+
+#include <time.h>
+
+#include "../Lib/uip/clock.h"
+
+/** Monotonic time at which the clock was initialized, in milliseconds. */
+static uint64_t ClockStartMS;
+
+
+/** Returns the current host monotonic time in milliseconds. */
+static uint64_t clock_monotonic_ms(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+	return (((uint64_t)Now.tv_sec * 1000) + (Now.tv_nsec / 1000000));
+}
+
+//Initialise the clock
+void clock_init()
+{
+	ClockStartMS = clock_monotonic_ms();
+}
+
+//Return time
+clock_time_t clock_time()
+{
+	return (clock_time_t)((clock_monotonic_ms() - ClockStartMS) / (1000 / CLOCK_SECOND));
+}
+
@@ -0,0 +1,123 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for the host-native build of the Webserver project. This provides the subset of the LUFA USB, RNDIS
+ *  and board driver APIs used by the network management code, mapped onto a Linux TAP interface, as well as the
+ *  Dataflash block access functions used by the FatFs disk I/O layer, mapped onto a disk image file.
+ */
+
+#ifndef _NATIVE_PLATFORM_H_
+#define _NATIVE_PLATFORM_H_
+
+	/* Includes: */
+		#include <stdint.h>
+		#include <stdbool.h>
+		#include <string.h>
+
+	/* Macros: */
+		/** Emulated USB mode; the native build always acts as a configured RNDIS device. */
+		#define USB_CurrentMode                                     USB_MODE_Device
+
+		/** Emulated USB device state, which is always configured in the native build. */
+		#define USB_DeviceState                                     DEVICE_STATE_Configured
+
+		/** Emulated USB host state, which is always configured in the native build. */
+		#define USB_HostState                                       HOST_STATE_Configured
+
+		#define USB_MODE_Device                                     1
+		#define USB_MODE_Host                                       2
+		#define DEVICE_STATE_Configured                             1
+		#define HOST_STATE_Configured                               1
+
+		#define RNDIS_Device_IsPacketReceived(RNDISInterfaceInfo)   TAPInterface_IsPacketReceived()
+		#define RNDIS_Device_ReadPacket(RNDISInterfaceInfo, Buffer, PacketLength)  TAPInterface_ReadPacket(Buffer, PacketLength)
+		#define RNDIS_Device_SendPacket(RNDISInterfaceInfo, Buffer, PacketLength)  TAPInterface_SendPacket(Buffer, PacketLength)
+		#define RNDIS_Host_IsPacketReceived(RNDISInterfaceInfo)     TAPInterface_IsPacketReceived()
+		#define RNDIS_Host_ReadPacket(RNDISInterfaceInfo, Buffer, PacketLength)    TAPInterface_ReadPacket(Buffer, PacketLength)
+		#define RNDIS_Host_SendPacket(RNDISInterfaceInfo, Buffer, PacketLength)    TAPInterface_SendPacket(Buffer, PacketLength)
+
+		#define LEDs_SetAllLEDs(LEDMask)
+		#define LEDMASK_USB_READY                                   0
+		#define LEDMASK_USB_BUSY                                    0
+
+		#define ATTR_NON_NULL_PTR_ARG(...)                          __attribute__ ((nonnull (__VA_ARGS__)))
+
+		/** Block size of the emulated Dataflash disk, matching the firmware's virtual memory block size. */
+		#define VIRTUAL_MEMORY_BLOCK_SIZE                           512
+
+	/* Inline Functions: */
+		#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+		/** Host implementation of the BSD \c strlcpy() function provided by AVR-LibC, for C libraries lacking it.
+		 *
+		 *  \param[out] Destination  Destination buffer to copy the string into.
+		 *  \param[in]  Source       Source string to copy.
+		 *  \param[in]  Size         Size of the destination buffer, including the null terminator.
+		 *
+		 *  \return Length of the source string.
+		 */
+		static inline size_t strlcpy(char* Destination,
+		                             const char* Source,
+		                             size_t Size)
+		{
+			size_t SourceLength = strlen(Source);
+
+			if (Size)
+			{
+				size_t CopyLength = (SourceLength >= Size) ? (Size - 1) : SourceLength;
+
+				memcpy(Destination, Source, CopyLength);
+				Destination[CopyLength] = '\0';
+			}
+
+			return SourceLength;
+		}
+		#endif
+
+	/* Function Prototypes: */
+		bool    TAPInterface_Init(const char* InterfaceName);
+		bool    TAPInterface_IsPacketReceived(void);
+		bool    TAPInterface_WaitForPacket(const uint16_t TimeoutMS);
+		uint8_t TAPInterface_ReadPacket(void* Buffer,
+		                                uint16_t* PacketLength);
+		uint8_t TAPInterface_SendPacket(void* Buffer,
+		                                const uint16_t PacketLength);
+
+		bool DiskImage_Init(const char* FileName);
+		void DataflashManager_WriteBlocks_RAM(const uint32_t BlockAddress,
+		                                      uint16_t TotalBlocks,
+		                                      const uint8_t* BufferPtr) ATTR_NON_NULL_PTR_ARG(3);
+		void DataflashManager_ReadBlocks_RAM(const uint32_t BlockAddress,
+		                                     uint16_t TotalBlocks,
+		                                     uint8_t* BufferPtr) ATTR_NON_NULL_PTR_ARG(3);
+
+#endif
+
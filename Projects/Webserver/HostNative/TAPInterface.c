@@ -0,0 +1,173 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Linux TAP network interface driver for the host-native build of the Webserver project. Raw Ethernet frames are
+ *  exchanged with the host network stack through the TAP device, in place of the RNDIS class driver of the firmware.
+ */
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+
+#include "NativePlatform.h"
+
+/** Maximum size of an Ethernet frame exchanged through the TAP interface, excluding the frame checksum. */
+#define TAP_MAX_FRAME_SIZE  1514
+
+/** File descriptor of the open TAP device. */
+static int TAPDevice = -1;
+
+/** Frame most recently received from the TAP device, waiting to be read out by the network stack. */
+static uint8_t ReceivedFrame[TAP_MAX_FRAME_SIZE];
+
+/** Length of the frame in \ref ReceivedFrame, or zero if no frame is pending. */
+static uint16_t ReceivedFrameLength;
+
+
+/** Attaches to the given TAP interface, creating it if it does not already exist.
+ *
+ *  \param[in] InterfaceName  Name of the TAP interface to attach to, such as "tap0".
+ *
+ *  \return Boolean \c true if the interface was attached, \c false otherwise.
+ */
+bool TAPInterface_Init(const char* InterfaceName)
+{
+	struct ifreq InterfaceRequest;
+
+	if ((TAPDevice = open("/dev/net/tun", (O_RDWR | O_NONBLOCK))) < 0)
+	{
+		perror("open /dev/net/tun");
+		return false;
+	}
+
+	memset(&InterfaceRequest, 0, sizeof(InterfaceRequest));
+	InterfaceRequest.ifr_flags = (IFF_TAP | IFF_NO_PI);
+	strncpy(InterfaceRequest.ifr_name, InterfaceName, (IFNAMSIZ - 1));
+
+	if (ioctl(TAPDevice, TUNSETIFF, &InterfaceRequest) < 0)
+	{
+		perror("ioctl TUNSETIFF");
+		close(TAPDevice);
+		TAPDevice = -1;
+		return false;
+	}
+
+	return true;
+}
+
+/** Determines if a frame is waiting to be read from the TAP interface, by attempting a non-blocking read of the next
+ *  frame if none is already pending.
+ *
+ *  \return Boolean \c true if a frame is ready to be read, \c false otherwise.
+ */
+bool TAPInterface_IsPacketReceived(void)
+{
+	if (!(ReceivedFrameLength))
+	{
+		ssize_t BytesRead = read(TAPDevice, ReceivedFrame, sizeof(ReceivedFrame));
+
+		if (BytesRead > 0)
+		  ReceivedFrameLength = BytesRead;
+		else if ((BytesRead < 0) && (errno != EAGAIN))
+		  perror("read TAP");
+	}
+
+	return (ReceivedFrameLength != 0);
+}
+
+/** Waits until a frame is received from the TAP interface or the given timeout elapses, so that the network stack
+ *  can be left idle without polling the interface continuously.
+ *
+ *  \param[in] TimeoutMS  Maximum time to wait for a frame, in milliseconds.
+ *
+ *  \return Boolean \c true if a frame is ready to be read, \c false otherwise.
+ */
+bool TAPInterface_WaitForPacket(const uint16_t TimeoutMS)
+{
+	struct pollfd TAPPoll = {.fd = TAPDevice, .events = POLLIN};
+
+	if (TAPInterface_IsPacketReceived())
+	  return true;
+
+	if ((poll(&TAPPoll, 1, TimeoutMS) < 0) && (errno != EINTR))
+	  perror("poll TAP");
+
+	return TAPInterface_IsPacketReceived();
+}
+
+/** Reads the pending frame from the TAP interface into the given buffer.
+ *
+ *  \param[out] Buffer        Buffer to store the frame into, at least \ref TAP_MAX_FRAME_SIZE bytes in size.
+ *  \param[out] PacketLength  Location to store the length of the read frame, or zero if no frame was pending.
+ *
+ *  \return Always zero, matching the success code of the RNDIS class driver.
+ */
+uint8_t TAPInterface_ReadPacket(void* Buffer,
+                                uint16_t* PacketLength)
+{
+	if (!(TAPInterface_IsPacketReceived()))
+	{
+		*PacketLength = 0;
+		return 0;
+	}
+
+	memcpy(Buffer, ReceivedFrame, ReceivedFrameLength);
+	*PacketLength = ReceivedFrameLength;
+
+	ReceivedFrameLength = 0;
+	return 0;
+}
+
+/** Sends the given frame out through the TAP interface.
+ *
+ *  \param[in] Buffer        Buffer containing the frame to send.
+ *  \param[in] PacketLength  Length of the frame in bytes.
+ *
+ *  \return Zero if the frame was sent, non-zero otherwise.
+ */
+uint8_t TAPInterface_SendPacket(void* Buffer,
+                                const uint16_t PacketLength)
+{
+	if (write(TAPDevice, Buffer, PacketLength) != PacketLength)
+	{
+		perror("write TAP");
+		return 1;
+	}
+
+	return 0;
+}
+
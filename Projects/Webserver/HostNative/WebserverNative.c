@@ -0,0 +1,68 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Main source file for the host-native build of the Webserver project. This runs the project's uIP stack, TCP/IP
+ *  applications and FatFs file system unchanged on a Linux host, attached to a TAP network interface and serving
+ *  files from a FAT disk image, so that the network code can be profiled and load tested without hardware.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "NativePlatform.h"
+#include "../Lib/uIPManagement.h"
+
+/** Main program entry point. The TAP interface name and disk image path may be given as the first and second
+ *  command line arguments respectively.
+ */
+int main(int argc,
+         char* argv[])
+{
+	const char* InterfaceName = (argc > 1) ? argv[1] : "tap0";
+	const char* ImageFileName = (argc > 2) ? argv[2] : "Disk.img";
+
+	if (!(TAPInterface_Init(InterfaceName)) || !(DiskImage_Init(ImageFileName)))
+	  return EXIT_FAILURE;
+
+	uIPManagement_Init();
+
+	printf("Webserver running on %s, serving %s\n", InterfaceName, ImageFileName);
+
+	for (;;)
+	{
+		uIPManagement_ManageNetwork();
+
+		/* Sleep until the next frame arrives or the next uIP timer is due, instead of spinning on the TAP interface */
+		TAPInterface_WaitForPacket(uIPManagement_GetIdleTime() * (1000 / CLOCK_SECOND));
+	}
+}
+
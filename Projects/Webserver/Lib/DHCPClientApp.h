@@ -42,7 +42,7 @@
 		#include <uip.h>
 
 		#include "Config/AppConfig.h"
-		#include "../Webserver.h"
+		#include "uIPManagement.h"
 		#include "DHCPCommon.h"
 
 	/* Enums: */
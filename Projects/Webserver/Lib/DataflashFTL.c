@@ -0,0 +1,691 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Log-structured flash translation layer for the Dataflash storage media. Each logical block has a fixed home
+ *  location in the Dataflash, but writes are not applied to it directly; instead each written block is appended
+ *  to a circular log of pages at the end of its home Dataflash IC, using the first SRAM buffer of each IC as a
+ *  write-back cache for the log page currently being filled. Repeated writes to the same blocks (such as FAT and
+ *  directory updates) are absorbed by the open log pages, and the resulting page programs are spread across the
+ *  log rather than concentrated on a few pages. Pages at the tail of each log are merged back into the home
+ *  locations of their blocks through the second SRAM buffer in the background, once the log starts to fill up.
+ *  Writes covering a whole, aligned Dataflash page gain nothing from the log, and so are instead assembled in the
+ *  second SRAM buffer and programmed straight to their home page, discarding any logged copies of the page's blocks.
+ *
+ *  The logical blocks held in each log page, along with a sequence number, are stored in the page's spare area
+ *  (the bytes above \c DATAFLASH_PAGE_SIZE in the Dataflash's standard page size mode) so that the log map can be
+ *  rebuilt from the Dataflash contents at startup. Each home page programmed by the FTL also records the sequence
+ *  number of the oldest log page which may still hold newer copies of its blocks, so that older log pages are ignored
+ *  for that home page when the log map is rebuilt.
+ */
+
+#define  INCLUDE_FROM_DATAFLASHFTL_C
+#include "DataflashFTL.h"
+
+#if defined(DATAFLASH_FTL) || defined(__DOXYGEN__)
+
+/** Map of the logical blocks held in each slot of each log page, or \ref FTL_UNUSED_ENTRY for slots which hold no
+ *  live data. A logical block has at most one live entry in the map, always within the log of the Dataflash IC
+ *  holding its home page; blocks without an entry are read from their home location.
+ */
+static uint16_t LogMap[FTL_LOG_PAGES * FTL_BLOCKS_PER_PAGE];
+
+/** Position within each Dataflash IC's log of the page currently being assembled in the IC's first SRAM buffer. */
+static uint16_t LogHead[DATAFLASH_TOTALCHIPS];
+
+/** Position within each Dataflash IC's log of the oldest programmed page, or the head position if there are none. */
+static uint16_t LogTail[DATAFLASH_TOTALCHIPS];
+
+/** Number of block slots filled in each Dataflash IC's open log page. */
+static uint8_t  OpenSlotsUsed[DATAFLASH_TOTALCHIPS];
+
+/** Sequence number to store in the next log page to be programmed. */
+static uint32_t LogSequence;
+
+/** Number of consecutive calls to \ref DataflashFTL_Task() since the last block write. */
+static uint16_t IdleTasks;
+
+/** Next logical block expected by the whole page write in progress in the second SRAM buffer of the block's
+ *  Dataflash IC, or \ref FTL_UNUSED_ENTRY if no whole page write is in progress.
+ */
+static uint16_t DirectBlock;
+
+
+/** Searches the log map for the live entry of the given logical block.
+ *
+ *  \param[in] Block  Logical block to search for
+ *
+ *  \return Index of the block's entry in the log map, or \ref FTL_UNUSED_ENTRY if the block is not in the log
+ */
+static uint16_t DataflashFTL_FindEntry(const uint16_t Block)
+{
+	for (uint16_t Entry = 0; Entry < (FTL_LOG_PAGES * FTL_BLOCKS_PER_PAGE); Entry++)
+	{
+		if (LogMap[Entry] == Block)
+		  return Entry;
+	}
+
+	return FTL_UNUSED_ENTRY;
+}
+
+/** Determines if the given log map entry lies within the open log page of its Dataflash IC, and so is currently
+ *  held in the IC's first SRAM buffer rather than in the Dataflash main memory.
+ *
+ *  \param[in] Entry  Index of the log map entry to check
+ *
+ *  \return Boolean \c true if the entry is in an open log page, \c false otherwise
+ */
+static bool DataflashFTL_IsOpenEntry(const uint16_t Entry)
+{
+	uint16_t LogPage = (Entry / FTL_BLOCKS_PER_PAGE);
+	uint8_t  Chip    = (LogPage % DATAFLASH_TOTALCHIPS);
+
+	return (LogPage == FTL_LOG_PAGE_INDEX(Chip, LogHead[Chip]));
+}
+
+/** Selects the Dataflash IC containing the given physical page, and waits until it is ready for a new command.
+ *
+ *  \param[in] Page  Physical Dataflash page that is to be accessed
+ */
+static void DataflashFTL_SelectPage(const uint16_t Page)
+{
+	Dataflash_SelectChipFromPage(Page);
+	Dataflash_WaitWhileBusy();
+}
+
+/** Starts a main memory read of the given physical page, leaving the Dataflash IC selected so that the page data
+ *  can be clocked out with \c Dataflash_ReceiveByte().
+ *
+ *  \param[in] Page      Physical Dataflash page to read from
+ *  \param[in] PageByte  Byte offset within the page to start reading from
+ */
+static void DataflashFTL_StartPageRead(const uint16_t Page,
+                                       const uint16_t PageByte)
+{
+	DataflashFTL_SelectPage(Page);
+	Dataflash_SendByte(DF_CMD_MAINMEMPAGEREAD);
+	Dataflash_SendAddressBytes(Page, PageByte);
+	Dataflash_SendByte(0x00);
+	Dataflash_SendByte(0x00);
+	Dataflash_SendByte(0x00);
+	Dataflash_SendByte(0x00);
+}
+
+/** Reads the FTL metadata from the spare area of the given log page.
+ *
+ *  \param[in]  LogPage   Index of the page within the write log
+ *  \param[out] Sequence  Sequence number the page was programmed with
+ *  \param[out] Blocks    Array of \ref FTL_BLOCKS_PER_PAGE entries, filled with the logical blocks held in the page
+ *
+ *  \return Boolean \c true if the page contains valid FTL metadata, \c false if it is erased or otherwise invalid
+ */
+static bool DataflashFTL_ReadPageHeader(const uint16_t LogPage,
+                                        uint32_t* const Sequence,
+                                        uint16_t* const Blocks)
+{
+	uint16_t Magic;
+	bool     IsValid = true;
+
+	DataflashFTL_StartPageRead(FTL_LOG_FIRST_PAGE + LogPage, DATAFLASH_PAGE_SIZE);
+
+	Magic      = Dataflash_ReceiveByte();
+	Magic     |= ((uint16_t)Dataflash_ReceiveByte() << 8);
+
+	*Sequence  = Dataflash_ReceiveByte();
+	*Sequence |= ((uint32_t)Dataflash_ReceiveByte() << 8);
+	*Sequence |= ((uint32_t)Dataflash_ReceiveByte() << 16);
+	*Sequence |= ((uint32_t)Dataflash_ReceiveByte() << 24);
+
+	for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+	{
+		Blocks[Slot]  = Dataflash_ReceiveByte();
+		Blocks[Slot] |= ((uint16_t)Dataflash_ReceiveByte() << 8);
+
+		/* Blocks may only be logged in the Dataflash IC holding their home page */
+		if ((Blocks[Slot] != FTL_UNUSED_ENTRY) &&
+		    ((Blocks[Slot] >= FTL_LOGICAL_BLOCKS) ||
+		     (((Blocks[Slot] / FTL_BLOCKS_PER_PAGE) % DATAFLASH_TOTALCHIPS) != (LogPage % DATAFLASH_TOTALCHIPS))))
+		{
+			IsValid = false;
+		}
+	}
+
+	Dataflash_DeselectChip();
+
+	return (IsValid && (Magic == FTL_PAGE_MAGIC));
+}
+
+/** Reads the sequence number stored in the spare area of the given home page when it was last programmed by the FTL.
+ *
+ *  \param[in]  HomePage  Physical Dataflash page to read from
+ *  \param[out] Sequence  Sequence number of the oldest log page which may hold newer copies of the page's blocks
+ *
+ *  \return Boolean \c true if the page was programmed by the FTL, \c false otherwise
+ */
+static bool DataflashFTL_ReadHomeHeader(const uint16_t HomePage,
+                                        uint32_t* const Sequence)
+{
+	uint16_t Magic;
+
+	DataflashFTL_StartPageRead(HomePage, DATAFLASH_PAGE_SIZE);
+
+	Magic      = Dataflash_ReceiveByte();
+	Magic     |= ((uint16_t)Dataflash_ReceiveByte() << 8);
+
+	*Sequence  = Dataflash_ReceiveByte();
+	*Sequence |= ((uint32_t)Dataflash_ReceiveByte() << 8);
+	*Sequence |= ((uint32_t)Dataflash_ReceiveByte() << 16);
+	*Sequence |= ((uint32_t)Dataflash_ReceiveByte() << 24);
+
+	Dataflash_DeselectChip();
+
+	return (Magic == FTL_PAGE_MAGIC);
+}
+
+/** Programs the home page assembled in the second SRAM buffer of its Dataflash IC into the Dataflash in the
+ *  background, along with the given sequence number in its spare area.
+ *
+ *  \param[in] HomePage  Physical Dataflash page that is to be programmed
+ *  \param[in] Sequence  Sequence number of the oldest log page which may hold newer copies of the page's blocks
+ */
+static void DataflashFTL_ProgramHomePage(const uint16_t HomePage,
+                                         const uint32_t Sequence)
+{
+	DataflashFTL_SelectPage(HomePage);
+	Dataflash_SendByte(DF_CMD_BUFF2WRITE);
+	Dataflash_SendAddressBytes(0, DATAFLASH_PAGE_SIZE);
+	Dataflash_SendByte(FTL_PAGE_MAGIC & 0xFF);
+	Dataflash_SendByte(FTL_PAGE_MAGIC >> 8);
+	Dataflash_SendByte(Sequence);
+	Dataflash_SendByte(Sequence >> 8);
+	Dataflash_SendByte(Sequence >> 16);
+	Dataflash_SendByte(Sequence >> 24);
+	Dataflash_DeselectChip();
+
+	Dataflash_SelectChipFromPage(HomePage);
+	Dataflash_SendByte(DF_CMD_BUFF2TOMAINMEMWITHERASE);
+	Dataflash_SendAddressBytes(HomePage, 0);
+	Dataflash_DeselectChip();
+}
+
+/** Programs the open log page of the given Dataflash IC from its first SRAM buffer into the Dataflash, along with
+ *  its FTL metadata, and advances the IC's log head to the next free log page. If the IC's log is full, its oldest
+ *  log page is merged back into the home locations of its blocks first.
+ *
+ *  \param[in] Chip  Index of the Dataflash IC whose open log page is to be programmed
+ */
+static void DataflashFTL_CloseOpenPage(const uint8_t Chip)
+{
+	uint16_t LogPage   = FTL_LOG_PAGE_INDEX(Chip, LogHead[Chip]);
+	uint16_t PageEntry = (LogPage * FTL_BLOCKS_PER_PAGE);
+
+	/* Append the page metadata to the buffered page data, in the Dataflash spare area */
+	Dataflash_SelectChipFromPage(FTL_LOG_FIRST_PAGE + LogPage);
+	Dataflash_SendByte(DF_CMD_BUFF1WRITE);
+	Dataflash_SendAddressBytes(0, DATAFLASH_PAGE_SIZE);
+	Dataflash_SendByte(FTL_PAGE_MAGIC & 0xFF);
+	Dataflash_SendByte(FTL_PAGE_MAGIC >> 8);
+	Dataflash_SendByte(LogSequence);
+	Dataflash_SendByte(LogSequence >> 8);
+	Dataflash_SendByte(LogSequence >> 16);
+	Dataflash_SendByte(LogSequence >> 24);
+
+	for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+	{
+		Dataflash_SendByte(LogMap[PageEntry + Slot]);
+		Dataflash_SendByte(LogMap[PageEntry + Slot] >> 8);
+	}
+
+	/* Program the buffer into the log page; this completes in the background while other ICs are accessed */
+	Dataflash_WaitWhileBusy();
+	Dataflash_SendByte(DF_CMD_BUFF1TOMAINMEMWITHERASE);
+	Dataflash_SendAddressBytes(FTL_LOG_FIRST_PAGE + LogPage, 0);
+	Dataflash_DeselectChip();
+
+	LogSequence++;
+	OpenSlotsUsed[Chip] = 0;
+
+	/* The log head must always point to a free page, so make room if the log is now full */
+	uint16_t NextHead = ((LogHead[Chip] + 1) % FTL_LOG_PAGES_PER_CHIP);
+
+	if (NextHead == LogTail[Chip])
+	  DataflashFTL_CollectTail(Chip);
+
+	LogHead[Chip] = NextHead;
+}
+
+/** Copies a logical block from a main memory page into the second SRAM buffer of the same Dataflash IC, through a
+ *  small RAM bounce buffer.
+ *
+ *  \param[in] SourcePage  Physical Dataflash page to copy the block from
+ *  \param[in] SourceByte  Byte offset of the block within the source page
+ *  \param[in] HomePage    Physical Dataflash page being assembled in the SRAM buffer
+ *  \param[in] HomeByte    Byte offset of the block within the home page
+ */
+static void DataflashFTL_CopyBlock(const uint16_t SourcePage,
+                                   const uint16_t SourceByte,
+                                   const uint16_t HomePage,
+                                   const uint16_t HomeByte)
+{
+	for (uint16_t BlockByte = 0; BlockByte < FTL_BLOCK_SIZE; BlockByte += FTL_COPY_CHUNK_SIZE)
+	{
+		uint8_t Chunk[FTL_COPY_CHUNK_SIZE];
+
+		DataflashFTL_StartPageRead(SourcePage, (SourceByte + BlockByte));
+		Dataflash_ReceiveBlock(Chunk, FTL_COPY_CHUNK_SIZE);
+
+		Dataflash_SelectChipFromPage(HomePage);
+		Dataflash_SendByte(DF_CMD_BUFF2WRITE);
+		Dataflash_SendAddressBytes(0, (HomeByte + BlockByte));
+		Dataflash_SendBlock(Chunk, FTL_COPY_CHUNK_SIZE);
+	}
+}
+
+/** Merges all live log entries belonging to the given home page back into it, using the second SRAM buffer of its
+ *  Dataflash IC to assemble the updated page contents. Whichever of the home page or a log page already holds the
+ *  most blocks at their final positions is transferred into the buffer internally by the Dataflash, so that only
+ *  the remaining blocks need to be copied through the MCU. Entries in the open log page are left in the log.
+ *
+ *  \param[in] HomePage  Physical Dataflash page that is to be updated
+ */
+static void DataflashFTL_MergeHomePage(const uint16_t HomePage)
+{
+	uint16_t SlotEntries[FTL_BLOCKS_PER_PAGE];
+	uint16_t BasePage  = HomePage;
+	uint8_t  BaseSlots = 0;
+
+	/* Locate the live entries for each block of the home page, excluding those still held in an SRAM buffer */
+	for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+	{
+		uint16_t Entry = DataflashFTL_FindEntry((HomePage * FTL_BLOCKS_PER_PAGE) + Slot);
+
+		if ((Entry != FTL_UNUSED_ENTRY) && DataflashFTL_IsOpenEntry(Entry))
+		  Entry = FTL_UNUSED_ENTRY;
+
+		SlotEntries[Slot] = Entry;
+
+		if (Entry == FTL_UNUSED_ENTRY)
+		  BaseSlots++;
+	}
+
+	if (BaseSlots == FTL_BLOCKS_PER_PAGE)
+	  return;
+
+	/* Find the log page holding the most blocks at the same position they occupy in the home page */
+	for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+	{
+		uint16_t LogPage      = (SlotEntries[Slot] / FTL_BLOCKS_PER_PAGE);
+		uint8_t  AlignedSlots = 0;
+
+		if ((SlotEntries[Slot] == FTL_UNUSED_ENTRY) || ((SlotEntries[Slot] % FTL_BLOCKS_PER_PAGE) != Slot))
+		  continue;
+
+		for (uint8_t OtherSlot = 0; OtherSlot < FTL_BLOCKS_PER_PAGE; OtherSlot++)
+		{
+			if (SlotEntries[OtherSlot] == ((LogPage * FTL_BLOCKS_PER_PAGE) + OtherSlot))
+			  AlignedSlots++;
+		}
+
+		if (AlignedSlots > BaseSlots)
+		{
+			BasePage  = (FTL_LOG_FIRST_PAGE + LogPage);
+			BaseSlots = AlignedSlots;
+		}
+	}
+
+	/* Transfer the base page into the buffer, then copy over the blocks it does not already hold */
+	if (BaseSlots)
+	{
+		DataflashFTL_SelectPage(HomePage);
+		Dataflash_SendByte(DF_CMD_MAINMEMTOBUFF2);
+		Dataflash_SendAddressBytes(BasePage, 0);
+		Dataflash_DeselectChip();
+	}
+
+	for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+	{
+		uint16_t Entry      = SlotEntries[Slot];
+		uint16_t SourcePage = HomePage;
+		uint16_t SourceByte = (Slot * FTL_BLOCK_SIZE);
+
+		if (Entry != FTL_UNUSED_ENTRY)
+		{
+			SourcePage = (FTL_LOG_FIRST_PAGE + (Entry / FTL_BLOCKS_PER_PAGE));
+			SourceByte = ((Entry % FTL_BLOCKS_PER_PAGE) * FTL_BLOCK_SIZE);
+
+			LogMap[Entry] = FTL_UNUSED_ENTRY;
+		}
+
+		if (BaseSlots && (SourcePage == BasePage) && (SourceByte == (Slot * FTL_BLOCK_SIZE)))
+		  continue;
+
+		DataflashFTL_CopyBlock(SourcePage, SourceByte, HomePage, (Slot * FTL_BLOCK_SIZE));
+	}
+
+	/* Program the merged page back into its home location in the background; only the entries left in the open log
+	 * page, which is programmed with the current or previous sequence number, can be newer than the merged page */
+	DataflashFTL_ProgramHomePage(HomePage, (LogSequence - 1));
+}
+
+/** Reclaims the oldest programmed log page of the given Dataflash IC, by merging its live entries back into their
+ *  home pages. The page is not erased; every block it lists is now held in its home page or a newer log page, so
+ *  replaying its metadata on the next startup is harmless until the page is reused.
+ *
+ *  \param[in] Chip  Index of the Dataflash IC whose log tail is to be reclaimed
+ */
+static void DataflashFTL_CollectTail(const uint8_t Chip)
+{
+	uint16_t PageEntry = (FTL_LOG_PAGE_INDEX(Chip, LogTail[Chip]) * FTL_BLOCKS_PER_PAGE);
+
+	for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+	{
+		if (LogMap[PageEntry + Slot] != FTL_UNUSED_ENTRY)
+		  DataflashFTL_MergeHomePage(LogMap[PageEntry + Slot] / FTL_BLOCKS_PER_PAGE);
+	}
+
+	LogTail[Chip] = ((LogTail[Chip] + 1) % FTL_LOG_PAGES_PER_CHIP);
+}
+
+/** Initializes the FTL, rebuilding the log map from the metadata stored in the log pages of the Dataflash. This
+ *  must be called once after the Dataflash driver has been initialized, before any blocks are read or written.
+ */
+void DataflashFTL_Init(void)
+{
+	uint16_t Blocks[FTL_BLOCKS_PER_PAGE];
+	uint32_t Sequence;
+	uint32_t NewestSequence[DATAFLASH_TOTALCHIPS];
+	bool     LogEmpty[DATAFLASH_TOTALCHIPS];
+
+	for (uint16_t Entry = 0; Entry < (FTL_LOG_PAGES * FTL_BLOCKS_PER_PAGE); Entry++)
+	  LogMap[Entry] = FTL_UNUSED_ENTRY;
+
+	for (uint8_t Chip = 0; Chip < DATAFLASH_TOTALCHIPS; Chip++)
+	{
+		LogHead[Chip]        = 0;
+		OpenSlotsUsed[Chip]  = 0;
+		NewestSequence[Chip] = 0;
+		LogEmpty[Chip]       = true;
+	}
+
+	LogSequence = 0;
+	IdleTasks   = 0;
+	DirectBlock = FTL_UNUSED_ENTRY;
+
+	/* Locate the most recently programmed page in each log; the log head is the free page following it */
+	for (uint16_t LogPage = 0; LogPage < FTL_LOG_PAGES; LogPage++)
+	{
+		uint8_t Chip = (LogPage % DATAFLASH_TOTALCHIPS);
+
+		if (!(DataflashFTL_ReadPageHeader(LogPage, &Sequence, Blocks)))
+		  continue;
+
+		if (LogEmpty[Chip] || (Sequence > NewestSequence[Chip]))
+		{
+			NewestSequence[Chip] = Sequence;
+			LogHead[Chip]        = (((LogPage / DATAFLASH_TOTALCHIPS) + 1) % FTL_LOG_PAGES_PER_CHIP);
+			LogEmpty[Chip]       = false;
+		}
+
+		if (Sequence >= LogSequence)
+		  LogSequence = (Sequence + 1);
+	}
+
+	/* Replay each log's programmed pages from oldest to newest, so that newer entries supersede older ones */
+	for (uint8_t Chip = 0; Chip < DATAFLASH_TOTALCHIPS; Chip++)
+	{
+		LogTail[Chip] = LogHead[Chip];
+
+		if (LogEmpty[Chip])
+		  continue;
+
+		for (uint16_t PageOffset = 1; PageOffset < FTL_LOG_PAGES_PER_CHIP; PageOffset++)
+		{
+			uint16_t Position = ((LogHead[Chip] + PageOffset) % FTL_LOG_PAGES_PER_CHIP);
+			uint16_t LogPage  = FTL_LOG_PAGE_INDEX(Chip, Position);
+
+			if (!(DataflashFTL_ReadPageHeader(LogPage, &Sequence, Blocks)))
+			  continue;
+
+			if (LogTail[Chip] == LogHead[Chip])
+			  LogTail[Chip] = Position;
+
+			for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+			{
+				if (Blocks[Slot] == FTL_UNUSED_ENTRY)
+				  continue;
+
+				uint32_t HomeSequence;
+
+				/* Entries older than the last program of the block's home page have since been superseded by it */
+				if (DataflashFTL_ReadHomeHeader((Blocks[Slot] / FTL_BLOCKS_PER_PAGE), &HomeSequence) &&
+				    (Sequence < HomeSequence))
+				{
+					continue;
+				}
+
+				uint16_t OldEntry = DataflashFTL_FindEntry(Blocks[Slot]);
+
+				if (OldEntry != FTL_UNUSED_ENTRY)
+				  LogMap[OldEntry] = FTL_UNUSED_ENTRY;
+
+				LogMap[(LogPage * FTL_BLOCKS_PER_PAGE) + Slot] = Blocks[Slot];
+			}
+		}
+	}
+}
+
+/** Performs the FTL background tasks; this reclaims the oldest page of any Dataflash IC's log once the log is filled
+ *  to the \c FTL_GC_THRESHOLD level, and programs the open log pages to the Dataflash once no blocks have been
+ *  written for \c FTL_FLUSH_IDLE_TASKS consecutive calls. This should be called frequently from the main program loop.
+ */
+void DataflashFTL_Task(void)
+{
+	/* Whole page writes complete within a single write request, so any still in progress here was aborted */
+	DirectBlock = FTL_UNUSED_ENTRY;
+
+	for (uint8_t Chip = 0; Chip < DATAFLASH_TOTALCHIPS; Chip++)
+	{
+		uint16_t ProgrammedPages = (((LogHead[Chip] + FTL_LOG_PAGES_PER_CHIP) - LogTail[Chip]) % FTL_LOG_PAGES_PER_CHIP);
+
+		/* Reclaim at most one log page per call, to bound the time spent in the task */
+		if (ProgrammedPages >= FTL_GC_THRESHOLD)
+		{
+			DataflashFTL_CollectTail(Chip);
+			return;
+		}
+	}
+
+	if (++IdleTasks >= FTL_FLUSH_IDLE_TASKS)
+	  DataflashFTL_Flush();
+}
+
+/** Programs any open log pages to the Dataflash, so that all previously written blocks will survive a loss of
+ *  power. Until this is called (either explicitly, or by \ref DataflashFTL_Task() once the FTL is idle) the most
+ *  recently written blocks are held only in the SRAM buffers of the Dataflash ICs.
+ */
+void DataflashFTL_Flush(void)
+{
+	for (uint8_t Chip = 0; Chip < DATAFLASH_TOTALCHIPS; Chip++)
+	{
+		if (OpenSlotsUsed[Chip])
+		  DataflashFTL_CloseOpenPage(Chip);
+	}
+
+	IdleTasks = 0;
+}
+
+/** Prepares the Dataflash to receive a logical block of data. After this has been called, exactly
+ *  \ref FTL_BLOCK_SIZE bytes of block data should be sent with \c Dataflash_SendByte(), followed by a call to
+ *  \ref DataflashFTL_EndWrite(). Blocks starting a write of one or more whole, aligned Dataflash pages are written
+ *  straight to their home page rather than to the log.
+ *
+ *  \param[in] Block        Logical block that is to be written, less than \ref FTL_LOGICAL_BLOCKS
+ *  \param[in] TotalBlocks  Number of consecutive blocks remaining in the current write request, including this block
+ */
+void DataflashFTL_BeginWrite(const uint16_t Block,
+                             const uint16_t TotalBlocks)
+{
+	uint16_t HomePage  = (Block / FTL_BLOCKS_PER_PAGE);
+	uint8_t  Chip      = (HomePage % DATAFLASH_TOTALCHIPS);
+	uint16_t LogPage   = FTL_LOG_PAGE_INDEX(Chip, LogHead[Chip]);
+	uint16_t PageEntry = (LogPage * FTL_BLOCKS_PER_PAGE);
+
+	IdleTasks = 0;
+
+	/* Whole pages are assembled in the second SRAM buffer, once any program operation from it has completed */
+	if (!(Block % FTL_BLOCKS_PER_PAGE) && (TotalBlocks >= FTL_BLOCKS_PER_PAGE))
+	{
+		DataflashFTL_SelectPage(HomePage);
+		DirectBlock = Block;
+	}
+
+	if (Block == DirectBlock)
+	{
+		Dataflash_SelectChipFromPage(HomePage);
+		Dataflash_SendByte(DF_CMD_BUFF2WRITE);
+		Dataflash_SendAddressBytes(0, ((Block % FTL_BLOCKS_PER_PAGE) * FTL_BLOCK_SIZE));
+		return;
+	}
+
+	/* Log writes may reuse the second SRAM buffer for merges, so abandon any aborted whole page write */
+	DirectBlock = FTL_UNUSED_ENTRY;
+
+	uint16_t Entry = DataflashFTL_FindEntry(Block);
+
+	/* Blocks already in the open log page are overwritten in the SRAM buffer, otherwise a new slot is used */
+	if ((Entry == FTL_UNUSED_ENTRY) || ((Entry / FTL_BLOCKS_PER_PAGE) != LogPage))
+	{
+		/* A freshly opened page's buffer may still be in use by the program operation of the previous page */
+		if (!(OpenSlotsUsed[Chip]))
+		  DataflashFTL_SelectPage(FTL_LOG_FIRST_PAGE + LogPage);
+
+		if (Entry != FTL_UNUSED_ENTRY)
+		  LogMap[Entry] = FTL_UNUSED_ENTRY;
+
+		/* Prefer the slot matching the block's position in its home page, so that it can be merged without copying */
+		Entry = (PageEntry + (Block % FTL_BLOCKS_PER_PAGE));
+
+		if (LogMap[Entry] != FTL_UNUSED_ENTRY)
+		{
+			Entry = PageEntry;
+
+			while (LogMap[Entry] != FTL_UNUSED_ENTRY)
+			  Entry++;
+		}
+
+		LogMap[Entry] = Block;
+		OpenSlotsUsed[Chip]++;
+	}
+
+	Dataflash_SelectChipFromPage(FTL_LOG_FIRST_PAGE + LogPage);
+	Dataflash_SendByte(DF_CMD_BUFF1WRITE);
+	Dataflash_SendAddressBytes(0, ((Entry - PageEntry) * FTL_BLOCK_SIZE));
+}
+
+/** Completes a logical block write started with \ref DataflashFTL_BeginWrite(), programming the open log page
+ *  to the Dataflash if all of its block slots have now been filled, or the home page of a whole page write once its
+ *  last block has been written.
+ */
+void DataflashFTL_EndWrite(void)
+{
+	Dataflash_DeselectChip();
+
+	if (DirectBlock != FTL_UNUSED_ENTRY)
+	{
+		if (!(++DirectBlock % FTL_BLOCKS_PER_PAGE))
+		{
+			uint16_t HomePage = ((DirectBlock / FTL_BLOCKS_PER_PAGE) - 1);
+			uint8_t  Chip     = (HomePage % DATAFLASH_TOTALCHIPS);
+
+			/* Any logged copies of the page's blocks are now stale, including those in the open log page */
+			for (uint8_t Slot = 0; Slot < FTL_BLOCKS_PER_PAGE; Slot++)
+			{
+				uint16_t Entry = DataflashFTL_FindEntry((HomePage * FTL_BLOCKS_PER_PAGE) + Slot);
+
+				if (Entry == FTL_UNUSED_ENTRY)
+				  continue;
+
+				if (DataflashFTL_IsOpenEntry(Entry))
+				  OpenSlotsUsed[Chip]--;
+
+				LogMap[Entry] = FTL_UNUSED_ENTRY;
+			}
+
+			/* The open log page is programmed with the current sequence number, and so is never superseded */
+			DataflashFTL_ProgramHomePage(HomePage, LogSequence);
+			DirectBlock = FTL_UNUSED_ENTRY;
+		}
+
+		return;
+	}
+
+	for (uint8_t Chip = 0; Chip < DATAFLASH_TOTALCHIPS; Chip++)
+	{
+		if (OpenSlotsUsed[Chip] == FTL_BLOCKS_PER_PAGE)
+		  DataflashFTL_CloseOpenPage(Chip);
+	}
+}
+
+/** Prepares the Dataflash to send a logical block of data, from either an open log page buffer, a programmed log
+ *  page or the block's home location. After this has been called, exactly \ref FTL_BLOCK_SIZE bytes of block data
+ *  should be read with \c Dataflash_ReceiveByte(), followed by a call to \ref DataflashFTL_EndRead().
+ *
+ *  \param[in] Block  Logical block that is to be read, less than \ref FTL_LOGICAL_BLOCKS
+ */
+void DataflashFTL_BeginRead(const uint16_t Block)
+{
+	uint16_t Entry = DataflashFTL_FindEntry(Block);
+
+	if (Entry == FTL_UNUSED_ENTRY)
+	{
+		DataflashFTL_StartPageRead((Block / FTL_BLOCKS_PER_PAGE), ((Block % FTL_BLOCKS_PER_PAGE) * FTL_BLOCK_SIZE));
+	}
+	else if (DataflashFTL_IsOpenEntry(Entry))
+	{
+		/* Open page buffers are never the source of a program operation, so may be read while the IC is busy */
+		Dataflash_SelectChipFromPage(FTL_LOG_FIRST_PAGE + (Entry / FTL_BLOCKS_PER_PAGE));
+		Dataflash_SendByte(DF_CMD_BUFF1READ_LF);
+		Dataflash_SendAddressBytes(0, ((Entry % FTL_BLOCKS_PER_PAGE) * FTL_BLOCK_SIZE));
+	}
+	else
+	{
+		DataflashFTL_StartPageRead((FTL_LOG_FIRST_PAGE + (Entry / FTL_BLOCKS_PER_PAGE)),
+		                           ((Entry % FTL_BLOCKS_PER_PAGE) * FTL_BLOCK_SIZE));
+	}
+}
+
+/** Completes a logical block read started with \ref DataflashFTL_BeginRead(). */
+void DataflashFTL_EndRead(void)
+{
+	Dataflash_DeselectChip();
+}
+
+#endif
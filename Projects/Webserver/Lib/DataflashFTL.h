@@ -0,0 +1,130 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for DataflashFTL.c.
+ */
+
+#ifndef _DATAFLASH_FTL_H_
+#define _DATAFLASH_FTL_H_
+
+	/* Includes: */
+		#if !defined(HOST_NATIVE_BUILD)
+			#include <LUFA/Common/Common.h>
+			#include <LUFA/Drivers/Board/Dataflash.h>
+		#else
+			#include "../HostNative/DataflashSim.h"
+		#endif
+
+		#include "Config/AppConfig.h"
+
+	/* Preprocessor Checks: */
+		#if defined(DATAFLASH_FTL)
+			#if (DATAFLASH_PAGE_SIZE < 512)
+				#error The Dataflash FTL requires a Dataflash page size of at least one 512 byte block.
+			#elif (FTL_LOG_PAGES % DATAFLASH_TOTALCHIPS)
+				#error FTL_LOG_PAGES must be a multiple of the number of Dataflash ICs.
+			#elif ((FTL_LOG_PAGES / DATAFLASH_TOTALCHIPS) < 2)
+				#error FTL_LOG_PAGES must reserve at least 2 log pages in each Dataflash IC.
+			#elif (FTL_GC_THRESHOLD >= (FTL_LOG_PAGES / DATAFLASH_TOTALCHIPS))
+				#error FTL_GC_THRESHOLD must be less than the number of log pages in each Dataflash IC.
+			#endif
+		#endif
+
+	/* Macros: */
+		/** Size of each logical block managed by the FTL, matching the virtual memory block size presented to the host. */
+		#define FTL_BLOCK_SIZE                512
+
+		/** Number of logical blocks stored in each physical Dataflash page. */
+		#define FTL_BLOCKS_PER_PAGE           (DATAFLASH_PAGE_SIZE / FTL_BLOCK_SIZE)
+
+		/** Number of write log pages within each Dataflash IC. */
+		#define FTL_LOG_PAGES_PER_CHIP        (FTL_LOG_PAGES / DATAFLASH_TOTALCHIPS)
+
+		/** Index of the first physical Dataflash page reserved for the FTL write log, at the end of the Dataflash. */
+		#define FTL_LOG_FIRST_PAGE            (((uint16_t)DATAFLASH_PAGES * DATAFLASH_TOTALCHIPS) - FTL_LOG_PAGES)
+
+		/** Total number of logical blocks exposed by the FTL, once the write log pages have been reserved. */
+		#define FTL_LOGICAL_BLOCKS            ((uint16_t)FTL_LOG_FIRST_PAGE * FTL_BLOCKS_PER_PAGE)
+
+		/** Retrieves the index of a log page within the write log, from the Dataflash IC index and the position
+		 *  of the page within that IC's circular log.
+		 *
+		 *  \param[in] Chip      Index of the Dataflash IC, from 0 to \c DATAFLASH_TOTALCHIPS - 1
+		 *  \param[in] Position  Position of the page within the IC's log, from 0 to \ref FTL_LOG_PAGES_PER_CHIP - 1
+		 *
+		 *  \return Index of the page within the write log
+		 */
+		#define FTL_LOG_PAGE_INDEX(Chip, Position)  (((Position) * DATAFLASH_TOTALCHIPS) + (Chip))
+
+		/** Log map entry value indicating a log slot which holds no live logical block. */
+		#define FTL_UNUSED_ENTRY              0xFFFF
+
+		/** Marker stored in the spare area of each programmed log page, to identify it as FTL metadata. */
+		#define FTL_PAGE_MAGIC                0x4654
+
+		/** Size of the RAM bounce buffer used to copy data between pages during garbage collection. */
+		#define FTL_COPY_CHUNK_SIZE           32
+
+	/* Function Prototypes: */
+		void DataflashFTL_Init(void);
+		void DataflashFTL_Task(void);
+		void DataflashFTL_Flush(void);
+		void DataflashFTL_BeginWrite(const uint16_t Block,
+		                             const uint16_t TotalBlocks);
+		void DataflashFTL_EndWrite(void);
+		void DataflashFTL_BeginRead(const uint16_t Block);
+		void DataflashFTL_EndRead(void);
+
+		#if defined(INCLUDE_FROM_DATAFLASHFTL_C) && defined(DATAFLASH_FTL)
+			static uint16_t DataflashFTL_FindEntry(const uint16_t Block);
+			static bool     DataflashFTL_IsOpenEntry(const uint16_t Entry);
+			static void     DataflashFTL_SelectPage(const uint16_t Page);
+			static void     DataflashFTL_StartPageRead(const uint16_t Page,
+			                                           const uint16_t PageByte);
+			static bool     DataflashFTL_ReadPageHeader(const uint16_t LogPage,
+			                                            uint32_t* const Sequence,
+			                                            uint16_t* const Blocks);
+			static bool     DataflashFTL_ReadHomeHeader(const uint16_t HomePage,
+			                                            uint32_t* const Sequence);
+			static void     DataflashFTL_ProgramHomePage(const uint16_t HomePage,
+			                                             const uint32_t Sequence);
+			static void     DataflashFTL_CloseOpenPage(const uint8_t Chip);
+			static void     DataflashFTL_CopyBlock(const uint16_t SourcePage,
+			                                       const uint16_t SourceByte,
+			                                       const uint16_t HomePage,
+			                                       const uint16_t HomeByte);
+			static void     DataflashFTL_MergeHomePage(const uint16_t HomePage);
+			static void     DataflashFTL_CollectTail(const uint8_t Chip);
+		#endif
+
+#endif
+
@@ -39,6 +39,239 @@
 #define  INCLUDE_FROM_DATAFLASHMANAGER_C
 #include "DataflashManager.h"
 
+#if defined(DATAFLASH_FTL)
+#if !defined(HOST_NATIVE_BUILD)
+/** Writes blocks (OS blocks, not Dataflash pages) to the storage medium, the board Dataflash IC(s), from
+ *  the pre-selected data OUT endpoint. This routine reads in OS sized blocks from the endpoint and passes
+ *  them to the Dataflash FTL, which writes whole pages to their home locations and appends other blocks to its
+ *  write log.
+ *
+ *  \param[in] MSInterfaceInfo  Pointer to a structure containing a Mass Storage Class configuration and state
+ *  \param[in] BlockAddress  Data block starting address for the write sequence
+ *  \param[in] TotalBlocks   Number of blocks of data to write
+ */
+void DataflashManager_WriteBlocks(USB_ClassInfo_MS_Device_t* const MSInterfaceInfo,
+                                  const uint32_t BlockAddress,
+                                  uint16_t TotalBlocks)
+{
+	uint16_t CurrBlock = BlockAddress;
+
+	/* Wait until endpoint is ready before continuing */
+	if (Endpoint_WaitUntilReady())
+	  return;
+
+	while (TotalBlocks)
+	{
+		uint8_t BytesInBlockDiv16 = 0;
+
+		/* Select the log slot for the block in the Dataflash buffer */
+		DataflashFTL_BeginWrite(CurrBlock, TotalBlocks);
+
+		/* Write an endpoint packet sized data block to the Dataflash */
+		while (BytesInBlockDiv16 < (VIRTUAL_MEMORY_BLOCK_SIZE >> 4))
+		{
+			/* Check if the endpoint is currently empty */
+			if (!(Endpoint_IsReadWriteAllowed()))
+			{
+				/* Clear the current endpoint bank */
+				Endpoint_ClearOUT();
+
+				/* Wait until the host has sent another packet */
+				if (Endpoint_WaitUntilReady())
+				{
+					DataflashFTL_EndWrite();
+					return;
+				}
+			}
+
+			/* Write one 16-byte chunk of data to the Dataflash */
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+			Dataflash_SendByte(Endpoint_Read_8());
+
+			/* Increment the block 16 byte block counter */
+			BytesInBlockDiv16++;
+
+			/* Check if the current command is being aborted by the host */
+			if (MSInterfaceInfo->State.IsMassStoreReset)
+			{
+				DataflashFTL_EndWrite();
+				return;
+			}
+		}
+
+		/* Hand the completed block over to the FTL */
+		DataflashFTL_EndWrite();
+
+		/* Advance to the next block, decrement the blocks remaining counter */
+		CurrBlock++;
+		TotalBlocks--;
+	}
+
+	/* If the endpoint is empty, clear it ready for the next packet from the host */
+	if (!(Endpoint_IsReadWriteAllowed()))
+	  Endpoint_ClearOUT();
+}
+
+/** Reads blocks (OS blocks, not Dataflash pages) from the storage medium, the board Dataflash IC(s), into
+ *  the pre-selected data IN endpoint. This routine reads in each OS sized block from the location given by
+ *  the Dataflash FTL, and writes them to the endpoint.
+ *
+ *  \param[in] MSInterfaceInfo  Pointer to a structure containing a Mass Storage Class configuration and state
+ *  \param[in] BlockAddress  Data block starting address for the read sequence
+ *  \param[in] TotalBlocks   Number of blocks of data to read
+ */
+void DataflashManager_ReadBlocks(USB_ClassInfo_MS_Device_t* const MSInterfaceInfo,
+                                 const uint32_t BlockAddress,
+                                 uint16_t TotalBlocks)
+{
+	uint16_t CurrBlock = BlockAddress;
+
+	/* Wait until endpoint is ready before continuing */
+	if (Endpoint_WaitUntilReady())
+	  return;
+
+	while (TotalBlocks)
+	{
+		uint8_t BytesInBlockDiv16 = 0;
+
+		/* Start reading the block from its current location */
+		DataflashFTL_BeginRead(CurrBlock);
+
+		/* Read an endpoint packet sized data block from the Dataflash */
+		while (BytesInBlockDiv16 < (VIRTUAL_MEMORY_BLOCK_SIZE >> 4))
+		{
+			/* Check if the endpoint is currently full */
+			if (!(Endpoint_IsReadWriteAllowed()))
+			{
+				/* Clear the endpoint bank to send its contents to the host */
+				Endpoint_ClearIN();
+
+				/* Wait until the endpoint is ready for more data */
+				if (Endpoint_WaitUntilReady())
+				{
+					DataflashFTL_EndRead();
+					return;
+				}
+			}
+
+			/* Read one 16-byte chunk of data from the Dataflash */
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+			Endpoint_Write_8(Dataflash_ReceiveByte());
+
+			/* Increment the block 16 byte block counter */
+			BytesInBlockDiv16++;
+
+			/* Check if the current command is being aborted by the host */
+			if (MSInterfaceInfo->State.IsMassStoreReset)
+			{
+				DataflashFTL_EndRead();
+				return;
+			}
+		}
+
+		DataflashFTL_EndRead();
+
+		/* Advance to the next block, decrement the blocks remaining counter */
+		CurrBlock++;
+		TotalBlocks--;
+	}
+
+	/* If the endpoint is full, send its contents to the host */
+	if (!(Endpoint_IsReadWriteAllowed()))
+	  Endpoint_ClearIN();
+}
+#endif
+
+/** Writes blocks (OS blocks, not Dataflash pages) to the storage medium, the board Dataflash IC(s), from
+ *  the given RAM buffer. This routine passes each OS sized block to the Dataflash FTL, which writes whole
+ *  pages to their home locations and appends other blocks to its write log. This can be linked to FAT
+ *  libraries to write files to the Dataflash.
+ *
+ *  \param[in] BlockAddress  Data block starting address for the write sequence
+ *  \param[in] TotalBlocks   Number of blocks of data to write
+ *  \param[in] BufferPtr     Pointer to the data source RAM buffer
+ */
+void DataflashManager_WriteBlocks_RAM(const uint32_t BlockAddress,
+                                      uint16_t TotalBlocks,
+                                      const uint8_t* BufferPtr)
+{
+	uint16_t CurrBlock = BlockAddress;
+
+	while (TotalBlocks)
+	{
+		DataflashFTL_BeginWrite(CurrBlock, TotalBlocks);
+
+		/* Write one OS sized block of data to the Dataflash */
+		Dataflash_SendBlock(BufferPtr, VIRTUAL_MEMORY_BLOCK_SIZE);
+		BufferPtr += VIRTUAL_MEMORY_BLOCK_SIZE;
+
+		DataflashFTL_EndWrite();
+
+		/* Advance to the next block, decrement the blocks remaining counter */
+		CurrBlock++;
+		TotalBlocks--;
+	}
+}
+
+/** Reads blocks (OS blocks, not Dataflash pages) from the storage medium, the board Dataflash IC(s), into
+ *  the preallocated RAM buffer. This routine reads in each OS sized block from the location given by the
+ *  Dataflash FTL. This can be linked to FAT libraries to read the files stored on the Dataflash.
+ *
+ *  \param[in] BlockAddress  Data block starting address for the read sequence
+ *  \param[in] TotalBlocks   Number of blocks of data to read
+ *  \param[out] BufferPtr    Pointer to the data destination RAM buffer
+ */
+void DataflashManager_ReadBlocks_RAM(const uint32_t BlockAddress,
+                                     uint16_t TotalBlocks,
+                                     uint8_t* BufferPtr)
+{
+	uint16_t CurrBlock = BlockAddress;
+
+	while (TotalBlocks)
+	{
+		DataflashFTL_BeginRead(CurrBlock);
+
+		/* Read one OS sized block of data from the Dataflash */
+		Dataflash_ReceiveBlock(BufferPtr, VIRTUAL_MEMORY_BLOCK_SIZE);
+		BufferPtr += VIRTUAL_MEMORY_BLOCK_SIZE;
+
+		DataflashFTL_EndRead();
+
+		/* Advance to the next block, decrement the blocks remaining counter */
+		CurrBlock++;
+		TotalBlocks--;
+	}
+}
+#else
+#if !defined(HOST_NATIVE_BUILD)
 /** Writes blocks (OS blocks, not Dataflash pages) to the storage medium, the board Dataflash IC(s), from
  *  the pre-selected data OUT endpoint. This routine reads in OS sized blocks from the endpoint and writes
  *  them to the Dataflash in Dataflash page sized blocks.
@@ -284,6 +517,8 @@ void DataflashManager_ReadBlocks(USB_ClassInfo_MS_Device_t* const MSInterfaceInf
 	Dataflash_DeselectChip();
 }
 
+#endif
+
 /** Writes blocks (OS blocks, not Dataflash pages) to the storage medium, the board Dataflash IC(s), from
  *  the given RAM buffer. This routine reads in OS sized blocks from the buffer and writes them to the
  *  Dataflash in Dataflash page sized blocks. This can be linked to FAT libraries to write files to the
@@ -361,8 +596,8 @@ void DataflashManager_WriteBlocks_RAM(const uint32_t BlockAddress,
 			}
 
 			/* Write one 16-byte chunk of data to the Dataflash */
-			for (uint8_t ByteNum = 0; ByteNum < 16; ByteNum++)
-			  Dataflash_SendByte(*(BufferPtr++));
+			Dataflash_SendBlock(BufferPtr, 16);
+			BufferPtr += 16;
 
 			/* Increment the Dataflash page 16 byte block counter */
 			CurrDFPageByteDiv16++;
@@ -440,8 +675,8 @@ void DataflashManager_ReadBlocks_RAM(const uint32_t BlockAddress,
 			}
 
 			/* Read one 16-byte chunk of data from the Dataflash */
-			for (uint8_t ByteNum = 0; ByteNum < 16; ByteNum++)
-			  *(BufferPtr++) = Dataflash_ReceiveByte();
+			Dataflash_ReceiveBlock(BufferPtr, 16);
+			BufferPtr += 16;
 
 			/* Increment the Dataflash page 16 byte block counter */
 			CurrDFPageByteDiv16++;
@@ -458,6 +693,8 @@ void DataflashManager_ReadBlocks_RAM(const uint32_t BlockAddress,
 	Dataflash_DeselectChip();
 }
 
+#endif
+
 /** Disables the Dataflash memory write protection bits on the board Dataflash ICs, if enabled. */
 void DataflashManager_ResetDataflashProtections(void)
 {
@@ -37,13 +37,21 @@
 #define _DATAFLASH_MANAGER_H_
 
 	/* Includes: */
-		#include <avr/io.h>
+		#if !defined(HOST_NATIVE_BUILD)
+			#include <avr/io.h>
 
-		#include "../Descriptors.h"
+			#include "../Descriptors.h"
 
-		#include <LUFA/Common/Common.h>
-		#include <LUFA/Drivers/USB/USB.h>
-		#include <LUFA/Drivers/Board/Dataflash.h>
+			#include <LUFA/Common/Common.h>
+			#include <LUFA/Drivers/USB/USB.h>
+			#include <LUFA/Drivers/Board/Dataflash.h>
+		#else
+			#include "../HostNative/DataflashSim.h"
+		#endif
+
+		#include "Config/AppConfig.h"
+
+		#include "DataflashFTL.h"
 
 	/* Preprocessor Checks: */
 		#if (DATAFLASH_PAGE_SIZE % 16)
@@ -51,8 +59,14 @@
 		#endif
 
 	/* Defines: */
-		/** Total number of bytes of the storage medium, comprised of one or more Dataflash ICs. */
-		#define VIRTUAL_MEMORY_BYTES                ((uint32_t)DATAFLASH_PAGES * DATAFLASH_PAGE_SIZE * DATAFLASH_TOTALCHIPS)
+		#if defined(DATAFLASH_FTL) || defined(__DOXYGEN__)
+			/** Total number of bytes of the storage medium, comprised of one or more Dataflash ICs. When the Dataflash
+			 *  FTL is enabled, this excludes the Dataflash pages reserved for the FTL's write log.
+			 */
+			#define VIRTUAL_MEMORY_BYTES            ((uint32_t)FTL_LOGICAL_BLOCKS * FTL_BLOCK_SIZE)
+		#else
+			#define VIRTUAL_MEMORY_BYTES            ((uint32_t)DATAFLASH_PAGES * DATAFLASH_PAGE_SIZE * DATAFLASH_TOTALCHIPS)
+		#endif
 
 		/** Block size of the device. This is kept at 512 to remain compatible with the OS despite the underlying
 		 *  storage media (Dataflash) using a different native block size. Do not change this value.
@@ -68,12 +82,14 @@
 		#define DISK_READ_ONLY                      false
 
 	/* Function Prototypes: */
+		#if !defined(HOST_NATIVE_BUILD)
 		void DataflashManager_WriteBlocks(USB_ClassInfo_MS_Device_t* const MSInterfaceInfo,
 		                                  const uint32_t BlockAddress,
 		                                  uint16_t TotalBlocks);
 		void DataflashManager_ReadBlocks(USB_ClassInfo_MS_Device_t* const MSInterfaceInfo,
 		                                 const uint32_t BlockAddress,
 		                                 uint16_t TotalBlocks);
+		#endif
 		void DataflashManager_WriteBlocks_RAM(const uint32_t BlockAddress,
 		                                      uint16_t TotalBlocks,
 		                                      const uint8_t* BufferPtr) ATTR_NON_NULL_PTR_ARG(3);
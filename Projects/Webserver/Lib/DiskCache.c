@@ -0,0 +1,281 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Small write-back sector cache, sitting between the FatFs disk I/O layer and the Dataflash manager. Single
+ *  sector transfers, which FatFs issues for its FAT and directory sectors, are serviced from a handful of cached
+ *  sectors in RAM so that repeated accesses to the same sectors do not require a Dataflash page read (or a
+ *  page read-modify-write cycle) each time. Multiple sector transfers are file data, and bypass the cache.
+ */
+
+#define  INCLUDE_FROM_DISKCACHE_C
+#include "DiskCache.h"
+
+#if (DISK_CACHE_SECTORS > 0) || defined(__DOXYGEN__)
+
+/** Cached sectors, each tagged with the sector address it holds and its dirty state. */
+static DiskCache_Line_t DiskCache_Lines[DISK_CACHE_SECTORS];
+
+/** Disk cache hit and miss counters, for tuning the \c DISK_CACHE_SECTORS compile time token to a workload. */
+DiskCache_Stats_t DiskCache_Stats;
+
+
+/** Reads one or more sectors from the disk, servicing single sector reads from the cache where possible.
+ *
+ *  \param[in]  Sector        Address of the first sector to read.
+ *  \param[in]  TotalSectors  Number of sectors to read.
+ *  \param[out] Buffer        Pointer to a buffer where the read sector data is to be stored.
+ */
+void DiskCache_ReadSectors(const uint32_t Sector,
+                           const uint8_t TotalSectors,
+                           uint8_t* Buffer)
+{
+	if (TotalSectors == 1)
+	{
+		DiskCache_Line_t* Line = DiskCache_FindLine(Sector);
+
+		if (Line)
+		{
+			DiskCache_Stats.Hits++;
+		}
+		else
+		{
+			DiskCache_Stats.Misses++;
+
+			Line = DiskCache_AllocateLine(Sector);
+			DataflashManager_ReadBlocks_RAM(Sector, 1, Line->Data);
+		}
+
+		DiskCache_TouchLine(Line);
+		memcpy(Buffer, Line->Data, VIRTUAL_MEMORY_BLOCK_SIZE);
+		return;
+	}
+
+	DiskCache_Stats.Uncached++;
+	DataflashManager_ReadBlocks_RAM(Sector, TotalSectors, Buffer);
+
+	/* Overlay any cached sectors in the read range which are newer than their copies in the Dataflash */
+	for (uint8_t i = 0; i < DISK_CACHE_SECTORS; i++)
+	{
+		DiskCache_Line_t* Line = &DiskCache_Lines[i];
+
+		if (Line->IsValid && Line->IsDirty && ((Line->Sector - Sector) < TotalSectors))
+		  memcpy(&Buffer[(uint16_t)(Line->Sector - Sector) * VIRTUAL_MEMORY_BLOCK_SIZE], Line->Data, VIRTUAL_MEMORY_BLOCK_SIZE);
+	}
+}
+
+/** Writes one or more sectors to the disk. Single sector writes are held in the cache until the cached sector
+ *  is evicted or the cache is flushed; multiple sector writes are written straight through to the Dataflash.
+ *
+ *  \param[in] Sector        Address of the first sector to write.
+ *  \param[in] TotalSectors  Number of sectors to write.
+ *  \param[in] Buffer        Pointer to a buffer containing the sector data to write.
+ */
+void DiskCache_WriteSectors(const uint32_t Sector,
+                            const uint8_t TotalSectors,
+                            const uint8_t* Buffer)
+{
+	if (TotalSectors == 1)
+	{
+		DiskCache_Line_t* Line = DiskCache_FindLine(Sector);
+
+		if (Line)
+		{
+			DiskCache_Stats.Hits++;
+		}
+		else
+		{
+			DiskCache_Stats.Misses++;
+			Line = DiskCache_AllocateLine(Sector);
+		}
+
+		memcpy(Line->Data, Buffer, VIRTUAL_MEMORY_BLOCK_SIZE);
+		Line->IsDirty = true;
+
+		DiskCache_TouchLine(Line);
+		return;
+	}
+
+	DiskCache_Stats.Uncached++;
+	DataflashManager_WriteBlocks_RAM(Sector, TotalSectors, Buffer);
+
+	/* Refresh any cached copies of the written sectors, which now match their copies in the Dataflash */
+	for (uint8_t i = 0; i < DISK_CACHE_SECTORS; i++)
+	{
+		DiskCache_Line_t* Line = &DiskCache_Lines[i];
+
+		if (Line->IsValid && ((Line->Sector - Sector) < TotalSectors))
+		{
+			memcpy(Line->Data, &Buffer[(uint16_t)(Line->Sector - Sector) * VIRTUAL_MEMORY_BLOCK_SIZE], VIRTUAL_MEMORY_BLOCK_SIZE);
+			Line->IsDirty = false;
+		}
+	}
+}
+
+/** Writes back all dirty cached sectors to the Dataflash, in ascending sector order. This should be called
+ *  whenever the disk contents must be consistent in the Dataflash, such as on a FatFs \c CTRL_SYNC request or
+ *  before the disk is accessed by means other than the cache.
+ */
+void DiskCache_Flush(void)
+{
+	for (;;)
+	{
+		DiskCache_Line_t* LowestDirtyLine = NULL;
+
+		for (uint8_t i = 0; i < DISK_CACHE_SECTORS; i++)
+		{
+			DiskCache_Line_t* Line = &DiskCache_Lines[i];
+
+			if (!(Line->IsValid && Line->IsDirty))
+			  continue;
+
+			if (!(LowestDirtyLine) || (Line->Sector < LowestDirtyLine->Sector))
+			  LowestDirtyLine = Line;
+		}
+
+		if (!(LowestDirtyLine))
+		  break;
+
+		DiskCache_WriteBackLine(LowestDirtyLine);
+	}
+}
+
+/** Discards any cached copies of the given sector range, without writing them back. This must be called after
+ *  the disk has been written to by means other than the cache, such as by the USB mass storage host, so that
+ *  stale sector data is not returned to (or later written back by) the file system.
+ *
+ *  \param[in] Sector        Address of the first sector to invalidate.
+ *  \param[in] TotalSectors  Number of sectors to invalidate.
+ */
+void DiskCache_Invalidate(const uint32_t Sector,
+                          const uint16_t TotalSectors)
+{
+	for (uint8_t i = 0; i < DISK_CACHE_SECTORS; i++)
+	{
+		DiskCache_Line_t* Line = &DiskCache_Lines[i];
+
+		if (Line->IsValid && ((Line->Sector - Sector) < TotalSectors))
+		  Line->IsValid = false;
+	}
+}
+
+/** Resets the disk cache statistics counters to zero. */
+void DiskCache_ResetStats(void)
+{
+	memset(&DiskCache_Stats, 0x00, sizeof(DiskCache_Stats));
+}
+
+/** Searches the cache for a given sector.
+ *
+ *  \param[in] Sector  Address of the sector to search for.
+ *
+ *  \return Pointer to the cache line holding the sector if cached, \c NULL otherwise.
+ */
+static DiskCache_Line_t* DiskCache_FindLine(const uint32_t Sector)
+{
+	for (uint8_t i = 0; i < DISK_CACHE_SECTORS; i++)
+	{
+		DiskCache_Line_t* Line = &DiskCache_Lines[i];
+
+		if (Line->IsValid && (Line->Sector == Sector))
+		  return Line;
+	}
+
+	return NULL;
+}
+
+/** Allocates a cache line for the given sector, evicting the least recently used sector if no free line
+ *  exists. A dirty evicted sector is written back to the Dataflash before its line is reused.
+ *
+ *  \param[in] Sector  Address of the sector the cache line is to hold.
+ *
+ *  \return Pointer to the allocated cache line, whose data must be filled by the caller.
+ */
+static DiskCache_Line_t* DiskCache_AllocateLine(const uint32_t Sector)
+{
+	DiskCache_Line_t* Victim = &DiskCache_Lines[0];
+
+	for (uint8_t i = 0; i < DISK_CACHE_SECTORS; i++)
+	{
+		DiskCache_Line_t* Line = &DiskCache_Lines[i];
+
+		if (!(Line->IsValid))
+		{
+			Victim = Line;
+			break;
+		}
+
+		if (Line->Age > Victim->Age)
+		  Victim = Line;
+	}
+
+	if (Victim->IsValid && Victim->IsDirty)
+	  DiskCache_WriteBackLine(Victim);
+
+	Victim->Sector  = Sector;
+	Victim->IsValid = true;
+	Victim->IsDirty = false;
+
+	return Victim;
+}
+
+/** Marks a cache line as the most recently used, ageing all other cache lines. Line ages saturate, so that
+ *  lines which have not been used for a long time are all considered equally old.
+ *
+ *  \param[in,out] Line  Pointer to the cache line which has just been accessed.
+ */
+static void DiskCache_TouchLine(DiskCache_Line_t* const Line)
+{
+	for (uint8_t i = 0; i < DISK_CACHE_SECTORS; i++)
+	{
+		DiskCache_Line_t* CurrLine = &DiskCache_Lines[i];
+
+		if (CurrLine->Age < 0xFF)
+		  CurrLine->Age++;
+	}
+
+	Line->Age = 0;
+}
+
+/** Writes a dirty cache line's sector data back to the Dataflash, marking it as clean.
+ *
+ *  \param[in,out] Line  Pointer to the dirty cache line to write back.
+ */
+static void DiskCache_WriteBackLine(DiskCache_Line_t* const Line)
+{
+	DataflashManager_WriteBlocks_RAM(Line->Sector, 1, Line->Data);
+
+	Line->IsDirty = false;
+	DiskCache_Stats.WriteBacks++;
+}
+
+#endif
+
@@ -0,0 +1,116 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2017  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for DiskCache.c.
+ */
+
+#ifndef _DISK_CACHE_H_
+#define _DISK_CACHE_H_
+
+	/* Includes: */
+		#include <stdint.h>
+		#include <stdbool.h>
+		#include <string.h>
+
+		#if !defined(HOST_NATIVE_BUILD)
+			#include "DataflashManager.h"
+		#else
+			#include "../HostNative/NativePlatform.h"
+		#endif
+
+		#include "Config/AppConfig.h"
+
+	/* Preprocessor Checks: */
+		#if !defined(DISK_CACHE_SECTORS)
+			#define DISK_CACHE_SECTORS            0
+		#elif (DISK_CACHE_SECTORS > 255)
+			#error DISK_CACHE_SECTORS must be 255 or less.
+		#endif
+
+	/* Type Defines: */
+		/** Type define for the disk cache statistics, used to tune the number of cached sectors for a given workload. */
+		typedef struct
+		{
+			uint32_t Hits; /**< Number of single sector reads and writes serviced from a cached sector. */
+			uint32_t Misses; /**< Number of single sector reads and writes which required a cache line to be (re)filled. */
+			uint32_t WriteBacks; /**< Number of dirty cached sectors written back to the Dataflash. */
+			uint32_t Uncached; /**< Number of multiple sector transfers which bypassed the cache. */
+		} DiskCache_Stats_t;
+
+	/* Public Interface - May be used in end-application: */
+		#if (DISK_CACHE_SECTORS > 0) || defined(__DOXYGEN__)
+			/* External Variables: */
+				extern DiskCache_Stats_t DiskCache_Stats;
+
+			/* Function Prototypes: */
+				void DiskCache_ReadSectors(const uint32_t Sector,
+				                           const uint8_t TotalSectors,
+				                           uint8_t* Buffer) ATTR_NON_NULL_PTR_ARG(3);
+				void DiskCache_WriteSectors(const uint32_t Sector,
+				                            const uint8_t TotalSectors,
+				                            const uint8_t* Buffer) ATTR_NON_NULL_PTR_ARG(3);
+				void DiskCache_Flush(void);
+				void DiskCache_Invalidate(const uint32_t Sector,
+				                          const uint16_t TotalSectors);
+				void DiskCache_ResetStats(void);
+		#else
+			/* Macros: */
+				#define DiskCache_ReadSectors(Sector, TotalSectors, Buffer)   DataflashManager_ReadBlocks_RAM(Sector, TotalSectors, Buffer)
+				#define DiskCache_WriteSectors(Sector, TotalSectors, Buffer)  DataflashManager_WriteBlocks_RAM(Sector, TotalSectors, Buffer)
+				#define DiskCache_Flush()                                     do { } while (0)
+				#define DiskCache_Invalidate(Sector, TotalSectors)            do { } while (0)
+				#define DiskCache_ResetStats()                                do { } while (0)
+		#endif
+
+	/* Private Interface - For use in library only: */
+	#if !defined(__DOXYGEN__)
+		/* Type Defines: */
+			typedef struct
+			{
+				uint32_t Sector;
+				bool     IsValid;
+				bool     IsDirty;
+				uint8_t  Age;
+				uint8_t  Data[VIRTUAL_MEMORY_BLOCK_SIZE];
+			} DiskCache_Line_t;
+
+		/* Function Prototypes: */
+			#if defined(INCLUDE_FROM_DISKCACHE_C) && (DISK_CACHE_SECTORS > 0)
+				static DiskCache_Line_t* DiskCache_FindLine(const uint32_t Sector);
+				static DiskCache_Line_t* DiskCache_AllocateLine(const uint32_t Sector);
+				static void DiskCache_TouchLine(DiskCache_Line_t* const Line);
+				static void DiskCache_WriteBackLine(DiskCache_Line_t* const Line);
+			#endif
+	#endif
+
+#endif
+
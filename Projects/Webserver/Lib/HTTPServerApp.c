@@ -56,6 +56,17 @@ const char PROGMEM HTTP404Header[] = "HTTP/1.1 404 Not Found\r\n"
                                      "Content-Type: text/plain\r\n\r\n"
                                      "Error 404: File Not Found: /";
 
+/** HTTP server response header, for transmission when all shared file handles are in use. This indicates to the host that
+ *  the server is temporarily unable to serve the request, and that it should be retried later.
+ */
+const char PROGMEM HTTP503Header[] = "HTTP/1.1 503 Service Unavailable\r\n"
+                                     "Server: LUFA " LUFA_VERSION_STRING "\r\n"
+                                     "Connection: close\r\n"
+                                     "Retry-After: 1\r\n"
+                                     "MIME-version: 1.0\r\n"
+                                     "Content-Type: text/plain\r\n\r\n"
+                                     "Error 503: Service Unavailable";
+
 /** Default filename to fetch when a directory is requested */
 const char PROGMEM DefaultDirFileName[] = "index.htm";
 
@@ -80,6 +91,9 @@ const MIME_Type_t MIMETypes[] =
 /** FATFs structure to hold the internal state of the FAT driver for the Dataflash contents. */
 FATFS DiskFATState;
 
+/** Pool of open file handles, shared between all HTTP connections serving the same file. */
+static HTTP_SharedFile_t SharedFiles[MAX_OPEN_FILES];
+
 
 /** Initialization function for the simple HTTP webserver. */
 void HTTPServerApp_Init(void)
@@ -103,6 +117,9 @@ void HTTPServerApp_Callback(void)
 		/* Lock to the closed state so that no further processing will occur on the connection */
 		AppState->HTTPServer.CurrentState  = WEBSERVER_STATE_Closing;
 		AppState->HTTPServer.NextState     = WEBSERVER_STATE_Closing;
+
+		/* Release the connection's file handle now, as no further events will be received for the connection */
+		HTTPServerApp_CloseSharedFile(AppState);
 	}
 
 	if (uip_connected())
@@ -110,7 +127,7 @@ void HTTPServerApp_Callback(void)
 		/* New connection - initialize connection state values */
 		AppState->HTTPServer.CurrentState  = WEBSERVER_STATE_OpenRequestedFile;
 		AppState->HTTPServer.NextState     = WEBSERVER_STATE_OpenRequestedFile;
-		AppState->HTTPServer.FileOpen      = false;
+		AppState->HTTPServer.FileIndex     = HTTP_FILE_NOT_FOUND;
 		AppState->HTTPServer.ACKedFilePos  = 0;
 		AppState->HTTPServer.SentChunkSize = 0;
 	}
@@ -124,12 +141,6 @@ void HTTPServerApp_Callback(void)
 		AppState->HTTPServer.CurrentState = AppState->HTTPServer.NextState;
 	}
 
-	if (uip_rexmit())
-	{
-		/* Return file pointer to the last ACKed position */
-		f_lseek(&AppState->HTTPServer.FileHandle, AppState->HTTPServer.ACKedFilePos);
-	}
-
 	if (uip_rexmit() || uip_acked() || uip_newdata() || uip_connected() || uip_poll())
 	{
 		switch (AppState->HTTPServer.CurrentState)
@@ -145,8 +156,7 @@ void HTTPServerApp_Callback(void)
 				break;
 			case WEBSERVER_STATE_Closing:
 				/* Connection is being terminated for some reason - close file handle */
-				f_close(&AppState->HTTPServer.FileHandle);
-				AppState->HTTPServer.FileOpen = false;
+				HTTPServerApp_CloseSharedFile(AppState);
 
 				/* If connection is not already closed, close it */
 				uip_close();
@@ -194,12 +204,14 @@ static void HTTPServerApp_OpenRequestedFile(void)
 	}
 
 	/* Try to open the file from the Dataflash disk */
-	AppState->HTTPServer.FileOpen     = (f_open(&AppState->HTTPServer.FileHandle, AppState->HTTPServer.FileName,
-	                                            (FA_OPEN_EXISTING | FA_READ)) == FR_OK);
+	AppState->HTTPServer.FileIndex    = HTTPServerApp_OpenSharedFile(AppState->HTTPServer.FileName);
 
 	/* Lock to the SendResponseHeader state until connection terminated */
 	AppState->HTTPServer.CurrentState = WEBSERVER_STATE_SendResponseHeader;
 	AppState->HTTPServer.NextState    = WEBSERVER_STATE_SendResponseHeader;
+
+	/* Nothing was sent in response to the request, so the response header must be sent on the next connection poll */
+	uIPManagement_SetConnectionReady();
 }
 
 /** HTTP Server State handler for the HTTP Response Header Send state. This state manages the transmission of
@@ -213,8 +225,19 @@ static void HTTPServerApp_SendResponseHeader(void)
 	char* Extension     = strpbrk(AppState->HTTPServer.FileName, ".");
 	bool  FoundMIMEType = false;
 
+	/* If no free shared file handle was available, send back a 503 error response and abort */
+	if (AppState->HTTPServer.FileIndex == HTTP_FILE_UNAVAILABLE)
+	{
+		/* Copy over the HTTP 503 response header and send it to the receiving client */
+		strcpy_P(AppData, HTTP503Header);
+		uip_send(AppData, strlen(AppData));
+
+		AppState->HTTPServer.NextState = WEBSERVER_STATE_Closing;
+		return;
+	}
+
 	/* If the file isn't already open, it wasn't found - send back a 404 error response and abort */
-	if (!(AppState->HTTPServer.FileOpen))
+	if (AppState->HTTPServer.FileIndex == HTTP_FILE_NOT_FOUND)
 	{
 		/* Copy over the HTTP 404 response header and send it to the receiving client */
 		strcpy_P(AppData, HTTP404Header);
@@ -268,11 +291,17 @@ static void HTTPServerApp_SendData(void)
 	uip_tcp_appstate_t* const AppState    = &uip_conn->appstate;
 	char*               const AppData     = (char*)uip_appdata;
 
+	FIL*                const FileHandle  = &SharedFiles[AppState->HTTPServer.FileIndex].FileHandle;
+
 	/* Get the maximum segment size for the current packet */
 	uint16_t MaxChunkSize = uip_mss();
 
+	/* Move the shared file pointer to the last ACKed position, if it was moved by a retransmission or another connection */
+	if (FileHandle->fptr != AppState->HTTPServer.ACKedFilePos)
+	  f_lseek(FileHandle, AppState->HTTPServer.ACKedFilePos);
+
 	/* Read the next chunk of data from the open file */
-	f_read(&AppState->HTTPServer.FileHandle, AppData, MaxChunkSize, &AppState->HTTPServer.SentChunkSize);
+	f_read(FileHandle, AppData, MaxChunkSize, &AppState->HTTPServer.SentChunkSize);
 
 	/* Send the next file chunk to the receiving client */
 	uip_send(AppData, AppState->HTTPServer.SentChunkSize);
@@ -282,3 +311,67 @@ static void HTTPServerApp_SendData(void)
 	  AppState->HTTPServer.NextState = WEBSERVER_STATE_Closing;
 }
 
+
+/** Opens the given file from the Dataflash disk, sharing an existing handle in the open file pool if another connection
+ *  is already serving the same file.
+ *
+ *  \param[in] FileName  Name of the file to open on the disk.
+ *
+ *  \return Index of the file's entry in the shared file pool, \ref HTTP_FILE_NOT_FOUND if the file could not be opened,
+ *          or \ref HTTP_FILE_UNAVAILABLE if all entries of the shared file pool are in use.
+ */
+static uint8_t HTTPServerApp_OpenSharedFile(const char* FileName)
+{
+	FIL     NewFileHandle;
+	uint8_t FreeIndex = HTTP_FILE_UNAVAILABLE;
+
+	if (f_open(&NewFileHandle, FileName, (FA_OPEN_EXISTING | FA_READ)) != FR_OK)
+	  return HTTP_FILE_NOT_FOUND;
+
+	for (uint8_t i = 0; i < MAX_OPEN_FILES; i++)
+	{
+		FIL* const PoolFileHandle = &SharedFiles[i].FileHandle;
+
+		if (!(SharedFiles[i].RefCount))
+		{
+			/* Remember the first unused pool entry, in case no existing handle for the file is found */
+			if (FreeIndex == HTTP_FILE_UNAVAILABLE)
+			  FreeIndex = i;
+
+			continue;
+		}
+
+		/* Files with the same starting cluster and size on the mounted volume are the same file */
+		if ((PoolFileHandle->sclust == NewFileHandle.sclust) && (PoolFileHandle->fsize == NewFileHandle.fsize))
+		{
+			SharedFiles[i].RefCount++;
+			return i;
+		}
+	}
+
+	if (FreeIndex != HTTP_FILE_UNAVAILABLE)
+	{
+		SharedFiles[FreeIndex].FileHandle = NewFileHandle;
+		SharedFiles[FreeIndex].RefCount   = 1;
+	}
+
+	return FreeIndex;
+}
+
+/** Releases the given connection's reference to its entry in the shared file pool, closing the file once the last
+ *  connection serving it has released it.
+ *
+ *  \param[in,out] AppState  Application state of the connection whose file reference is to be released.
+ */
+static void HTTPServerApp_CloseSharedFile(uip_tcp_appstate_t* const AppState)
+{
+	uint8_t FileIndex = AppState->HTTPServer.FileIndex;
+
+	if (FileIndex >= MAX_OPEN_FILES)
+	  return;
+
+	if (!(--SharedFiles[FileIndex].RefCount))
+	  f_close(&SharedFiles[FileIndex].FileHandle);
+
+	AppState->HTTPServer.FileIndex = HTTP_FILE_NOT_FOUND;
+}
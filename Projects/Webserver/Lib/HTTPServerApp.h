@@ -47,6 +47,8 @@
 		#include <uip.h>
 		#include <ff.h>
 
+		#include "uIPManagement.h"
+
 	/* Enums: */
 		/** States for each HTTP connection to the webserver. */
 		enum Webserver_States_t
@@ -66,9 +68,27 @@
 			char* MIMEType;  /**< Appropriate MIME type to send when the extension is encountered */
 		} MIME_Type_t;
 
+		/** Type define for an entry in the shared open file pool. */
+		typedef struct
+		{
+			FIL     FileHandle; /**< FatFs handle of the open file, shared between all connections serving the file */
+			uint8_t RefCount; /**< Number of connections currently serving the file, zero if the entry is unused */
+		} HTTP_SharedFile_t;
+
 	/* Macros: */
 		/** TCP listen port for incoming HTTP traffic. */
-		#define HTTP_SERVER_PORT  80
+		#define HTTP_SERVER_PORT       80
+
+		/** Shared file pool index of a connection with no open file, due to the requested file not being found. */
+		#define HTTP_FILE_NOT_FOUND    0xFF
+
+		/** Shared file pool index of a connection with no open file, due to all shared file handles being in use. */
+		#define HTTP_FILE_UNAVAILABLE  0xFE
+
+	/* Preprocessor Checks: */
+		#if (MAX_OPEN_FILES >= HTTP_FILE_UNAVAILABLE)
+			#error MAX_OPEN_FILES must be less than 254.
+		#endif
 
 	/* Function Prototypes: */
 		void HTTPServerApp_Init(void);
@@ -78,6 +98,8 @@
 			static void HTTPServerApp_OpenRequestedFile(void);
 			static void HTTPServerApp_SendResponseHeader(void);
 			static void HTTPServerApp_SendData(void);
+			static uint8_t HTTPServerApp_OpenSharedFile(const char* FileName);
+			static void HTTPServerApp_CloseSharedFile(uip_tcp_appstate_t* const AppState);
 		#endif
 
 #endif
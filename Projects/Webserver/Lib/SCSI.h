@@ -44,6 +44,7 @@
 
 		#include "../Descriptors.h"
 		#include "DataflashManager.h"
+		#include "DiskCache.h"
 
 	/* Macros: */
 		/** Macro to set the current SCSI sense data to the given key, additional sense code and additional sense qualifier. This
@@ -48,6 +48,9 @@ const char PROGMEM WelcomeHeader[] = "******************************************
 const char PROGMEM TELNETMenu[] = "\r\n"
                                   "  == Available Commands: ==\r\n"
                                   "     c) List Active TCP Connections\r\n"
+#if (DISK_CACHE_SECTORS > 0)
+                                  "     d) Display Disk Cache Statistics\r\n"
+#endif
                                   "  =========================\r\n"
                                   "\r\n>";
 
@@ -107,6 +110,9 @@ void TELNETServerApp_Callback(void)
 				AppState->TELNETServer.IssuedCommand = AppData[0];
 
 				AppState->TELNETServer.CurrentState  = TELNET_STATE_SendResponse;
+
+				/* Response is sent on the next connection poll, once the command data has been consumed */
+				uIPManagement_SetConnectionReady();
 				break;
 			case TELNET_STATE_SendResponse:
 				/* Determine which command was issued, perform command processing */
@@ -115,6 +121,11 @@ void TELNETServerApp_Callback(void)
 					case 'c':
 						TELNETServerApp_DisplayTCPConnections();
 						break;
+#if (DISK_CACHE_SECTORS > 0)
+					case 'd':
+						TELNETServerApp_DisplayDiskCacheStats();
+						break;
+#endif
 					default:
 						strcpy_P(AppData, PSTR("Invalid Command.\r\n"));
 						uip_send(AppData, strlen(AppData));
@@ -159,5 +170,25 @@ static void TELNETServerApp_DisplayTCPConnections(void)
 	uip_send(AppData, ResponseLen);
 }
 
+#if (DISK_CACHE_SECTORS > 0)
+/** Sends the disk cache statistics accumulated since the last time they were displayed to the TELNET client. */
+static void TELNETServerApp_DisplayDiskCacheStats(void)
+{
+	char* const AppData = (char*)uip_appdata;
+
+	uint16_t ResponseLen = sprintf_P(AppData, PSTR("\r\n* Disk Cache (%u Sectors): *\r\n"
+	                                               "Hits: %lu, Misses: %lu, Write-Backs: %lu, Uncached: %lu\r\n"),
+	                                 DISK_CACHE_SECTORS,
+	                                 (unsigned long)DiskCache_Stats.Hits,
+	                                 (unsigned long)DiskCache_Stats.Misses,
+	                                 (unsigned long)DiskCache_Stats.WriteBacks,
+	                                 (unsigned long)DiskCache_Stats.Uncached);
+
+	DiskCache_ResetStats();
+
+	uip_send(AppData, ResponseLen);
+}
+#endif
+
 #endif
 
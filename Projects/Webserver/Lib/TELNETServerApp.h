@@ -45,6 +45,9 @@
 
 		#include "Config/AppConfig.h"
 
+		#include "uIPManagement.h"
+		#include "DiskCache.h"
+
 	/* Macros: */
 		/** TCP listen port for incoming TELNET traffic. */
 		#define TELNET_SERVER_PORT  23
@@ -65,6 +68,10 @@
 
 		#if defined(INCLUDE_FROM_TELNETSERVERAPP_C)
 			static void TELNETServerApp_DisplayTCPConnections(void);
+
+			#if (DISK_CACHE_SECTORS > 0)
+				static void TELNETServerApp_DisplayDiskCacheStats(void);
+			#endif
 		#endif
 
 #endif
@@ -43,6 +43,11 @@ static struct timer ConnectionTimer;
 /** ARP timer, to retain the time elapsed since the ARP cache was last updated. */
 static struct timer ARPTimer;
 
+/** Ready list of TCP connections, as a bitmask indexed by connection slot. Each set bit indicates that the
+ *  associated connection's application has deferred work pending, and must be polled on the next management pass.
+ */
+static uint8_t ReadyConnections[(UIP_CONNS + 7) / 8];
+
 /** MAC address of the RNDIS device, when enumerated. */
 struct uip_eth_addr MACAddress;
 
@@ -121,6 +126,37 @@ void uIPManagement_ManageNetwork(void)
 	}
 }
 
+/** Adds the current uIP TCP connection to the ready list, so that its application will be polled for more data to
+ *  send on the next management pass. Applications must call this from their uIP callback whenever they defer work
+ *  to a later poll, as connections not in the ready list are otherwise only polled by the periodic connection timer.
+ */
+void uIPManagement_SetConnectionReady(void)
+{
+	uint8_t ConnectionIndex = (uip_conn - uip_conns);
+
+	ReadyConnections[ConnectionIndex / 8] |= (1 << (ConnectionIndex % 8));
+}
+
+/** Determines how long the uIP stack can be left unmanaged while no packets are received, so that the caller can wait
+ *  for incoming traffic rather than repeatedly calling \ref uIPManagement_ManageNetwork().
+ *
+ *  \return Number of uIP clock ticks until the next periodic connection or ARP management pass is due, or zero if a
+ *          connection in the ready list can be polled immediately.
+ */
+clock_time_t uIPManagement_GetIdleTime(void)
+{
+	for (uint8_t i = 0; i < UIP_CONNS; i++)
+	{
+		if ((ReadyConnections[i / 8] & (1 << (i % 8))) && uIPManagement_CanPollConnection(&uip_conns[i]))
+		  return 0;
+	}
+
+	clock_time_t ConnectionTimeRemaining = uIPManagement_GetTimeRemaining(&ConnectionTimer);
+	clock_time_t ARPTimeRemaining        = uIPManagement_GetTimeRemaining(&ARPTimer);
+
+	return (ConnectionTimeRemaining < ARPTimeRemaining) ? ConnectionTimeRemaining : ARPTimeRemaining;
+}
+
 /** uIP TCP/IP network stack callback function for the processing of a given TCP connection. This routine dispatches
  *  to the appropriate TCP protocol application based on the connection's listen port number.
  */
@@ -228,19 +264,40 @@ static void uIPManagement_ProcessIncomingPacket(void)
 /** Manages the currently open network connections, including TCP and (if enabled) UDP. */
 static void uIPManagement_ManageConnections(void)
 {
-	/* Poll TCP connections for more data to send back to the host */
-	for (uint8_t i = 0; i < UIP_CONNS; i++)
+	/* Poll the TCP connections in the ready list for more data to send back to the host */
+	for (uint8_t ReadyBlock = 0; ReadyBlock < sizeof(ReadyConnections); ReadyBlock++)
 	{
-		uip_poll_conn(&uip_conns[i]);
+		/* Skip over groups of connections with no pending work in a single check */
+		if (!(ReadyConnections[ReadyBlock]))
+		  continue;
 
-		/* If a response was generated, send it */
-		if (uip_len > 0)
+		for (uint8_t ReadyBit = 0; ReadyBit < 8; ReadyBit++)
 		{
-			/* Add destination MAC to outgoing packet */
-			uip_arp_out();
+			uint8_t ReadyMask = (1 << ReadyBit);
+
+			if (!(ReadyConnections[ReadyBlock] & ReadyMask))
+			  continue;
+
+			struct uip_conn* Connection = &uip_conns[(ReadyBlock * 8) + ReadyBit];
+
+			/* Connections with unacknowledged data cannot be polled yet, leave them in the ready list until later */
+			if (!(uIPManagement_CanPollConnection(Connection)))
+			  continue;
+
+			/* Remove the connection from the ready list before polling, so that the application can re-add it */
+			ReadyConnections[ReadyBlock] &= ~ReadyMask;
+
+			uip_poll_conn(Connection);
 
-			/* Split and send the outgoing packet */
-			uip_split_output();
+			/* If a response was generated, send it */
+			if (uip_len > 0)
+			{
+				/* Add destination MAC to outgoing packet */
+				uip_arp_out();
+
+				/* Split and send the outgoing packet */
+				uip_split_output();
+			}
 		}
 	}
 
@@ -253,7 +310,11 @@ static void uIPManagement_ManageConnections(void)
 
 		for (uint8_t i = 0; i < UIP_CONNS; i++)
 		{
-			/* Run periodic connection management for each TCP connection */
+			/* Closed connection slots have no retransmission or timeout state to manage, skip them */
+			if (uip_conns[i].tcpstateflags == UIP_CLOSED)
+			  continue;
+
+			/* Run periodic connection management for each open TCP connection */
 			uip_periodic(i);
 
 			/* If a response was generated, send it */
@@ -296,3 +357,28 @@ static void uIPManagement_ManageConnections(void)
 	}
 }
 
+/** Determines if the given TCP connection in the ready list can be polled for more data to send.
+ *
+ *  \param[in] Connection  Pointer to the uIP connection to check.
+ *
+ *  \return Boolean \c true if the connection has no unacknowledged data outstanding, \c false otherwise.
+ */
+static bool uIPManagement_CanPollConnection(struct uip_conn* Connection)
+{
+	return !(((Connection->tcpstateflags & UIP_TS_MASK) == UIP_ESTABLISHED) && uip_outstanding(Connection));
+}
+
+/** Retrieves the number of uIP clock ticks remaining until the given timer expires.
+ *
+ *  \param[in] Timer  Pointer to the uIP timer to check.
+ *
+ *  \return Number of clock ticks until the timer expires, or zero if it has already expired.
+ */
+static clock_time_t uIPManagement_GetTimeRemaining(struct timer* Timer)
+{
+	if (timer_expired(Timer))
+	  return 0;
+
+	return (Timer->interval - (clock_time_t)(clock_time() - Timer->start));
+}
+
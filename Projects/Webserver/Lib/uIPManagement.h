@@ -37,7 +37,13 @@
 #define _UIP_MANAGEMENT_H_
 
 	/* Includes: */
-		#include <LUFA/Drivers/USB/USB.h>
+		#if !defined(HOST_NATIVE_BUILD)
+			#include <LUFA/Drivers/USB/USB.h>
+
+			#include "../Webserver.h"
+		#else
+			#include "../HostNative/NativePlatform.h"
+		#endif
 
 		#include <uip.h>
 		#include <uip_arp.h>
@@ -57,12 +63,16 @@
 	/* Function Prototypes: */
 		void uIPManagement_Init(void);
 		void uIPManagement_ManageNetwork(void);
+		void uIPManagement_SetConnectionReady(void);
+		clock_time_t uIPManagement_GetIdleTime(void);
 		void uIPManagement_TCPCallback(void);
 		void uIPManagement_UDPCallback(void);
 
 		#if defined(INCLUDE_FROM_UIPMANAGEMENT_C)
 			static void uIPManagement_ProcessIncomingPacket(void);
 			static void uIPManagement_ManageConnections(void);
+			static bool uIPManagement_CanPollConnection(struct uip_conn* Connection);
+			static clock_time_t uIPManagement_GetTimeRemaining(struct timer* Timer);
 		#endif
 
 #endif
@@ -75,9 +75,13 @@
 #include <string.h>
 #include <uip.h>
 
+#if !defined(HOST_NATIVE_BUILD)
 #include "../../USBHostMode.h"
 
 #include <LUFA/Drivers/USB/USB.h>
+#else
+#include "../../HostNative/NativePlatform.h"
+#endif
 
 /**
  * Handle outgoing packets.
@@ -694,10 +694,9 @@ typedef union
 		uint8_t  NextState;
 
 		char     FileName[MAX_URI_LENGTH];
-		FIL      FileHandle;
-		bool     FileOpen;
+		uint8_t  FileIndex;
 		uint32_t ACKedFilePos;
-		uint16_t SentChunkSize;
+		UINT     SentChunkSize;
 	} HTTPServer;
 
 	struct
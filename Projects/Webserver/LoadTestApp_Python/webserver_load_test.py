@@ -0,0 +1,126 @@
+"""
+             LUFA Library
+     Copyright (C) Dean Camera, 2017.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+"""
+
+"""
+    HTTP load test app for the Webserver project. This script opens a number
+    of concurrent client connections to the webserver, repeatedly fetching
+    the given file over a fixed duration, and reports the achieved request
+    rate and the request latency distribution.
+
+    Usage:
+        python webserver_load_test.py [Host] [Path] [Clients] [Duration]
+
+    Example:
+        python webserver_load_test.py 10.0.0.2 /index.htm 3 10
+
+    The default number of clients matches the default number of uIP
+    connections in the webserver's configuration.
+"""
+
+import sys
+import socket
+import threading
+import time
+
+# Per-request socket timeout, in seconds
+request_timeout = 5.0
+
+
+def fetch_file(host, path):
+    request = ("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n" %
+               (path, host)).encode("ascii")
+
+    start_time = time.time()
+
+    conn = socket.create_connection((host, 80), timeout=request_timeout)
+    try:
+        conn.sendall(request)
+
+        response = b""
+        while True:
+            chunk = conn.recv(4096)
+            if not chunk:
+                break
+            response += chunk
+    finally:
+        conn.close()
+
+    latency = time.time() - start_time
+    success = response.startswith(b"HTTP/1.1 200")
+
+    return (success, latency, len(response))
+
+
+def client_thread(host, path, end_time, results, lock):
+    while time.time() < end_time:
+        try:
+            result = fetch_file(host, path)
+        except (socket.error, socket.timeout):
+            result = (False, None, 0)
+
+        with lock:
+            results.append(result)
+
+
+def percentile(sorted_values, percent):
+    if len(sorted_values) == 0:
+        return 0
+
+    index = int(round((percent / 100.0) * (len(sorted_values) - 1)))
+    return sorted_values[index]
+
+
+def main(host, path, clients, duration):
+    results = []
+    lock = threading.Lock()
+
+    print("Load testing http://%s%s with %d clients for %ds..." %
+          (host, path, clients, duration))
+
+    start_time = time.time()
+    end_time = start_time + duration
+
+    threads = [threading.Thread(target=client_thread,
+                                args=(host, path, end_time, results, lock))
+               for i in range(clients)]
+
+    for thread in threads:
+        thread.start()
+
+    for thread in threads:
+        thread.join()
+
+    elapsed = time.time() - start_time
+
+    completed = [r for r in results if r[0]]
+    latencies = sorted(r[1] for r in completed)
+    total_bytes = sum(r[2] for r in completed)
+
+    print("Requests:      %d completed, %d failed" %
+          (len(completed), len(results) - len(completed)))
+    print("Throughput:    %0.2f requests/s, %0.1f KB/s" %
+          (len(completed) / elapsed, (total_bytes / 1024.0) / elapsed))
+
+    if len(latencies) == 0:
+        sys.exit(1)
+
+    print("Latency (ms):  min %0.1f, p50 %0.1f, p90 %0.1f, p99 %0.1f, max %0.1f" %
+          (latencies[0] * 1000,
+           percentile(latencies, 50) * 1000,
+           percentile(latencies, 90) * 1000,
+           percentile(latencies, 99) * 1000,
+           latencies[-1] * 1000))
+
+
+if __name__ == '__main__':
+    host = sys.argv[1] if len(sys.argv) > 1 else "10.0.0.2"
+    path = sys.argv[2] if len(sys.argv) > 2 else "/index.htm"
+    clients = int(sys.argv[3]) if len(sys.argv) > 3 else 3
+    duration = int(sys.argv[4]) if len(sys.argv) > 4 else 10
+
+    main(host, path, clients, duration)
@@ -54,6 +54,10 @@ int main(void)
 		  USBDeviceMode_USBTask();
 
 		USB_USBTask();
+
+		#if defined(DATAFLASH_FTL)
+		DataflashFTL_Task();
+		#endif
 	}
 }
 
@@ -71,6 +75,9 @@ void SetupHardware(void)
 
 	/* Hardware Initialization */
 	Dataflash_Init();
+	#if defined(DATAFLASH_FTL)
+	DataflashFTL_Init();
+	#endif
 	LEDs_Init();
 	USB_Init(USB_MODE_UID);
 }
@@ -51,6 +51,7 @@
 
 		#include "USBDeviceMode.h"
 		#include "USBHostMode.h"
+		#include "Lib/DataflashFTL.h"
 		#include "Config/AppConfig.h"
 
 	/* Macros: */